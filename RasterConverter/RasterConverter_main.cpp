@@ -0,0 +1,62 @@
+/*
+ * RasterConverter_main.cpp
+ *
+ * Converts ESRI ASCII rasters to the binary raster format read by
+ * AscFileManager, and binary rasters back to ASCII.
+ *
+ *   RasterConverter district.asc                 writes the cache district.asc.bin
+ *   RasterConverter district.asc -o district.bin writes a standalone binary raster
+ *   RasterConverter district.bin -o district.asc writes the ASCII raster
+ */
+#include <spdlog/spdlog.h>
+
+#include <CLI/CLI.hpp>
+#include <string>
+#include <vector>
+
+#include "Spatial/GIS/AscFile.h"
+
+int main(int argc, char** argv) {
+  CLI::App app{"Converts rasters between the ESRI ASCII and binary formats"};
+
+  std::vector<std::string> input_files;
+  std::string output_file;
+  app.add_option("input", input_files, "ASC or binary raster files to convert.")->required();
+  app.add_option("-o,--output", output_file,
+                 "Output file, only with a single input. Default: the cache next to the ASC "
+                 "file, which the simulation picks up while the ASC file is unchanged.");
+  CLI11_PARSE(app, argc, argv);
+
+  if (!output_file.empty() && input_files.size() > 1) {
+    spdlog::error("--output can only be used with a single input file");
+    return 1;
+  }
+
+  // Read the inputs as they are, without going through their caches
+  AscFileManager::set_binary_cache_enabled(false);
+  try {
+    for (const auto &input_file : input_files) {
+      auto raster = AscFileManager::read(input_file);
+      if (AscFileManager::is_binary(input_file)) {
+        if (output_file.empty()) {
+          spdlog::error("{} is a binary raster, --output is required", input_file);
+          return 1;
+        }
+        AscFileManager::write(raster.get(), output_file);
+        spdlog::info("Converted {} to {}", input_file, output_file);
+        continue;
+      }
+
+      const auto cache_path = AscFileManager::binary_cache_path(input_file);
+      const auto destination = output_file.empty() ? cache_path : output_file;
+      AscFileManager::write_binary(
+          raster.get(), destination,
+          destination == cache_path ? AscFileManager::source_key(input_file) : AscSourceKey{});
+      spdlog::info("Converted {} to {}", input_file, destination);
+    }
+  } catch (const std::exception &ex) {
+    spdlog::error("{}", ex.what());
+    return 1;
+  }
+  return 0;
+}
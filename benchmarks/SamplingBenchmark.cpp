@@ -0,0 +1,86 @@
+// Compares utils::Random::roulette_sampling with the AliasTable and FenwickTree samplers on
+// population-sized weight vectors.
+//
+// Usage: SamplingBenchmark [population_size] [number_of_samples] [repetitions]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Utils/AliasTable.h"
+#include "Utils/FenwickTree.h"
+#include "Utils/Random.h"
+
+namespace {
+struct Dummy {};
+
+template <typename Function>
+double milliseconds_per_call(int repetitions, Function &&function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repetitions; i++) { function(); }
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / repetitions;
+}
+
+void report(const std::string &name, double milliseconds) {
+  std::cout << name << ": " << milliseconds << " ms/call\n";
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int population_size = argc > 1 ? std::atoi(argv[1]) : 100000;
+  const int number_of_samples = argc > 2 ? std::atoi(argv[2]) : 1000;
+  const int repetitions = argc > 3 ? std::atoi(argv[3]) : 100;
+
+  utils::Random random(nullptr, 42);
+  std::vector<double> weights(population_size);
+  for (auto &weight : weights) { weight = random.random_gamma(1.0, 1.0); }
+  double sum = 0.0;
+  for (const auto weight : weights) { sum += weight; }
+  std::vector<Dummy> objects(population_size);
+  std::vector<Dummy*> object_pointers;
+  for (auto &object : objects) { object_pointers.push_back(&object); }
+
+  std::cout << "population " << population_size << ", samples " << number_of_samples
+            << ", repetitions " << repetitions << "\n";
+
+  std::size_t checksum = 0;
+  report("roulette_sampling", milliseconds_per_call(repetitions, [&] {
+           const auto samples = random.roulette_sampling<Dummy>(number_of_samples, weights,
+                                                                object_pointers, false, sum);
+           checksum += samples.size();
+         }));
+
+  utils::AliasTable alias_table;
+  std::vector<std::size_t> indices(number_of_samples);
+  report("alias table build + draw", milliseconds_per_call(repetitions, [&] {
+           alias_table.assign(weights);
+           alias_table.sample(&random, indices);
+           checksum += indices.back();
+         }));
+  report("alias table draw only", milliseconds_per_call(repetitions, [&] {
+           alias_table.sample(&random, indices);
+           checksum += indices.back();
+         }));
+
+  utils::FenwickTree fenwick_tree(weights);
+  report("fenwick tree draw", milliseconds_per_call(repetitions, [&] {
+           fenwick_tree.sample(&random, indices);
+           checksum += indices.back();
+         }));
+  // a day in a low transmission setting: a few hundred weights change between draws
+  report("fenwick tree 500 updates + draw", milliseconds_per_call(repetitions, [&] {
+           for (int i = 0; i < 500; i++) {
+             const auto index = random.random_uniform(static_cast<uint64_t>(population_size));
+             fenwick_tree.set(index, random.random_gamma(1.0, 1.0));
+           }
+           fenwick_tree.sample(&random, indices);
+           checksum += indices.back();
+         }));
+
+  std::cout << "checksum " << checksum << "\n";
+  return 0;
+}
@@ -6,6 +6,7 @@
 #include <filesystem>
 
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Cli.h"
 
 int inline get_pipe_count(const std::string &str) {
@@ -167,6 +168,8 @@ bool Config::load(const std::string &filename) {
 
     spdlog::info("Population events parsed successfully");
 
+    rebuild_hot_parameters();
+
     return true;
   } catch (YAML::BadFile) {
     std::cerr << "Error: File not found" << '\n';
@@ -175,6 +178,60 @@ bool Config::load(const std::string &filename) {
   return false;
 }
 
+void Config::rebuild_hot_parameters() {
+  HotParameters parameters;
+
+  parameters.c_max = immune_system_parameters_.c_max;
+  parameters.c_min = immune_system_parameters_.c_min;
+  parameters.decay_rate = immune_system_parameters_.decay_rate;
+  parameters.max_clinical_probability = immune_system_parameters_.max_clinical_probability;
+  parameters.midpoint = immune_system_parameters_.midpoint;
+  parameters.immune_effect_on_progression_to_clinical =
+      immune_system_parameters_.immune_effect_on_progression_to_clinical;
+  // the rates are only filled once the immune parameters are processed
+  const auto &acquire_rate_by_age = immune_system_parameters_.acquire_rate_by_age;
+  std::copy_n(acquire_rate_by_age.begin(),
+              std::min(acquire_rate_by_age.size(), parameters.acquire_rate_by_age.size()),
+              parameters.acquire_rate_by_age.begin());
+
+  const auto &density_levels = parasite_parameters_.get_parasite_density_levels();
+  parameters.log_parasite_density_cured = density_levels.get_log_parasite_density_cured();
+  parameters.log_parasite_density_from_liver = density_levels.get_log_parasite_density_from_liver();
+  parameters.log_parasite_density_asymptomatic =
+      density_levels.get_log_parasite_density_asymptomatic();
+  parameters.log_parasite_density_clinical_from =
+      density_levels.get_log_parasite_density_clinical_from();
+  parameters.log_parasite_density_clinical_to = density_levels.get_log_parasite_density_clinical_to();
+  parameters.log_parasite_density_detectable_pfpr =
+      density_levels.get_log_parasite_density_detectable_pfpr();
+
+  const auto &epidemiological = epidemiological_parameters_;
+  const auto &relative_infectivity = epidemiological.get_relative_infectivity();
+  parameters.relative_infectivity_sigma = relative_infectivity.get_sigma();
+  parameters.relative_infectivity_ro_star = relative_infectivity.get_ro_star();
+  parameters.relative_infectivity_cdf_table = relative_infectivity.get_cdf_table();
+  parameters.p_compliance = epidemiological.get_p_compliance();
+  parameters.p_relapse = epidemiological.get_p_relapse();
+  parameters.gametocyte_level_full = epidemiological.get_gametocyte_level_full();
+  parameters.min_dosing_days = epidemiological.get_min_dosing_days();
+  parameters.days_to_clinical_under_five = epidemiological.get_days_to_clinical_under_five();
+  parameters.days_to_clinical_over_five = epidemiological.get_days_to_clinical_over_five();
+  parameters.days_mature_gametocyte_under_five =
+      epidemiological.get_days_mature_gametocyte_under_five();
+  parameters.days_mature_gametocyte_over_five =
+      epidemiological.get_days_mature_gametocyte_over_five();
+  parameters.relapse_duration = epidemiological.get_relapse_duration();
+  parameters.using_age_dependent_biting_level =
+      epidemiological.get_using_age_dependent_biting_level();
+  parameters.allow_new_coinfection_to_cause_symptoms =
+      epidemiological.get_allow_new_coinfection_to_cause_symptoms();
+
+  parameters.mutation_probability_per_locus =
+      genotype_parameters_.get_mutation_probability_per_locus();
+
+  hot_parameters_ = parameters;
+}
+
 size_t Config::number_of_parasite_types() { return Model::get_genotype_db()->size(); }
 
 size_t Config::number_of_locations() const { return spatial_settings_.get_number_of_locations(); }
@@ -191,6 +248,33 @@ const std::vector<int> &Config::age_structure() const {
   return population_demographic_.get_age_structure();
 }
 
+void Config::checkpoint(utils::CheckpointArchive &archive) {
+  for (auto &location : location_db()) { archive & location.beta & location.mosquito_ifr; }
+
+  auto circulation_info = movement_settings_.get_circulation_info();
+  auto circulation_percent = circulation_info.get_circulation_percent();
+  auto mutation_mask = genotype_parameters_.get_mutation_mask();
+  auto mutation_probability = genotype_parameters_.get_mutation_probability_per_locus();
+  auto within_host_induced_free_recombination =
+      mosquito_parameters_.get_within_host_induced_free_recombination();
+  archive & circulation_percent & mutation_mask & mutation_probability
+      & within_host_induced_free_recombination;
+  if (auto* seasonal_equation = seasonality_settings_.get_seasonal_equation();
+      seasonal_equation != nullptr) {
+    seasonal_equation->checkpoint(archive);
+  }
+
+  if (archive.is_loading()) {
+    circulation_info.set_circulation_percent(circulation_percent);
+    movement_settings_.set_circulation_info(circulation_info);
+    genotype_parameters_.set_mutation_mask(mutation_mask);
+    genotype_parameters_.set_mutation_probability_per_locus(mutation_probability);
+    mosquito_parameters_.set_within_host_induced_free_recombination(
+        within_host_induced_free_recombination);
+    rebuild_hot_parameters();
+  }
+}
+
 std::vector<Spatial::Location> &Config::location_db() { return spatial_settings_.location_db(); }
 
 // std::vector<IStrategy *>& Config::strategy_db() {
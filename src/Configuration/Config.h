@@ -7,6 +7,7 @@
 #include "DrugParameters.h"
 #include "EpidemiologicalParameters.h"
 #include "GenotypeParameters.h"
+#include "HotParameters.h"
 #include "ImmuneSystemParameters.h"
 #include "ModelSettings.h"
 #include "MosquitoParameters.h"
@@ -22,6 +23,10 @@
 #include "TherapyParameters.h"
 #include "TransmissionSettings.h"
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class Config {
 public:
   // Disallow copy
@@ -33,7 +38,7 @@ public:
   Config& operator=(Config&&) = delete;
 
   // Constructor and Destructor
-  Config() = default;
+  Config() { rebuild_hot_parameters(); }
   virtual ~Config() = default;
 
   // Load configuration from a YAML file
@@ -45,6 +50,16 @@ public:
   // Validate all cross-field validations
   void validate_all_cross_field_validations();
 
+  // Snapshot of the values read per person, see HotParameters
+  [[nodiscard]] const HotParameters &hot_parameters() const { return hot_parameters_; }
+
+  // Copy the values again after one was changed through a non-const getter
+  void rebuild_hot_parameters();
+
+  // Save or restore the values the population events change while running: beta and interrupted
+  // feeding rate of the locations, circulation percent, mutation settings and seasonality
+  void checkpoint(utils::CheckpointArchive &archive);
+
   // Getters for entire configuration structures
   [[nodiscard]] const ModelSettings &get_model_settings() const { return model_settings_; }
   void set_model_settings(const ModelSettings &settings) { model_settings_ = settings; }
@@ -71,6 +86,7 @@ public:
   }
   void set_epidemiological_parameters(const EpidemiologicalParameters &parameters) {
     epidemiological_parameters_ = parameters;
+    rebuild_hot_parameters();
   }
 
   [[nodiscard]] const ParasiteParameters &get_parasite_parameters() const {
@@ -78,6 +94,7 @@ public:
   }
   void set_parasite_parameters(const ParasiteParameters &parameters) {
     parasite_parameters_ = parameters;
+    rebuild_hot_parameters();
   }
 
   [[nodiscard]] SpatialSettings &get_spatial_settings() {
@@ -93,6 +110,7 @@ public:
   }
   void set_immune_system_parameters(const ImmuneSystemParameters &parameters) {
     immune_system_parameters_ = parameters;
+    rebuild_hot_parameters();
   }
 
   [[nodiscard]] GenotypeParameters &get_genotype_parameters() { return genotype_parameters_; }
@@ -151,6 +169,8 @@ private:
   MosquitoParameters mosquito_parameters_;
   PopulationEvents population_events_;
   RaptSettings rapt_settings_;
+
+  HotParameters hot_parameters_;
 };
 
 #endif  // CONFIG_H
@@ -9,7 +9,9 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <memory>
 #include "IConfigData.h"
+#include "Utils/NormalCdfTable.h"
 
 class EpidemiologicalParameters: public IConfigData {
 public:
@@ -104,10 +106,27 @@ public:
         [[nodiscard]] double get_blood_meal_volume() const { return blood_meal_volume_; }
         void set_blood_meal_volume(const double value) { blood_meal_volume_ = value; }
 
+        // Accuracy of the tabulated normal CDF used by Person::relative_infectivity, 0 evaluates
+        // the exact CDF on every call. The table is in terms of the normal deviate, so it does
+        // not depend on sigma and ro and only has to be rebuilt when the tolerance changes.
+        [[nodiscard]] double get_cdf_table_tolerance() const { return cdf_table_tolerance_; }
+        void set_cdf_table_tolerance(const double value) {
+            if (value < 0.0 || value >= 1.0) {
+                throw std::invalid_argument("cdf_table_tolerance must be in [0, 1)");
+            }
+            cdf_table_tolerance_ = value;
+            cdf_table_ = value > 0.0 ? std::make_shared<const utils::NormalCdfTable>(value) : nullptr;
+        }
+
+        [[nodiscard]] const utils::NormalCdfTable* get_cdf_table() const { return cdf_table_.get(); }
+
     private:
         double sigma_ = 3.91;
         double ro_star_ = 0.00031;
         double blood_meal_volume_ = 3.0;
+        double cdf_table_tolerance_ = 0.0;
+        // shared between copies, the table is immutable once built
+        std::shared_ptr<const utils::NormalCdfTable> cdf_table_;
     };
 
     class AgeBasedProbabilityOfSeekingTreatment {
@@ -438,6 +457,7 @@ struct convert<EpidemiologicalParameters::RelativeInfectivity> {
         node["sigma"] = rhs.get_sigma();
         node["ro"] = rhs.get_ro_star();
         node["blood_meal_volume"] = rhs.get_blood_meal_volume();
+        node["cdf_table_tolerance"] = rhs.get_cdf_table_tolerance();
         return node;
     }
 
@@ -448,6 +468,10 @@ struct convert<EpidemiologicalParameters::RelativeInfectivity> {
         rhs.set_sigma(node["sigma"].as<double>());
         rhs.set_ro_star(node["ro"].as<double>());
         rhs.set_blood_meal_volume(node["blood_meal_volume"].as<double>());
+        // cdf_table_tolerance is optional, defaults to the exact CDF
+        if (node["cdf_table_tolerance"]) {
+            rhs.set_cdf_table_tolerance(node["cdf_table_tolerance"].as<double>());
+        }
         return true;
     }
 };
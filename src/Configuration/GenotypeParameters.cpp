@@ -1,9 +1,12 @@
 #include "GenotypeParameters.h"
 
+#include "Parasites/GenotypeEncoding.h"
 #include "Simulation/Model.h"
 
 void GenotypeParameters::process_config_with_number_of_locations(size_t number_of_locations) {
   spdlog::info("Processing GenotypeParameters");
+  // the packed layout must be known before the first genotype is created
+  Model::get_genotype_db()->set_encoding(std::make_unique<GenotypeEncoding>(pf_genotype_info_));
   for (const auto &initial_genotype_info_raw : get_initial_parasite_info_raw()) {
     const auto location = initial_genotype_info_raw.get_location_id();
     const auto location_from = location == -1 ? 0 : location;
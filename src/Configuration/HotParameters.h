@@ -0,0 +1,64 @@
+#ifndef HOTPARAMETERS_H
+#define HOTPARAMETERS_H
+
+#include <array>
+#include <cstddef>
+
+namespace utils {
+class NormalCdfTable;
+}
+
+/**
+ * @struct HotParameters
+ * @brief Flat copy of the configuration values read per person and per parasite.
+ *
+ * The daily update and the person events used to reach these values through chains of getters
+ * on the configuration, some of them copying a whole parameter structure per call. Config keeps
+ * this snapshot next to the structures it is built from: it is rebuilt after load(), by the
+ * setters of these structures and by the population events changing one of the values, so it
+ * never differs from them. Readers take one reference at the top of the hot function, or get it
+ * passed in, and read plain fields afterwards.
+ */
+struct alignas(64) HotParameters {
+  // NonInfantImmuneComponent uses the rate of age 80 for older persons
+  static constexpr std::size_t NUMBER_OF_ACQUIRE_RATE_AGES = 81;
+
+  // ImmuneSystemParameters
+  double c_max{-1};
+  double c_min{-1};
+  double decay_rate{-1};
+  double max_clinical_probability{-1};
+  double midpoint{-1};
+  double immune_effect_on_progression_to_clinical{-1};
+  std::array<double, NUMBER_OF_ACQUIRE_RATE_AGES> acquire_rate_by_age{};
+
+  // ParasiteParameters::ParasiteDensityLevels
+  double log_parasite_density_cured{0};
+  double log_parasite_density_from_liver{0};
+  double log_parasite_density_asymptomatic{0};
+  double log_parasite_density_clinical_from{0};
+  double log_parasite_density_clinical_to{0};
+  double log_parasite_density_detectable_pfpr{0};
+
+  // EpidemiologicalParameters
+  double relative_infectivity_sigma{0};
+  double relative_infectivity_ro_star{0};
+  // owned by the relative infectivity parameters, null when the CDF is not tabulated
+  const utils::NormalCdfTable* relative_infectivity_cdf_table{nullptr};
+  double p_compliance{1};
+  double p_relapse{0};
+  double gametocyte_level_full{0};
+  int min_dosing_days{0};
+  int days_to_clinical_under_five{0};
+  int days_to_clinical_over_five{0};
+  int days_mature_gametocyte_under_five{0};
+  int days_mature_gametocyte_over_five{0};
+  int relapse_duration{0};
+  bool using_age_dependent_biting_level{false};
+  bool allow_new_coinfection_to_cause_symptoms{false};
+
+  // GenotypeParameters
+  double mutation_probability_per_locus{0};
+};
+
+#endif  // HOTPARAMETERS_H
@@ -43,6 +43,22 @@ public:
   bool get_enable_recrudescence() const { return enable_recrudescence_; }
   void set_enable_recrudescence(const bool value) { enable_recrudescence_ = value; }
 
+  [[nodiscard]] int get_number_of_threads() const { return number_of_threads_; }
+  void set_number_of_threads(const int value) {
+    if (value <= 0) throw std::invalid_argument("number_of_threads must be greater than 0");
+    number_of_threads_ = value;
+  }
+
+  [[nodiscard]] bool get_incremental_force_of_infection() const {
+    return incremental_force_of_infection_;
+  }
+  void set_incremental_force_of_infection(const bool value) {
+    incremental_force_of_infection_ = value;
+  }
+
+  [[nodiscard]] utils::Random::Generator get_random_generator() const { return random_generator_; }
+  void set_random_generator(const utils::Random::Generator value) { random_generator_ = value; }
+
   void process_config() override {
     spdlog::info("Processing ModelSettings");
   }
@@ -53,6 +69,9 @@ private:
   bool record_genome_db_ = true;
   bool cell_level_reporting_ = true;
   bool enable_recrudescence_ = true;
+  int number_of_threads_ = 1;
+  bool incremental_force_of_infection_ = false;
+  utils::Random::Generator random_generator_ = utils::Random::Generator::MT19937;
 };
 
 template <>
@@ -64,6 +83,10 @@ struct YAML::convert<ModelSettings> {
     node["record_genome_db"] = rhs.get_record_genome_db();
     node["cell_level_reporting"] = rhs.get_cell_level_reporting();
     node["enable_recrudescence"] = rhs.get_enable_recrudescence();
+    node["number_of_threads"] = rhs.get_number_of_threads();
+    node["incremental_force_of_infection"] = rhs.get_incremental_force_of_infection();
+    node["random_generator"] =
+        rhs.get_random_generator() == utils::Random::Generator::PHILOX4X32 ? "philox" : "mt19937";
     return node;
   }
 
@@ -91,6 +114,28 @@ struct YAML::convert<ModelSettings> {
     if (node["enable_recrudescence"]) {
       rhs.set_enable_recrudescence(node["enable_recrudescence"].as<bool>());
     }
+
+    // number_of_threads is optional, defaults to 1 (serial initialization and update)
+    if (node["number_of_threads"]) {
+      rhs.set_number_of_threads(node["number_of_threads"].as<int>());
+    }
+
+    // incremental_force_of_infection is optional, defaults to the full daily rebuild
+    if (node["incremental_force_of_infection"]) {
+      rhs.set_incremental_force_of_infection(node["incremental_force_of_infection"].as<bool>());
+    }
+
+    // random_generator is optional, defaults to mt19937
+    if (node["random_generator"]) {
+      const auto generator = node["random_generator"].as<std::string>();
+      if (generator == "mt19937") {
+        rhs.set_random_generator(utils::Random::Generator::MT19937);
+      } else if (generator == "philox") {
+        rhs.set_random_generator(utils::Random::Generator::PHILOX4X32);
+      } else {
+        throw std::invalid_argument("random_generator must be either 'mt19937' or 'philox'");
+      }
+    }
     
     return true;
   }
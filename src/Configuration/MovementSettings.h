@@ -276,6 +276,14 @@ public:
       relative_probability_for_clinical_to_travel_ = value;
     }
 
+    [[nodiscard]] double get_destination_cache_tolerance() const {
+      return destination_cache_tolerance_;
+    }
+    void set_destination_cache_tolerance(const double value) {
+      if (value < 0) throw std::invalid_argument("destination_cache_tolerance must be non-negative");
+      destination_cache_tolerance_ = value;
+    }
+
   private:
     MovingLevelDistribution moving_level_distribution_;
     MovingLevelDistributionGamma moving_level_distribution_gamma_;
@@ -284,6 +292,9 @@ public:
     int max_relative_moving_value_ = 35;
     int number_of_moving_levels_ = 100;
     double circulation_percent_ = 0.00336;
+    // relative drift of the residents that triggers a rebuild of the cached destination
+    // distributions, 0 draws the destinations from fresh weights every day
+    double destination_cache_tolerance_ = 0;
 
     double relative_probability_that_child_travels_compared_to_adult_ = 1.0;
     double relative_probability_for_clinical_to_travel_ = 1.0;
@@ -699,6 +710,7 @@ struct convert<MovementSettings::CirculationInfo> {
         rhs.get_relative_probability_that_child_travels_compared_to_adult();
     node["relative_probability_for_clinical_to_travel"] =
         rhs.get_relative_probability_for_clinical_to_travel();
+    node["destination_cache_tolerance"] = rhs.get_destination_cache_tolerance();
     return node;
   }
 
@@ -733,6 +745,10 @@ struct convert<MovementSettings::CirculationInfo> {
           "not set in input file, defaulting to 1.0");
       rhs.set_relative_probability_for_clinical_to_travel(1.0);
     }
+    // destination_cache_tolerance is optional, defaults to 0 (no cache)
+    if (node["destination_cache_tolerance"]) {
+      rhs.set_destination_cache_tolerance(node["destination_cache_tolerance"].as<double>());
+    }
     return true;
   }
 };
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Configuration/IConfigData.h"
+#include "Spatial/GIS/SparseDistanceMatrix.h"
 #include "Spatial/GIS/SpatialData.h"
 #include "Spatial/Location/Location.h"
 
@@ -30,6 +31,7 @@ public:
     std::string beta_raster;
     std::string ecoclimatic_raster;
     double cell_size{0.0};
+    double distance_cutoff{0.0};
     std::vector<std::vector<double>> age_distribution_by_location;
     int number_of_location{0};
   };
@@ -56,6 +58,14 @@ public:
     spatial_distance_matrix_ = value;
   }
 
+  // Set instead of the dense matrix when grid_based.distance_cutoff is positive
+  [[nodiscard]] Spatial::SparseDistanceMatrix &get_sparse_distance_matrix() {
+    return sparse_distance_matrix_;
+  }
+  void set_sparse_distance_matrix(Spatial::SparseDistanceMatrix value) {
+    sparse_distance_matrix_ = std::move(value);
+  }
+
   [[nodiscard]] size_t get_number_of_locations() const { return number_of_location_; }
   void set_number_of_locations(const size_t value) { number_of_location_ = value; }
 
@@ -82,6 +92,7 @@ private:
   YAML::Node node_;
 
   std::vector<std::vector<double>> spatial_distance_matrix_;
+  Spatial::SparseDistanceMatrix sparse_distance_matrix_;
   size_t number_of_location_{0};
   std::vector<Spatial::Location> location_db_;
   std::unique_ptr<SpatialData> spatial_data_{nullptr};
@@ -99,6 +110,7 @@ struct convert<SpatialSettings::GridBased> {
     node["beta_raster"] = rhs.beta_raster;
     node["ecoclimatic_raster"] = rhs.ecoclimatic_raster;
     node["cell_size"] = rhs.cell_size;
+    node["distance_cutoff"] = rhs.distance_cutoff;
     node["age_distribution_by_location"] = rhs.age_distribution_by_location;
     for (int i = 0; i < rhs.administrative_boundaries.size(); i++) {
       node["administrative_boundaries"][i]["name"] = rhs.administrative_boundaries[i].name;
@@ -138,6 +150,8 @@ struct convert<SpatialSettings::GridBased> {
     rhs.p_treatment_over_5_raster = node["p_treatment_over_5_raster"].as<std::string>();
     rhs.beta_raster = node["beta_raster"].as<std::string>();
     rhs.cell_size = node["cell_size"].as<double>();
+    // distance_cutoff is optional, defaults to 0 (dense distance matrix)
+    if (node["distance_cutoff"]) { rhs.distance_cutoff = node["distance_cutoff"].as<double>(); }
     if (node["ecoclimatic_raster"]) {
       rhs.ecoclimatic_raster = node["ecoclimatic_raster"].as<std::string>();
     }
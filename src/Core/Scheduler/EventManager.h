@@ -1,11 +1,24 @@
 #ifndef EVENT_MANAGER_H
 #define EVENT_MANAGER_H
 
-#include <map>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "Events/Event.h"
 #include "spdlog/spdlog.h"
 
+// Event classes carrying a static EventTypeId TYPE_ID
+template <typename T>
+concept TypeTaggedEvent = requires {
+  { T::TYPE_ID } -> std::convertible_to<EventTypeId>;
+};
+
 template <typename EventType>
 class EventManager {
 public:
@@ -17,33 +30,66 @@ public:
   EventManager(EventManager&&) = delete;
   EventManager& operator=(EventManager&&) = delete;
 
+  using EventEntry = std::pair<int, std::unique_ptr<EventType>>;
+  // Sorted by time, events with the same time keep their scheduling order. A person rarely has
+  // more than a handful of pending events, so a contiguous vector is cheaper than a tree.
+  using EventList = std::vector<EventEntry>;
+
 private:
-  std::multimap<int, std::unique_ptr<EventType>> events_;
+  EventList events_;
+
+  // number of events of each tagged type currently in events_ (cancelled ones included)
+  std::array<int, static_cast<std::size_t>(EventTypeId::NUMBER_OF_TYPES)> count_by_type_{};
+
+  int &count_of(const EventType* event) {
+    return count_by_type_[static_cast<std::size_t>(event->type_id())];
+  }
 
-  // Helper method to erase all events at a specific time point
-  void erase_events_at_time(int time) { events_.erase(time); }
+  void erase_event(typename EventList::iterator it) {
+    count_of(it->second.get())--;
+    events_.erase(it);
+  }
+
+  // Exact tag match, T being a tagged class; types deriving from T inherit its tag
+  template <typename T>
+  static bool is_of_type(const EventType* event) {
+    if constexpr (TypeTaggedEvent<T>) {
+      return event->type_id() == T::TYPE_ID;
+    } else {
+      return dynamic_cast<const T*>(event) != nullptr;
+    }
+  }
 
 public:
-  std::multimap<int, std::unique_ptr<EventType>> &get_events() { return events_; }
+  // Read/modify events in place only, adding or removing must go through this class so that the
+  // per-type counts stay correct
+  EventList &get_events() { return events_; }
 
   // Constructor and destructor
   EventManager() = default;
   virtual ~EventManager() = default;
 
   // Initialize/clear events
-  virtual void initialize() { events_.clear(); }
+  virtual void initialize() { clear_all_events(); }
 
   // Execute all events up to and including time
   virtual void execute_events(int time) {
-    while (!events_.empty() && events_.begin()->first <= time) {
-      // take the first event
-      auto event = events_.begin()->second.get();
+    while (!events_.empty() && events_.front().first <= time) {
+      // take the first event, it stays in the list while executing
+      auto* event = events_.front().second.get();
       // execute the event
       event->execute();
       // set the event as not executable
       event->set_executable(false);
-      // then erase the event
-      events_.erase(events_.begin());
+      // then erase the event, events scheduled during the execution are never placed before it
+      // but look it up anyway in case the list was reorganized
+      auto it = events_.begin();
+      if (it != events_.end() && it->second.get() != event) {
+        it = std::ranges::find_if(events_, [event](const auto &entry) {
+          return entry.second.get() == event;
+        });
+      }
+      if (it != events_.end()) { erase_event(it); }
     }
   }
 
@@ -51,7 +97,12 @@ public:
   void schedule_event(std::unique_ptr<EventType> event) {
     if (event) {
       event->set_executable(true);
-      events_.emplace(event->get_time(), std::move(event));
+      count_of(event.get())++;
+      const auto time = event->get_time();
+      // insert after all events with the same time, like std::multimap::emplace
+      const auto position = std::ranges::upper_bound(
+          events_, time, std::less{}, [](const EventEntry &entry) { return entry.first; });
+      events_.emplace(position, time, std::move(event));
     }
   }
 
@@ -62,20 +113,32 @@ public:
   // Convenience method to check if any event exists
   [[nodiscard]] bool has_event() const { return !events_.empty(); }
 
+  // O(1) for tagged event types
   template <typename T>
   [[nodiscard]] bool has_event() const {
-    for (const auto &[time, event] : events_) {
-      if (dynamic_cast<T*>(event.get()) != nullptr) { return true; }
+    if constexpr (TypeTaggedEvent<T>) {
+      return count_by_type_[static_cast<std::size_t>(T::TYPE_ID)] > 0;
+    } else {
+      return std::ranges::any_of(
+          events_, [](const auto &entry) { return is_of_type<T>(entry.second.get()); });
+    }
+  }
+
+  // Number of events of type T, cancelled ones included
+  template <typename T>
+  [[nodiscard]] int count_events() const {
+    if constexpr (TypeTaggedEvent<T>) {
+      return count_by_type_[static_cast<std::size_t>(T::TYPE_ID)];
+    } else {
+      return static_cast<int>(std::ranges::count_if(
+          events_, [](const auto &entry) { return is_of_type<T>(entry.second.get()); }));
     }
-    return false;
   }
 
   // Cancel all events of a specific type
   template <typename T>
   void cancel_all_events() {
-    for (auto &[time, event] : events_) {
-      if (dynamic_cast<T*>(event.get()) != nullptr) { event->set_executable(false); }
-    }
+    cancel_all_events_except<T>(nullptr);
   }
 
   // Cancel all events except the specified one
@@ -88,15 +151,19 @@ public:
   // Cancel all events of type T except the specified one
   template <typename T>
   void cancel_all_events_except(EventType* in_event) {
+    if (!has_event<T>()) { return; }
     for (auto &[time, event] : events_) {
-      if (event.get() != in_event && dynamic_cast<T*>(event.get()) != nullptr) {
+      if (event.get() != in_event && is_of_type<T>(event.get())) {
         event->set_executable(false);
       }
     }
   }
 
   // Clear all events
-  void clear_all_events() { events_.clear(); }
+  void clear_all_events() {
+    events_.clear();
+    count_by_type_.fill(0);
+  }
 };
 
 #endif /* EVENT_MANAGER_H */
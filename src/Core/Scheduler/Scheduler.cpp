@@ -2,8 +2,44 @@
 
 #include <Configuration/Config.h>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Events/Environment/UpdateEcozoneEvent.hxx"
+#include "Events/Population/AnnualBetaUpdateEvent.hxx"
+#include "Events/Population/AnnualCoverageUpdateEvent.hxx"
+#include "Events/Population/ChangeCirculationPercentEvent.hxx"
+#include "Events/Population/ChangeInterruptedFeedingRateEvent.h"
+#include "Events/Population/ChangeMutationMaskEvent.h"
+#include "Events/Population/ChangeMutationProbabilityPerLocusEvent.h"
+#include "Events/Population/ChangeTreatmentCoverageEvent.h"
+#include "Events/Population/ChangeTreatmentStrategyEvent.h"
+#include "Events/Population/ChangeWithinHostInducedFreeRecombinationEvent.h"
+#include "Events/Population/DistrictImportationDailyEvent.h"
+#include "Events/Population/ImportationEvent.h"
+#include "Events/Population/ImportationPeriodicallyEvent.h"
+#include "Events/Population/ImportationPeriodicallyRandomEvent.h"
+#include "Events/Population/Introduce580YMutantEvent.h"
+#include "Events/Population/IntroduceAmodiaquineMutantEvent.h"
+#include "Events/Population/IntroduceLumefantrineMutantEvent.h"
+#include "Events/Population/IntroduceMutantEvent.hxx"
+#include "Events/Population/IntroduceMutantRasterEvent.hxx"
+#include "Events/Population/IntroduceParasitesPeriodicallyEventV2.h"
+#include "Events/Population/IntroducePlas2CopyParasiteEvent.h"
+#include "Events/Population/IntroduceTripleMutantToDPMEvent.h"
+#include "Events/Population/ModifyNestedMFTEvent.h"
+#include "Events/Population/RotateStrategyEvent.h"
+#include "Events/Population/SingleRoundMDAEvent.h"
+#include "Events/Population/TurnOffMutationEvent.h"
+#include "Events/Population/TurnOnMutationEvent.h"
+#include "Events/Population/UpdateBetaRasterEvent.hxx"
 #include "Population/Population.h"
+#include "Simulation/Checkpoint.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Helpers/TimeHelpers.h"
 #include "spdlog/spdlog.h"
 
@@ -19,8 +55,8 @@ void Scheduler::initialize(const date::year_month_day &starting_date,
 }
 
 void Scheduler::run() {
-  current_time_ = 0;
-  for (current_time_ = 0; !can_stop(); current_time_++) {
+  // starts at day 0 after initialize(), or at the day following a restored checkpoint
+  while (!can_stop()) {
     if (current_time_ % Model::get_config()->get_model_settings().get_days_between_stdout_output()
         == 0) {
       spdlog::info("Day: {}", current_time_);
@@ -29,6 +65,122 @@ void Scheduler::run() {
     daily_update();
     end_time_step();
     calendar_date_ += date::days{1};
+    current_time_++;
+
+    if (current_time_ == checkpoint_time_ && !can_stop()) {
+      spdlog::info("Saving checkpoint of day {} to {}", current_time_, checkpoint_path_);
+      Checkpoint::save(checkpoint_path_);
+    }
+  }
+}
+
+void Scheduler::schedule_checkpoint(int time, const std::string &path) {
+  checkpoint_time_ = time;
+  checkpoint_path_ = path;
+}
+
+namespace {
+// Event of the given name with placeholder parameters, overwritten by WorldEvent::checkpoint
+std::unique_ptr<WorldEvent> create_world_event(const std::string &name) {
+  using Factory = std::function<std::unique_ptr<WorldEvent>()>;
+  static const std::map<std::string, Factory> FACTORIES{
+      {AnnualBetaUpdateEvent::EventName,
+       [] { return std::make_unique<AnnualBetaUpdateEvent>(0.0F, -1); }},
+      {AnnualCoverageUpdateEvent::EventName,
+       [] { return std::make_unique<AnnualCoverageUpdateEvent>(0.0F, -1); }},
+      {ChangeCirculationPercentEvent::EventName,
+       [] { return std::make_unique<ChangeCirculationPercentEvent>(0.0F, -1); }},
+      {"ChangeInterruptedFeedingRateEvent",
+       [] { return std::make_unique<ChangeInterruptedFeedingRateEvent>(); }},
+      {"ChangeMutationMaskEvent", [] { return std::make_unique<ChangeMutationMaskEvent>(""); }},
+      {"ChangeMutationProbabilityPerLocusEvent",
+       [] { return std::make_unique<ChangeMutationProbabilityPerLocusEvent>(); }},
+      {"ChangeTreatmentCoverageEvent",
+       [] {
+         return std::make_unique<ChangeTreatmentCoverageEvent>(
+             ITreatmentCoverageModel::create("SteadyTCM"));
+       }},
+      {"ChangeTreatmentStrategyEvent",
+       [] { return std::make_unique<ChangeTreatmentStrategyEvent>(); }},
+      {"ChangeWithinHostInducedRecombinationEvent",
+       [] { return std::make_unique<ChangeWithinHostInducedFreeRecombinationEvent>(); }},
+      {"DistrictImportationDailyEvent",
+       [] { return std::make_unique<DistrictImportationDailyEvent>(); }},
+      {"ImportationEvent", [] { return std::make_unique<ImportationEvent>(); }},
+      {"ImportationPeriodicallyEvent",
+       [] { return std::make_unique<ImportationPeriodicallyEvent>(); }},
+      {ImportationPeriodicallyRandomEvent::EventName,
+       [] { return std::make_unique<ImportationPeriodicallyRandomEvent>(0, -1, 0, 0.0); }},
+      {"580YImportationEvent", [] { return std::make_unique<Introduce580YMutantEvent>(); }},
+      {"IntroduceAmodiaquineMutantEvent",
+       [] { return std::make_unique<IntroduceAmodiaquineMutantEvent>(); }},
+      {"IntroduceLumefantrineMutantEvent",
+       [] { return std::make_unique<IntroduceLumefantrineMutantEvent>(); }},
+      {IntroduceMutantEvent::EVENT_NAME,
+       [] {
+         return std::make_unique<IntroduceMutantEvent>(-1, -1, -1, 0.0,
+                                                       std::vector<std::tuple<int, int, char>>{});
+       }},
+      {IntroduceMutantRasterEvent::EventName,
+       [] {
+         return std::make_unique<IntroduceMutantRasterEvent>(
+             -1, std::vector<int>{}, 0.0, std::vector<std::tuple<int, int, char>>{});
+       }},
+      {"IntroduceParasitesPeriodicallyEventV2",
+       [] { return std::make_unique<IntroduceParasitesPeriodicallyEventV2>(); }},
+      {"IntroducePlas2CopyParasiteEvent",
+       [] { return std::make_unique<IntroducePlas2CopyParasiteEvent>(); }},
+      {"IntroduceTrippleMutantToDPMEvent",
+       [] { return std::make_unique<IntroduceTrippleMutantToDPMEvent>(); }},
+      {"ChangeStrategyEvent", [] { return std::make_unique<ModifyNestedMFTEvent>(-1, -1); }},
+      {RotateStrategyEvent::EventName,
+       [] { return std::make_unique<RotateStrategyEvent>(-1, 0, -1, -1); }},
+      {"SingleRoundMDAEvent", [] { return std::make_unique<SingleRoundMDAEvent>(); }},
+      {"TurnOffMutationEvent", [] { return std::make_unique<TurnOffMutationEvent>(); }},
+      {"TurnOnMutationEvent", [] { return std::make_unique<TurnOnMutationEvent>(-1, 0.0); }},
+      {UpdateBetaRasterEvent::EVENT_NAME,
+       [] { return std::make_unique<UpdateBetaRasterEvent>("", -1); }},
+      {UpdateEcozoneEvent::EVENT_NAME,
+       [] { return std::make_unique<UpdateEcozoneEvent>(-1, -1, -1); }},
+  };
+  const auto it = FACTORIES.find(name);
+  if (it == FACTORIES.end()) {
+    throw std::runtime_error("Unknown population event in checkpoint: " + name);
+  }
+  return it->second();
+}
+}  // namespace
+
+void Scheduler::checkpoint(utils::CheckpointArchive &archive) {
+  archive & current_time_ & is_force_stop_ & calendar_date_;
+
+  // the pending population events, self-rescheduling ones included, replace the events built
+  // from the configuration when loading
+  auto &events = world_events_.get_events();
+  const auto number_of_events = archive.size(events.size());
+  if (archive.is_loading()) { world_events_.clear_all_events(); }
+  for (std::size_t i = 0; i < number_of_events; i++) {
+    std::string name;
+    auto time = 0;
+    auto executable = false;
+    if (!archive.is_loading()) {
+      const auto &event = events[i].second;
+      name = event->name();
+      time = event->get_time();
+      executable = event->is_executable();
+    }
+    archive & name & time & executable;
+
+    if (archive.is_loading()) {
+      auto event = create_world_event(name);
+      event->set_time(time);
+      event->checkpoint(archive);
+      auto* scheduled_event = event.get();
+      world_events_.schedule_event(std::move(event));
+      scheduled_event->set_executable(executable);
+    } else {
+      events[i].second->checkpoint(archive);
+    }
   }
 }
 
@@ -2,6 +2,7 @@
 #define SCHEDULER_H
 
 #include <memory>
+#include <string>
 
 #include "Core/Scheduler/EventManager.h"
 #include "Events/Event.h"
@@ -10,6 +11,10 @@
 
 class Model;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class Scheduler {
 public:
   // Disable copy and assignment
@@ -32,7 +37,7 @@ public:
   void extend_total_time(int new_total_time);
 
   // Event management methods
-  void clear_all_events() { world_events_.get_events().clear(); }
+  void clear_all_events() { world_events_.clear_all_events(); }
 
   virtual void schedule_population_event(std::unique_ptr<WorldEvent> event) {
     if (event != nullptr) { world_events_.schedule_event(std::move(event)); }
@@ -51,6 +56,13 @@ public:
   void end_time_step();
   void daily_update();
 
+  // Save a checkpoint to @path at the start of day @time, before any update of that day
+  void schedule_checkpoint(int time, const std::string &path);
+
+  // Save or restore the clock and the pending world events, the restored events replace the ones
+  // built from the configuration
+  void checkpoint(utils::CheckpointArchive &archive);
+
   // Time-related query methods
   [[nodiscard]] bool can_stop();
   [[nodiscard]] int get_current_day_in_year();
@@ -84,6 +96,8 @@ private:
   bool is_force_stop_{false};
   date::sys_days calendar_date_;
   EventManager<WorldEvent> world_events_;  // Use EventManager for world/population events
+  int checkpoint_time_{-1};
+  std::string checkpoint_path_;
 
 public:
 };
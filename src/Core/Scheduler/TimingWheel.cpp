@@ -0,0 +1,52 @@
+#include "TimingWheel.h"
+
+#include <bit>
+
+#include "Events/Event.h"
+
+TimingWheel::TimingWheel(std::size_t number_of_slots)
+    : slots_(std::bit_ceil(number_of_slots == 0 ? std::size_t{1} : number_of_slots), nullptr) {}
+
+TimingWheel::~TimingWheel() { clear(); }
+
+void TimingWheel::schedule(PersonEvent* event) {
+  if (event == nullptr) { return; }
+  unlink(event);
+
+  // push front, the order inside a slot does not matter
+  auto &head = slots_[slot_of(event->get_time())];
+  event->wheel_next_ = head;
+  event->wheel_prev_next_ = &head;
+  if (head != nullptr) { head->wheel_prev_next_ = &event->wheel_next_; }
+  head = event;
+}
+
+void TimingWheel::unlink(PersonEvent* event) {
+  if (event == nullptr || event->wheel_prev_next_ == nullptr) { return; }
+  *event->wheel_prev_next_ = event->wheel_next_;
+  if (event->wheel_next_ != nullptr) {
+    event->wheel_next_->wheel_prev_next_ = event->wheel_prev_next_;
+  }
+  event->wheel_next_ = nullptr;
+  event->wheel_prev_next_ = nullptr;
+}
+
+void TimingWheel::collect_due_persons(int time, std::vector<Person*> &persons) const {
+  for (auto* event = slots_[slot_of(time)]; event != nullptr; event = event->wheel_next_) {
+    if (event->get_time() <= time) { persons.push_back(event->get_person()); }
+  }
+}
+
+std::size_t TimingWheel::size() const {
+  std::size_t total = 0;
+  for (const auto* head : slots_) {
+    for (const auto* event = head; event != nullptr; event = event->wheel_next_) { total++; }
+  }
+  return total;
+}
+
+void TimingWheel::clear() {
+  for (auto &head : slots_) {
+    while (head != nullptr) { unlink(head); }
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <cstddef>
+#include <vector>
+
+class Person;
+class PersonEvent;
+
+/**
+ * Population-wide calendar of pending person events, bucketed by day.
+ *
+ * Events stay owned by the EventManager of their person; the wheel only links them through an
+ * intrusive hook in PersonEvent, so scheduling costs no allocation and an event unlinks itself
+ * when it is destroyed. Slot (time mod number_of_slots) holds the events of that day, events
+ * further away than one revolution simply stay in their slot until they are due.
+ */
+class TimingWheel {
+public:
+  // Disallow copy
+  TimingWheel(const TimingWheel &) = delete;
+  TimingWheel &operator=(const TimingWheel &) = delete;
+
+  // Disallow move, linked events point into slots_
+  TimingWheel(TimingWheel &&) = delete;
+  TimingWheel &operator=(TimingWheel &&) = delete;
+
+  // a bit more than a year so birthday events are visited only once
+  static constexpr std::size_t DEFAULT_NUMBER_OF_SLOTS = 512;
+
+  /**
+   * @param number_of_slots rounded up to the next power of two
+   */
+  explicit TimingWheel(std::size_t number_of_slots = DEFAULT_NUMBER_OF_SLOTS);
+
+  ~TimingWheel();
+
+  // Link the event into the slot of its time, relinks it if it was already in a wheel
+  void schedule(PersonEvent* event);
+
+  static void unlink(PersonEvent* event);
+
+  /**
+   * Append the person of every linked event due at or before @time found in the slot of @time.
+   * A person with several due events is appended several times.
+   */
+  void collect_due_persons(int time, std::vector<Person*> &persons) const;
+
+  [[nodiscard]] std::size_t number_of_slots() const { return slots_.size(); }
+
+  // Number of linked events, walks all slots (for tests and diagnostics)
+  [[nodiscard]] std::size_t size() const;
+
+  // Unlink all events
+  void clear();
+
+private:
+  [[nodiscard]] std::size_t slot_of(int time) const {
+    return static_cast<std::size_t>(time) & (slots_.size() - 1);
+  }
+
+  std::vector<PersonEvent*> slots_;
+};
+
+#endif  // TIMING_WHEEL_H
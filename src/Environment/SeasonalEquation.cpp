@@ -9,6 +9,7 @@
 #include <cstdint>
 
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Constants.h"
 
 SeasonalEquation::SeasonalEquation() = default;
@@ -73,3 +74,7 @@ void SeasonalEquation::update_seasonality(int from, int to) {
     }
   }
 }
+
+void SeasonalEquation::checkpoint(utils::CheckpointArchive &archive) {
+  archive & base_ & A_ & B_ & phi_;
+}
@@ -8,6 +8,10 @@
 
 #include "SeasonalInfo.h"
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class SeasonalEquation : public ISeasonalInfo {
 public:
   SeasonalEquation();
@@ -17,6 +21,9 @@ public:
   void set_seasonal_period(uint64_t index);
   void update_seasonality(int from, int to);
 
+  // Save or restore the equation of each location, changed by UpdateEcozoneEvent
+  void checkpoint(utils::CheckpointArchive &archive);
+
   [[nodiscard]] bool get_raster() const { return raster_; }
   void set_raster(bool value) { raster_ = value; }
 
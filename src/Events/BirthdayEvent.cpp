@@ -6,7 +6,7 @@
 #include "Population/Person/Person.h"
 #include "Simulation/Model.h"
 
-// OBJECTPOOL_IMPL(BirthdayEvent)
+OBJECTPOOL_IMPL(BirthdayEvent)
 
 void BirthdayEvent::do_execute() {
   // spdlog::info("Time: {}, BirthdayEvent::do_execute, person age: {}",
@@ -3,8 +3,8 @@
 
 #include <string>
 
-// #include "Core/ObjectPool.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Person;
 
@@ -21,11 +21,14 @@ public:
     explicit BirthdayEvent(Person* person) : PersonEvent(person) {}
     ~BirthdayEvent() override = default;
 
-    // OBJECTPOOL(BirthdayEvent)
+    OBJECTPOOL(BirthdayEvent)
 
     // DELETE_COPY_AND_MOVE(BirthdayEvent)
 
 public:
+    static constexpr EventTypeId TYPE_ID = EventTypeId::BIRTHDAY;
+    [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
     [[nodiscard]] const std::string name() const override { return "Birthday Event"; }
 
 private:
@@ -12,8 +12,9 @@
 #include "Population/Person/Person.h"
 #include "ReturnToResidenceEvent.h"
 #include "Population/Population.h"
+#include "Utils/CheckpointArchive.h"
 
-//OBJECTPOOL_IMPL(CirculateToTargetLocationNextDayEvent)
+OBJECTPOOL_IMPL(CirculateToTargetLocationNextDayEvent)
 
 void CirculateToTargetLocationNextDayEvent::do_execute() {
   // Get the person and perform the movement
@@ -48,3 +49,7 @@ void CirculateToTargetLocationNextDayEvent::do_execute() {
   
   person->schedule_return_to_residence_event(length_of_trip);
 }
+
+void CirculateToTargetLocationNextDayEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & target_location_;
+}
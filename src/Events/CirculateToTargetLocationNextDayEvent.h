@@ -6,14 +6,13 @@
 #ifndef CIRCULATETOTARGETLOCATIONNEXTDAYEVENT_H
 #define CIRCULATETOTARGETLOCATIONNEXTDAYEVENT_H
 
-// #include "Core/ObjectPool.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Person;
 class Scheduler;
 
 class CirculateToTargetLocationNextDayEvent : public PersonEvent {
-  //  OBJECTPOOL(CirculateToTargetLocationNextDayEvent)
 public:
   // disallow copy and move
   CirculateToTargetLocationNextDayEvent(const CirculateToTargetLocationNextDayEvent &) = delete;
@@ -26,9 +25,16 @@ public:
   explicit CirculateToTargetLocationNextDayEvent(Person* person) : PersonEvent(person) {}
   ~CirculateToTargetLocationNextDayEvent() override = default;
 
+  OBJECTPOOL(CirculateToTargetLocationNextDayEvent)
+
   [[nodiscard]] int target_location() const { return target_location_; }
   void set_target_location(int value) { target_location_ = value; }
 
+  static constexpr EventTypeId TYPE_ID = EventTypeId::CIRCULATE_TO_TARGET_LOCATION_NEXT_DAY;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override {
     return "CirculateToTargetLocationNextDayEvent";
   }
@@ -11,8 +11,20 @@
 #include "Population/ClonalParasitePopulation.h"
 #include "Population/ImmuneSystem/ImmuneSystem.h"
 #include "Population/Person/Person.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
-// OBJECTPOOL_IMPL(EndClinicalEvent)
+OBJECTPOOL_IMPL(EndClinicalEvent)
+
+ClonalParasitePopulation* EndClinicalEvent::clinical_caused_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(clinical_caused_parasite_);
+}
+
+void EndClinicalEvent::set_clinical_caused_parasite(ClonalParasitePopulation* value) {
+  clinical_caused_parasite_ =
+      value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
 
 void EndClinicalEvent::do_execute() {
   auto* person = get_person();
@@ -27,8 +39,12 @@ void EndClinicalEvent::do_execute() {
     person->get_immune_system()->set_increase(true);
     person->set_host_state(Person::ASYMPTOMATIC);
 
-    if (person->get_all_clonal_parasite_populations()->contain(clinical_caused_parasite_)) {
-      person->determine_symptomatic_recrudescence(clinical_caused_parasite_);
+    if (auto* parasite = clinical_caused_parasite(); parasite != nullptr) {
+      person->determine_symptomatic_recrudescence(parasite);
     }
   }
 }
+
+void EndClinicalEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & clinical_caused_parasite_;
+}
@@ -1,19 +1,17 @@
 #ifndef ENDCLINICALEVENT_H
 #define ENDCLINICALEVENT_H
 
-// #include "Core/ObjectPool.h"
 #include <cstddef>
 
 #include "Event.h"
-
-class ClonalParasitePopulation;
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
 
 class Scheduler;
 
 class Person;
 
 class EndClinicalEvent : public PersonEvent {
-  //  OBJECTPOOL(EndClinicalEvent)
 public:
   // disallow copy, assign and move
   EndClinicalEvent(const EndClinicalEvent &) = delete;
@@ -23,15 +21,21 @@ public:
   explicit EndClinicalEvent(Person* person) : PersonEvent(person) {}
   ~EndClinicalEvent() override = default;
 
-  ClonalParasitePopulation* clinical_caused_parasite() { return clinical_caused_parasite_; }
-  void set_clinical_caused_parasite(ClonalParasitePopulation* value) {
-    clinical_caused_parasite_ = value;
-  }
+  OBJECTPOOL(EndClinicalEvent)
+
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* clinical_caused_parasite();
+  void set_clinical_caused_parasite(ClonalParasitePopulation* value);
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::END_CLINICAL;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 
   [[nodiscard]] const std::string name() const override { return "EndClinicalEvent"; }
 
 private:
-  ClonalParasitePopulation* clinical_caused_parasite_{nullptr};
+  ClonalParasitePopulation::Handle clinical_caused_parasite_{ClonalParasitePopulation::NO_HANDLE};
   void do_execute() override;
 };
 
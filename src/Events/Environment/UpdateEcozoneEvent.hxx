@@ -12,6 +12,7 @@
 #include "Configuration/SeasonalitySettings.h"
 #include "Events/Event.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 
 class UpdateEcozoneEvent : public WorldEvent {
 private:
@@ -38,6 +39,8 @@ public:
   ~UpdateEcozoneEvent() override = default;
 
   [[nodiscard]] const std::string name() const override { return EVENT_NAME; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & from_ & to_; }
 };
 
 #endif
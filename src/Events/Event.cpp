@@ -4,6 +4,7 @@
 #include <spdlog/spdlog.h>
 
 #include <iostream>
+#include <stdexcept>
 
 #include "Simulation/Model.h"
 #include "Utils/Random.h"
@@ -17,4 +18,8 @@ void Event::execute() {
     }
     executable_ = false;
   }
-}
\ No newline at end of file
+}
+
+void WorldEvent::checkpoint(utils::CheckpointArchive &archive) {
+  throw std::runtime_error("Population event cannot be saved in a checkpoint: " + name());
+}
@@ -1,8 +1,32 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <cstdint>
 #include <string>
 
+#include "Core/Scheduler/TimingWheel.h"
+
+// Tag of the event classes looked up by type (has_event / cancel_all_events), lets the event
+// manager keep per-type counts instead of scanning with dynamic_cast
+enum class EventTypeId : std::uint8_t {
+  UNTAGGED = 0,
+  BIRTHDAY,
+  CIRCULATE_TO_TARGET_LOCATION_NEXT_DAY,
+  END_CLINICAL,
+  MATURE_GAMETOCYTE,
+  MOVE_PARASITE_TO_BLOOD,
+  PROGRESS_TO_CLINICAL,
+  RAPT,
+  RECEIVE_MDA_THERAPY,
+  RECEIVE_THERAPY,
+  REPORT_TREATMENT_FAILURE_DEATH,
+  RETURN_TO_RESIDENCE,
+  SWITCH_IMMUNE_COMPONENT,
+  TEST_TREATMENT_FAILURE,
+  UPDATE_WHEN_DRUG_IS_PRESENT,
+  NUMBER_OF_TYPES
+};
+
 class Event {
 public:
   // Disallow copy
@@ -20,6 +44,9 @@ public:
   void execute();  // Non-virtual public interface (Template Method)
   [[nodiscard]] virtual const std::string name() const = 0;
 
+  // Tagged subclasses override this and declare a matching static TYPE_ID
+  [[nodiscard]] virtual EventTypeId type_id() const { return EventTypeId::UNTAGGED; }
+
   // Public state management
   [[nodiscard]] bool is_executable() const { return executable_; }
   void set_executable(bool value) { executable_ = value; }
@@ -38,18 +65,40 @@ private:
 
 class Person;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class PersonEvent : public Event {
 public:
   explicit PersonEvent(Person* person) : person_(person) {}
+  // leave the population timing wheel, if linked
+  ~PersonEvent() override { TimingWheel::unlink(this); }
 
   [[nodiscard]] Person* get_person() const { return person_; }
   void set_person(Person* person) { person_ = person; }
 
+  [[nodiscard]] bool is_in_timing_wheel() const { return wheel_prev_next_ != nullptr; }
+
+  // Save or restore the payload of the event, the time and the executable flag are saved by the
+  // person. Events without a payload save nothing.
+  virtual void checkpoint(utils::CheckpointArchive &archive) {}
+
 private:
+  friend class TimingWheel;
+
   Person* person_;
+  // intrusive hook of TimingWheel: next event in the same slot and the pointer pointing at us
+  PersonEvent* wheel_next_{nullptr};
+  PersonEvent** wheel_prev_next_{nullptr};
 };
 
-class WorldEvent : public Event {};
+class WorldEvent : public Event {
+public:
+  // Save or restore the parameters of the event, the time and the executable flag are saved by the
+  // scheduler. Throws for events that can not be saved in a checkpoint.
+  virtual void checkpoint(utils::CheckpointArchive &archive);
+};
 
 #endif  // EVENT_H
 
@@ -6,8 +6,18 @@
 #include "Population/ClonalParasitePopulation.h"
 #include "Population/Person/Person.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
-// OBJECTPOOL_IMPL(MatureGametocyteEvent)
+OBJECTPOOL_IMPL(MatureGametocyteEvent)
+
+ClonalParasitePopulation* MatureGametocyteEvent::blood_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(blood_parasite_);
+}
+
+void MatureGametocyteEvent::set_blood_parasite(ClonalParasitePopulation* value) {
+  blood_parasite_ = value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
 
 void MatureGametocyteEvent::do_execute() {
   // spdlog::info("Mature gametocyte event executed {}", get_id());
@@ -15,8 +25,12 @@ void MatureGametocyteEvent::do_execute() {
   if (person == nullptr) {
     throw std::runtime_error("Person is nullptr");
   }
-  if (person->get_all_clonal_parasite_populations()->contain(blood_parasite_)) {
-    blood_parasite_->set_gametocyte_level(
-        Model::get_config()->get_epidemiological_parameters().get_gametocyte_level_full());
+  if (auto* parasite = blood_parasite(); parasite != nullptr) {
+    parasite->set_gametocyte_level(
+        Model::get_config()->hot_parameters().gametocyte_level_full);
   }
 }
+
+void MatureGametocyteEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & blood_parasite_;
+}
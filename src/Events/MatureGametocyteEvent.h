@@ -1,18 +1,16 @@
 #ifndef MATUREGAMETOCYTEEVENT_H
 #define MATUREGAMETOCYTEEVENT_H
 
-// #include "Core/ObjectPool.h"
 // #include "Core/PropertyMacro.h"
 #include "Event.h"
-
-class ClonalParasitePopulation;
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
 
 class Scheduler;
 
 class Person;
 
 class MatureGametocyteEvent : public PersonEvent {
-  // OBJECTPOOL(MatureGametocyteEvent)
 public:
   // disallow copy, assign and move
   MatureGametocyteEvent(const MatureGametocyteEvent &) = delete;
@@ -21,15 +19,23 @@ public:
   MatureGametocyteEvent& operator=(MatureGametocyteEvent &&) = delete;
   explicit MatureGametocyteEvent(Person* person) : PersonEvent(person) {}
 
-  ClonalParasitePopulation* blood_parasite() { return blood_parasite_; }
-  void set_blood_parasite(ClonalParasitePopulation* value) { blood_parasite_ = value; }
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* blood_parasite();
+  void set_blood_parasite(ClonalParasitePopulation* value);
 
   ~MatureGametocyteEvent() override = default;
 
+  OBJECTPOOL(MatureGametocyteEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::MATURE_GAMETOCYTE;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "MatureGametocyteEvent"; }
 
 private:
-  ClonalParasitePopulation* blood_parasite_{nullptr};
+  ClonalParasitePopulation::Handle blood_parasite_{ClonalParasitePopulation::NO_HANDLE};
 
   void do_execute() override;
 };
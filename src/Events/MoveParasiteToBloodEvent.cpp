@@ -11,8 +11,10 @@
 #include "Population/Person/Person.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Treatment/Therapies/Drug.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
-//OBJECTPOOL_IMPL(MoveParasiteToBloodEvent)
+OBJECTPOOL_IMPL(MoveParasiteToBloodEvent)
 
 void MoveParasiteToBloodEvent::do_execute() {
   auto* person = get_person();
@@ -34,9 +36,7 @@ void MoveParasiteToBloodEvent::do_execute() {
 
   new_parasite->set_last_update_log10_parasite_density(
       Model::get_random()->random_normal_truncated(
-          Model::get_config()->get_parasite_parameters().get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic(),
-          0.5));
+          Model::get_config()->hot_parameters().log_parasite_density_asymptomatic, 0.5));
 
   if (person->has_effective_drug_in_blood()) {
     // spdlog::info("Person has drug in blood");
@@ -47,7 +47,7 @@ void MoveParasiteToBloodEvent::do_execute() {
     // spdlog::info("Person does not have drug in blood");
     if (person->get_all_clonal_parasite_populations()->size() > 1) {
       // spdlog::info("person->get_all_clonal_parasite_populations()->size() > 1");
-      if (Model::get_config()->get_epidemiological_parameters().get_allow_new_coinfection_to_cause_symptoms()) {
+      if (Model::get_config()->hot_parameters().allow_new_coinfection_to_cause_symptoms) {
         person->determine_clinical_or_not(new_parasite);
       } else {
         new_parasite->set_update_function(
@@ -61,3 +61,7 @@ void MoveParasiteToBloodEvent::do_execute() {
 
   person->schedule_mature_gametocyte_event(new_parasite);
 }
+
+void MoveParasiteToBloodEvent::checkpoint(utils::CheckpointArchive &archive) {
+  Checkpoint::genotype(archive, infection_genotype_);
+}
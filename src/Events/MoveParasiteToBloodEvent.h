@@ -3,9 +3,9 @@
 
 #include <string>
 
-// #include "Core/ObjectPool.h"
 // #include "Core/PropertyMacro.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class ClonalParasitePopulation;
 
@@ -16,7 +16,6 @@ class Person;
 class Genotype;
 
 class MoveParasiteToBloodEvent : public PersonEvent {
-  //  OBJECTPOOL(MoveParasiteToBloodEvent)
 public:
   // Disallow copy
   MoveParasiteToBloodEvent(const MoveParasiteToBloodEvent&) = delete;
@@ -29,6 +28,13 @@ public:
   explicit MoveParasiteToBloodEvent(Person* person) : PersonEvent(person) {}
   ~MoveParasiteToBloodEvent() override = default;
 
+  OBJECTPOOL(MoveParasiteToBloodEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::MOVE_PARASITE_TO_BLOOD;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "MoveParasiteToBloodEvent"; }
   Genotype* infection_genotype() { return infection_genotype_; }
   void set_infection_genotype(Genotype* infection_genotype) {
@@ -15,6 +15,7 @@
 #include "Utils/Helpers/TimeHelpers.h"
 #include "Simulation/Model.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 class AnnualBetaUpdateEvent : public WorldEvent {
 private:
@@ -60,6 +61,8 @@ public:
 
   // Return the name of this event
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & rate_; }
 };
 
 #endif
@@ -16,6 +16,7 @@
 #include "Utils/Helpers/TimeHelpers.h"
 #include "Simulation/Model.h"
 #include "Treatment/ITreatmentCoverageModel.h"
+#include "Utils/CheckpointArchive.h"
 
 class AnnualCoverageUpdateEvent : public WorldEvent {
 private:
@@ -65,6 +66,8 @@ public:
 
   // Return the name of this event
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & rate_; }
 };
 
 #endif
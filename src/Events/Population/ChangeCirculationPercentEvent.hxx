@@ -9,7 +9,9 @@
 
 #include "Configuration/Config.h"
 #include "Events/Event.h"
+#include "Population/Population.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 
 class ChangeCirculationPercentEvent : public WorldEvent {
 private:
@@ -23,6 +25,9 @@ private:
     Model::get_config()->get_movement_settings().set_circulation_info(
         circulation_info);
 
+    // movement changed, the cached destination distributions are rebuilt
+    Model::get_population()->invalidate_destination_distributions();
+
     // Log on demand
     spdlog::debug(
         "Change circulation percent event: {} - {}",
@@ -41,6 +46,8 @@ public:
 
   // Return the name of this event
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & rate_; }
 };
 
 #endif
@@ -2,6 +2,7 @@
 
 #include "Configuration/Config.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeInterruptedFeedingRateEvent::ChangeInterruptedFeedingRateEvent(const int &location, const double &ifr, const int &at_time)
     : location{location},
@@ -13,4 +14,8 @@ void ChangeInterruptedFeedingRateEvent::do_execute() {
   Model::get_config()->location_db()[location].mosquito_ifr = ifr;
   spdlog::info("{}: Change interrupted feeding rate at location {} to {}",
     Model::get_scheduler()->get_current_date_string(), location,ifr);
-}
\ No newline at end of file
+}
+
+void ChangeInterruptedFeedingRateEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location & ifr;
+}
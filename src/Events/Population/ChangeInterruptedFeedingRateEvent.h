@@ -24,6 +24,8 @@ public:
         return "ChangeInterruptedFeedingRateEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
     int location{-1};
     double ifr{0.0};
 
@@ -1,7 +1,9 @@
 #include "ChangeMutationMaskEvent.h"
 
 #include "Configuration/Config.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeMutationMaskEvent::ChangeMutationMaskEvent(const std::string &mask, const int &at_time)
     : mask_{mask}{
@@ -10,6 +12,11 @@ ChangeMutationMaskEvent::ChangeMutationMaskEvent(const std::string &mask, const
 
 void ChangeMutationMaskEvent::do_execute() {
   Model::get_config()->get_genotype_parameters().set_mutation_mask(mask_);
+  Model::get_genotype_db()->clear_transition_tables();
   spdlog::info("{}: change mutation mask to {}",
     Model::get_scheduler()->get_current_date_string(), mask_);
-}
\ No newline at end of file
+}
+
+void ChangeMutationMaskEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & mask_;
+}
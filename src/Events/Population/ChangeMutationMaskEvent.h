@@ -27,6 +27,8 @@ public:
     return "ChangeMutationMaskEvent";
   }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 };
@@ -5,7 +5,9 @@
 #include "ChangeMutationProbabilityPerLocusEvent.h"
 
 #include "Configuration/Config.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeMutationProbabilityPerLocusEvent::ChangeMutationProbabilityPerLocusEvent(const double& value,
                                                                                const int& at_time)
@@ -14,6 +16,12 @@ ChangeMutationProbabilityPerLocusEvent::ChangeMutationProbabilityPerLocusEvent(c
 }
 void ChangeMutationProbabilityPerLocusEvent::do_execute() {
     Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(value);
+    Model::get_config()->rebuild_hot_parameters();
+    Model::get_genotype_db()->clear_transition_tables();
     spdlog::info("{}: Change mutation probability per locus to {}",
       Model::get_scheduler()->get_current_date_string(),value);
-}
\ No newline at end of file
+}
+
+void ChangeMutationProbabilityPerLocusEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & value;
+}
@@ -24,6 +24,8 @@ public:
         return "ChangeMutationProbabilityPerLocusEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
     double value{0.001};
 
 private:
@@ -4,6 +4,7 @@
 
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeTreatmentCoverageEvent::ChangeTreatmentCoverageEvent(
     std::unique_ptr<ITreatmentCoverageModel> tcm)
@@ -24,3 +25,10 @@ void ChangeTreatmentCoverageEvent::do_execute() {
   Model::get_instance()->set_treatment_coverage(std::move(treatment_coverage_model));
   set_executable(false);
 }
+
+void ChangeTreatmentCoverageEvent::checkpoint(utils::CheckpointArchive &archive) {
+  auto type = treatment_coverage_model->type;
+  archive & type;
+  if (archive.is_loading()) { treatment_coverage_model = ITreatmentCoverageModel::create(type); }
+  treatment_coverage_model->checkpoint(archive);
+}
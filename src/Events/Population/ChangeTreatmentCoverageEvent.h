@@ -20,6 +20,9 @@ public:
 
   [[nodiscard]] const std::string name() const override { return "ChangeTreatmentCoverageEvent"; }
 
+  // the model is replaced by one of the saved type when loading
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 };
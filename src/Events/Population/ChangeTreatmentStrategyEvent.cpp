@@ -5,6 +5,7 @@
 #include "Simulation/Model.h"
 #include "Treatment/Strategies/IStrategy.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeTreatmentStrategyEvent::ChangeTreatmentStrategyEvent(const int& strategy_id, const int& at_time)
     : strategy_id_(strategy_id) {
@@ -17,3 +18,7 @@ void ChangeTreatmentStrategyEvent::do_execute() {
                  Model::get_scheduler()->current_time(),
                  strategy_id_);
 }
+
+void ChangeTreatmentStrategyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & strategy_id_;
+}
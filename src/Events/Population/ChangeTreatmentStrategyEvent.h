@@ -22,6 +22,8 @@ public:
         return "ChangeTreatmentStrategyEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
     int strategy_id_;
     void do_execute() override;
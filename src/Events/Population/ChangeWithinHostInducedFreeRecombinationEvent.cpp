@@ -3,6 +3,7 @@
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 
 ChangeWithinHostInducedFreeRecombinationEvent::
     ChangeWithinHostInducedFreeRecombinationEvent(const bool &value,
@@ -17,3 +18,7 @@ void ChangeWithinHostInducedFreeRecombinationEvent::do_execute() {
   spdlog::info("{}: Change within host induced free recombination to {}",
                Model::get_scheduler()->get_current_date_string(), value);
 }
+
+void ChangeWithinHostInducedFreeRecombinationEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & value;
+}
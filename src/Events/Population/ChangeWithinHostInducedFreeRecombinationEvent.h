@@ -20,6 +20,8 @@ public:
         return "ChangeWithinHostInducedRecombinationEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
     bool value{true};
 
 private:
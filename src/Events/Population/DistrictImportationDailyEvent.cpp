@@ -7,6 +7,7 @@
 #include "Simulation/Model.h"
 #include "Population/Population.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/CheckpointArchive.h"
 
 DistrictImportationDailyEvent::DistrictImportationDailyEvent(
     int district, double dailyRate, int startDay, const std::vector<std::tuple<int,int,char>> &alleles)
@@ -83,12 +84,15 @@ void DistrictImportationDailyEvent::do_execute() {
 
       // Mutate all the clonal populations the individual is carrying
       for (auto& pp : *person->get_all_clonal_parasite_populations()) {
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype =
             old_genotype->modify_genotype_allele(alleles_, Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
 }
 
+void DistrictImportationDailyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & district_ & daily_rate_ & alleles_;
+}
@@ -30,6 +30,8 @@ public:
 
   const std::string name() const override { return "DistrictImportationDailyEvent"; }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 };
@@ -9,6 +9,7 @@
 #include "Population/Population.h"
 #include "Utils/Helpers/StringHelpers.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/CheckpointArchive.h"
 
 // OBJECTPOOL_IMPL(ImportationEvent)
 
@@ -57,3 +58,7 @@ void ImportationEvent::do_execute() {
             number_of_cases_,location_,
             Model::get_genotype_db()->at(genotype_id_)->get_aa_sequence());
 }
+
+void ImportationEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & genotype_id_ & number_of_cases_ & allele_distributions_;
+}
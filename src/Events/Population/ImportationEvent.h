@@ -43,6 +43,8 @@ public:
         return "ImportationEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
     void do_execute() override;
 };
@@ -7,6 +7,7 @@
 #include "Population/Population.h"
 #include "Simulation/Model.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/CheckpointArchive.h"
 // OBJECTPOOL_IMPL(ImportationPeriodicallyEvent)
 
 ImportationPeriodicallyEvent::ImportationPeriodicallyEvent(
@@ -104,3 +105,7 @@ void ImportationPeriodicallyEvent::do_execute() {
             ->get_aa_sequence());
   }
 }
+
+void ImportationPeriodicallyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & duration_ & genotype_id_ & number_of_cases_;
+}
@@ -57,6 +57,8 @@ public:
     return "ImportationPeriodicallyEvent";
   }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
  private:
   void do_execute() override;
 
@@ -16,6 +16,7 @@
 #include "Utils/Helpers/StringHelpers.h"
 #include "Utils/Index/PersonIndexAll.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/CheckpointArchive.h"
 
 void ImportationPeriodicallyRandomEvent::do_execute() {
   // Start by finding the number of infections to inflict
@@ -145,3 +146,7 @@ void ImportationPeriodicallyRandomEvent::infect(Person* person,
     person->schedule_progress_to_clinical_event(blood_parasite);
   }
 }
+
+void ImportationPeriodicallyRandomEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & count_ & genotypeId_ & log_parasite_density_;
+}
@@ -49,6 +49,8 @@ public:
 
   // Return the name of this event
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif
@@ -10,6 +10,7 @@
 
 #include "Parasites/Genotype.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 Introduce580YMutantEvent::Introduce580YMutantEvent(const int &location, const int &execute_at,
                                                    const double &fraction,
@@ -35,7 +36,7 @@ void Introduce580YMutantEvent::do_execute() {
     for (Person* p :  pi->vPerson()[0][Person::ASYMPTOMATIC][j]) {
       total_population_count += p->get_all_clonal_parasite_populations()->size();
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
-//        if (pp->genotype()->aa_structure()[2] == 1) {
+//        if (pp.genotype()->aa_structure()[2] == 1) {
 //          current_580Y_fraction++;
 //        }
       }
@@ -71,9 +72,9 @@ void Introduce580YMutantEvent::do_execute() {
 
       //mutate all clonal populations
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype = old_genotype->modify_genotype_allele(alleles_,Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
@@ -82,3 +83,7 @@ void Introduce580YMutantEvent::do_execute() {
               Model::get_scheduler()->get_current_date_string(),
               target_fraction);
 }
+
+void Introduce580YMutantEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & fraction_ & alleles_;
+}
@@ -35,6 +35,8 @@ public:
     return "580YImportationEvent";
   }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 
@@ -11,6 +11,7 @@
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 IntroduceAmodiaquineMutantEvent::IntroduceAmodiaquineMutantEvent(const int &location,
                                                const int &execute_at,
@@ -45,9 +46,9 @@ void IntroduceAmodiaquineMutantEvent::do_execute() {
       }
 
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype = old_genotype->modify_genotype_allele(alleles_,Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
@@ -55,3 +56,7 @@ void IntroduceAmodiaquineMutantEvent::do_execute() {
   spdlog::info("{} - Introduce Amodiaquine mutant event",
               Model::get_scheduler()->get_current_date_string());
 }
+
+void IntroduceAmodiaquineMutantEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & fraction_ & alleles_;
+}
@@ -46,6 +46,8 @@ public:
         return "IntroduceAmodiaquineMutantEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
     void do_execute() override;
 };
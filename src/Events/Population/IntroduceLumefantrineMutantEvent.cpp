@@ -9,6 +9,7 @@
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 IntroduceLumefantrineMutantEvent::IntroduceLumefantrineMutantEvent(
 const int &location, const int &execute_at,
@@ -46,9 +47,9 @@ void IntroduceLumefantrineMutantEvent::do_execute() {
       }
 
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype = old_genotype->modify_genotype_allele(alleles_,Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
@@ -56,3 +57,7 @@ void IntroduceLumefantrineMutantEvent::do_execute() {
   spdlog::info("{}: Introduce Lumefantrine mutant event",
               Model::get_scheduler()->get_current_date_string());
 }
+
+void IntroduceLumefantrineMutantEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & fraction_ & alleles_;
+}
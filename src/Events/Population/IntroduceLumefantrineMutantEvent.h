@@ -35,6 +35,8 @@ public:
 
   const std::string name() const override { return "IntroduceLumefantrineMutantEvent"; }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 };
@@ -61,6 +61,11 @@ public:
 
   // Return the name of this event
   [[nodiscard]] const std::string name() const override { return EVENT_NAME; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override {
+    IntroduceMutantEventBase::checkpoint(archive);
+    archive & admin_level_id_ & unit_id_;
+  }
 };
 
 #endif
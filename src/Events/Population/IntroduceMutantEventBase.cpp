@@ -26,7 +26,7 @@ double IntroduceMutantEventBase::calculate(std::vector<int> &locations) const {
           parasite_population_count +=
               person->get_all_clonal_parasite_populations()->size();
           for (auto &pp : *person->get_all_clonal_parasite_populations()) {
-              auto chromosome_strings = StringHelpers::split<char>(pp->genotype()->get_aa_sequence(),'|',false);
+              auto chromosome_strings = StringHelpers::split<char>(pp.genotype()->get_aa_sequence(),'|',false);
               // spdlog::info(StringHelpers::join(chromosome_strings,"#"));
             for (auto &allele_info : alleles_) {
               if (chromosome_strings[std::get<0>(allele_info)][std::get<1>(allele_info)] == std::get<2>(allele_info)) {
@@ -94,11 +94,11 @@ int IntroduceMutantEventBase::mutate(std::vector<int> &locations,
 
         // Mutate all the clonal populations the individual is carrying
         for (auto& pp : *person->get_all_clonal_parasite_populations()) {
-          auto* old_genotype = pp->genotype();
+          auto* old_genotype = pp.genotype();
           auto* new_genotype =
               old_genotype->modify_genotype_allele(alleles_, Model::get_config());
           spdlog::trace("location {} Introduce mutant new genotype: {}", location,new_genotype->get_aa_sequence());
-          pp->set_genotype(new_genotype);
+          pp.set_genotype(new_genotype);
         }
       }
     }
@@ -10,6 +10,7 @@
 
 // #include "Core/PropertyMacro.h"
 #include "Events/Event.h"
+#include "Utils/CheckpointArchive.h"
 
 class IntroduceMutantEventBase : public WorldEvent {
 protected:
@@ -22,6 +23,9 @@ protected:
 
   double calculate(std::vector<int> &locations) const;
   int mutate(std::vector<int> &locations, double target_fraction) const;
+
+public:
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & fraction_ & alleles_; }
 };
 
 #endif
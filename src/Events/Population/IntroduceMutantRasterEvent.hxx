@@ -55,6 +55,11 @@ public:
 
   // Return the name of this event
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override {
+    IntroduceMutantEventBase::checkpoint(archive);
+    archive & locations_;
+  }
 };
 
 #endif
@@ -8,6 +8,7 @@
 #include "Utils/Random.h"
 #include "MDC/ModelDataCollector.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/CheckpointArchive.h"
 
 // OBJECTPOOL_IMPL(IntroduceParasitesPeriodicallyEventV2)
 
@@ -104,4 +105,8 @@ void IntroduceParasitesPeriodicallyEventV2::do_execute() {
   spdlog::info("Day {}: Importing v2 {} at location {}",
                 Model::get_scheduler()->current_time(), number_of_importation_cases,
                 location_);
-}
\ No newline at end of file
+}
+
+void IntroduceParasitesPeriodicallyEventV2::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & duration_ & number_of_cases_ & allele_distributions & start_day & end_day;
+}
@@ -49,6 +49,8 @@ public:
         return "IntroduceParasitesPeriodicallyEventV2";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
     void do_execute() override;
 
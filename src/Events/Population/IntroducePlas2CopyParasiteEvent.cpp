@@ -9,6 +9,7 @@
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 IntroducePlas2CopyParasiteEvent::IntroducePlas2CopyParasiteEvent(
     const int& location, const int& execute_at, const double& fraction,
@@ -42,10 +43,10 @@ void IntroducePlas2CopyParasiteEvent::do_execute() {
       }
       // mutate all
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype = old_genotype->modify_genotype_allele({std::tuple(14,1,'2')},
           Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
@@ -54,3 +55,7 @@ void IntroducePlas2CopyParasiteEvent::do_execute() {
                Model::get_scheduler()->get_current_date_string(),
                fraction_);
 }
+
+void IntroducePlas2CopyParasiteEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & fraction_ & alleles_;
+}
@@ -49,4 +49,6 @@ public:
   [[nodiscard]] const std::string name() const override {
     return "IntroducePlas2CopyParasiteEvent";
   }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
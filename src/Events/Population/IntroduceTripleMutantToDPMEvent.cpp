@@ -7,6 +7,7 @@
 #include "Population/Population.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
+#include "Utils/CheckpointArchive.h"
 
 IntroduceTrippleMutantToDPMEvent::IntroduceTrippleMutantToDPMEvent(
     const int& location, const int& execute_at,
@@ -46,9 +47,9 @@ void IntroduceTrippleMutantToDPMEvent::do_execute() {
       //mutate all
       for (auto& pp : *p->get_all_clonal_parasite_populations()) {
         // TODO: rework on this
-        auto* old_genotype = pp->genotype();
+        auto* old_genotype = pp.genotype();
         auto* new_genotype = old_genotype->modify_genotype_allele(alleles_,Model::get_config());
-        pp->set_genotype(new_genotype);
+        pp.set_genotype(new_genotype);
       }
     }
   }
@@ -56,3 +57,7 @@ void IntroduceTrippleMutantToDPMEvent::do_execute() {
   spdlog::info("Day: {} - IntroduceTrippleMutantToDPMEvent at location {} with fraction {}",
               Model::get_scheduler()->current_time(), location_, fraction_);
 }
+
+void IntroduceTrippleMutantToDPMEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & location_ & fraction_ & alleles_;
+}
@@ -36,6 +36,8 @@ public:
     return "IntroduceTrippleMutantToDPMEvent";
   }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 
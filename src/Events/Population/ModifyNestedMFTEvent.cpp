@@ -7,6 +7,7 @@
 #include "Treatment/Strategies/NestedMFTMultiLocationStrategy.h"
 #include "Treatment/Strategies/NestedMFTStrategy.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 ModifyNestedMFTEvent::ModifyNestedMFTEvent(const int &at_time,
                                            const int &strategy_id)
@@ -39,3 +40,7 @@ void ModifyNestedMFTEvent::do_execute() {
                Model::get_scheduler()->get_current_date_string(),
                new_strategy->name);
 }
+
+void ModifyNestedMFTEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & strategy_id;
+}
@@ -24,6 +24,8 @@ public:
 
   const std::string name() const override { return "ChangeStrategyEvent"; }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
   void do_execute() override;
 };
@@ -10,6 +10,7 @@
 #include "Simulation/Model.h"
 #include "Treatment/Strategies/IStrategy.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 RotateStrategyEvent::RotateStrategyEvent(int at_time, int years,
                                          int new_strategy_id,
@@ -34,3 +35,7 @@ void RotateStrategyEvent::do_execute() {
                                                     new_strategy_id_);
   Model::get_scheduler()->schedule_population_event(std::move(event));
 }
+
+void RotateStrategyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & years_ & new_strategy_id_ & next_strategy_id_;
+}
@@ -27,6 +27,8 @@ public:
   ~RotateStrategyEvent() override = default;
 
   const std::string name() const override { return EventName; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Utils/Random.h"
 #include "date/date.h"
+#include "Utils/CheckpointArchive.h"
 
 SingleRoundMDAEvent::SingleRoundMDAEvent(const int& at_time) {
     set_time(at_time);
@@ -64,3 +65,7 @@ void SingleRoundMDAEvent::do_execute() {
     }
   }
 }
+
+void SingleRoundMDAEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & fraction_population_targeted & days_to_complete_all_treatments;
+}
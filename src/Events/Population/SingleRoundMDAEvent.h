@@ -68,4 +68,6 @@ public:
     [[nodiscard]] const std::string name() const override {
         return "SingleRoundMDAEvent";
     }
+
+    void checkpoint(utils::CheckpointArchive &archive) override;
 };
@@ -1,9 +1,11 @@
 #include "TurnOffMutationEvent.h"
 
 #include "Configuration/Config.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 TurnOffMutationEvent::TurnOffMutationEvent(const int &at_time) {
   set_time(at_time);
@@ -11,6 +13,11 @@ TurnOffMutationEvent::TurnOffMutationEvent(const int &at_time) {
 
 void TurnOffMutationEvent::do_execute() {
   Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(0.0);
+  Model::get_config()->rebuild_hot_parameters();
+  Model::get_genotype_db()->clear_transition_tables();
   spdlog::info("{}: turn mutation off",
     Model::get_scheduler()->get_current_date_string());
 }
+
+// no parameters
+void TurnOffMutationEvent::checkpoint(utils::CheckpointArchive &archive) {}
@@ -21,6 +21,8 @@ public:
         return "TurnOffMutationEvent";
     }
 
+    void checkpoint(utils::CheckpointArchive &archive) override;
+
 private:
     void do_execute() override;
 };
@@ -1,9 +1,11 @@
 #include "TurnOnMutationEvent.h"
 
 #include "Configuration/Config.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 TurnOnMutationEvent::TurnOnMutationEvent(const int& at_time, const double& mutation_probability)
     : mutation_probability(mutation_probability) {
@@ -12,7 +14,13 @@ TurnOnMutationEvent::TurnOnMutationEvent(const int& at_time, const double& mutat
 
 void TurnOnMutationEvent::do_execute() {
   Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(mutation_probability);
+  Model::get_config()->rebuild_hot_parameters();
+  Model::get_genotype_db()->clear_transition_tables();
     spdlog::info("{}: turn mutation on with probability {}",
         Model::get_scheduler()->get_current_date_string(),
         mutation_probability);
 }
+
+void TurnOnMutationEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & mutation_probability & drug_id;
+}
@@ -21,6 +21,8 @@ public:
     return "TurnOnMutationEvent";
   }
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   double mutation_probability{0.0};
   int drug_id{-1};
 
@@ -15,6 +15,7 @@
 #include "Events/Event.h"
 #include "Simulation/Model.h"
 #include "Spatial/GIS/AscFile.h"
+#include "Utils/CheckpointArchive.h"
 
 class UpdateBetaRasterEvent : public WorldEvent {
 private:
@@ -67,6 +68,8 @@ public:
   ~UpdateBetaRasterEvent() override = default;
 
   [[nodiscard]] const std::string name() const override { return "update_beta_raster_event"; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override { archive & filename_; }
 };
 
 #endif
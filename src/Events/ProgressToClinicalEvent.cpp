@@ -23,8 +23,19 @@
 #include "Treatment/Strategies/IStrategy.h"
 #include "Treatment/Strategies/NestedMFTStrategy.h"
 #include "Utils/Random.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
-// OBJECTPOOL_IMPL(ProgressToClinicalEvent)
+OBJECTPOOL_IMPL(ProgressToClinicalEvent)
+
+ClonalParasitePopulation* ProgressToClinicalEvent::clinical_caused_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(clinical_caused_parasite_);
+}
+
+void ProgressToClinicalEvent::set_clinical_caused_parasite(ClonalParasitePopulation* value) {
+  clinical_caused_parasite_ =
+      value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
 
 bool ProgressToClinicalEvent::should_receive_treatment(Person* person) {
   const double base_p = Model::get_treatment_coverage()->get_probability_to_be_treated(person->get_location(),
@@ -92,12 +103,12 @@ std::pair<Therapy*, bool> ProgressToClinicalEvent::determine_therapy(Person* per
 
 void ProgressToClinicalEvent::apply_therapy(Person* person, Therapy* therapy,
                                             bool is_public_sector) {
-  person->receive_therapy(therapy, clinical_caused_parasite_, false, is_public_sector);
+  auto* parasite = clinical_caused_parasite();
+  person->receive_therapy(therapy, parasite, false, is_public_sector);
 
-  clinical_caused_parasite_->set_update_function(
-      Model::get_instance()->having_drug_update_function());
+  parasite->set_update_function(Model::get_instance()->having_drug_update_function());
 
-  person->schedule_update_by_drug_event(clinical_caused_parasite_);
+  person->schedule_update_by_drug_event(parasite);
   // check if the person will progress to death despite of the treatment, this should be
   // 90% lower than the no treatment case
   if (person->will_progress_to_death_when_recieve_treatment()) {
@@ -122,14 +133,15 @@ void ProgressToClinicalEvent::do_execute() {
   }
 
   // if the clinical_caused_parasite eventually removed then do nothing
-  if (!person->get_all_clonal_parasite_populations()->contain(clinical_caused_parasite_)) {
+  auto* parasite = clinical_caused_parasite();
+  if (parasite == nullptr) {
     // spdlog::info("ProgressToClinicalEvent::do_execute: parasite removed");
     return;
   }
 
   if (person->get_host_state() == Person::CLINICAL) {
     // spdlog::info("ProgressToClinicalEvent::do_execute: Person is already Clinical");
-    clinical_caused_parasite_->set_update_function(
+    parasite->set_update_function(
         Model::get_instance()->immunity_clearance_update_function());
     return;
   }
@@ -138,17 +150,12 @@ void ProgressToClinicalEvent::do_execute() {
 }
 
 void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
-  const auto density =
-      Model::get_random()->random_uniform<double>(Model::get_config()
-                                                      ->get_parasite_parameters()
-                                                      .get_parasite_density_levels()
-                                                      .get_log_parasite_density_clinical_from(),
-                                                  Model::get_config()
-                                                      ->get_parasite_parameters()
-                                                      .get_parasite_density_levels()
-                                                      .get_log_parasite_density_clinical_to());
-
-  clinical_caused_parasite_->set_last_update_log10_parasite_density(density);
+  const auto &parameters = Model::get_config()->hot_parameters();
+  const auto density = Model::get_random()->random_uniform<double>(
+      parameters.log_parasite_density_clinical_from, parameters.log_parasite_density_clinical_to);
+
+  auto* parasite = clinical_caused_parasite();
+  parasite->set_last_update_log10_parasite_density(density);
 
   // Person change state to Clinical
   person->set_host_state(Person::CLINICAL);
@@ -174,8 +181,8 @@ void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
   count = 0;
   std::string event_time = "";
   for (const auto& pair : person->get_events()) {
-    if ( typeid(*pair.second).name() == typeid(ProgressToClinicalEvent).name()
-     && pair.second->is_executable()) {
+    if (pair.second->type_id() == ProgressToClinicalEvent::TYPE_ID
+        && pair.second->is_executable()) {
       event_time += std::to_string(pair.first) + " ";
       count++;
      }
@@ -189,7 +196,7 @@ void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
       Model::get_instance()->progress_to_clinical_update_function(),
       Model::get_instance()->immunity_clearance_update_function());
 
-  clinical_caused_parasite_->set_update_function(Model::get_instance()->clinical_update_function());
+  parasite->set_update_function(Model::get_instance()->clinical_update_function());
 
   // Statistic collect cumulative clinical episodes
   Model::get_mdc()->collect_1_clinical_episode(person->get_location(), person->get_age(),
@@ -224,8 +231,8 @@ void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
                                          person->get_age_class(), therapy->get_id());
 
     person->schedule_test_treatment_failure_event(
-        clinical_caused_parasite_,
-        Model::get_config()->get_therapy_parameters().get_tf_testing_day(), therapy->get_id());
+        parasite, Model::get_config()->get_therapy_parameters().get_tf_testing_day(),
+        therapy->get_id());
     apply_therapy(person, therapy, is_public_sector);
   } else {
     // not recieve treatment
@@ -235,7 +242,7 @@ void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
     handle_no_treatment(person);
   }
   // schedule end clinical event for both treatment and non-treatment cases
-  person->schedule_end_clinical_event(clinical_caused_parasite_);
+  person->schedule_end_clinical_event(parasite);
 }
 
 // TODO: remove this code
@@ -312,3 +319,7 @@ void ProgressToClinicalEvent::transition_to_clinical_state(Person* person) {
 //   //   p->set_host_state(Person::DEAD);
 //   // }
 // }
+
+void ProgressToClinicalEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & clinical_caused_parasite_;
+}
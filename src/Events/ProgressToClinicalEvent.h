@@ -2,19 +2,17 @@
 #define PROGRESSTOCLINICALEVENT_H
 
 #include "Event.h"
-// #include "Core/ObjectPool.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
 #include <string>
 
 class Person;
 
 class Scheduler;
 
-class ClonalParasitePopulation;
-
 class Therapy;
 
 class ProgressToClinicalEvent : public PersonEvent {
-  // OBJECTPOOL(ProgressToClinicalEvent)
 public:
   // Disallow copy
   ProgressToClinicalEvent(const ProgressToClinicalEvent&) = delete;
@@ -28,12 +26,18 @@ public:
 
   ~ProgressToClinicalEvent() override = default;
 
+  OBJECTPOOL(ProgressToClinicalEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::PROGRESS_TO_CLINICAL;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "ProgressToClinicalEvent"; }
 
-  ClonalParasitePopulation* clinical_caused_parasite() { return clinical_caused_parasite_; }
-  void set_clinical_caused_parasite(ClonalParasitePopulation* value) {
-    clinical_caused_parasite_ = value;
-  }
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* clinical_caused_parasite();
+  void set_clinical_caused_parasite(ClonalParasitePopulation* value);
 
   static bool should_receive_treatment(Person* person);
 
@@ -46,7 +50,7 @@ public:
   void apply_therapy(Person* person, Therapy* therapy, bool is_public_sector = true);
 
 private:
-  ClonalParasitePopulation* clinical_caused_parasite_{nullptr};
+  ClonalParasitePopulation::Handle clinical_caused_parasite_{ClonalParasitePopulation::NO_HANDLE};
   void do_execute() override;
 };
 
@@ -16,6 +16,8 @@
 #include "Population/Person/Person.h"
 #include "Simulation/Model.h"
 
+OBJECTPOOL_IMPL(RaptEvent)
+
 void RaptEvent::do_execute() {
   auto* person = get_person();
   if (person == nullptr) { throw std::runtime_error("Person is nullptr"); }
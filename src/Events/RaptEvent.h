@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Person;
 
@@ -14,6 +15,11 @@ public:
   explicit RaptEvent(Person* person) : PersonEvent(person) {}
   ~RaptEvent() override = default;
 
+  OBJECTPOOL(RaptEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::RAPT;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
   [[nodiscard]] const std::string name() const override { return "RAPT Event"; }
 
 private:
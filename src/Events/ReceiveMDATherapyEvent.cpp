@@ -8,6 +8,10 @@
 #include "Population/ClinicalUpdateFunction.h"
 #include "Population/ImmuneSystem/ImmunityClearanceUpdateFunction.h"
 #include "Treatment/ITreatmentCoverageModel.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
+
+OBJECTPOOL_IMPL(ReceiveMDATherapyEvent)
 
 void ReceiveMDATherapyEvent::do_execute() {
   auto* person = get_person();
@@ -28,3 +32,7 @@ void ReceiveMDATherapyEvent::do_execute() {
 
   person->schedule_update_by_drug_event(nullptr);
 }
+
+void ReceiveMDATherapyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  Checkpoint::therapy(archive, received_therapy_);
+}
@@ -5,6 +5,7 @@
 
 //#include "Core/PropertyMacro.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Scheduler;
 
@@ -32,6 +33,13 @@ public:
   //    ReceiveMDADrugEvent(const ReceiveMDADrugEvent& orig);
   virtual ~ReceiveMDATherapyEvent() = default;
 
+  OBJECTPOOL(ReceiveMDATherapyEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::RECEIVE_MDA_THERAPY;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   const std::string name() const override { return "ReceiveMDADrugEvent"; }
 
 private:
@@ -1,12 +1,33 @@
 #include "ReceiveTherapyEvent.h"
 
 #include "Population/Person/Person.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
+
+OBJECTPOOL_IMPL(ReceiveTherapyEvent)
+
+ClonalParasitePopulation* ReceiveTherapyEvent::clinical_caused_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(clinical_caused_parasite_);
+}
+
+void ReceiveTherapyEvent::set_clinical_caused_parasite(ClonalParasitePopulation* value) {
+  clinical_caused_parasite_ =
+      value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
 
 void ReceiveTherapyEvent::do_execute() {
   auto* person = get_person();
   if (person == nullptr) { throw std::runtime_error("Person is nullptr"); }
 
-  person->receive_therapy(received_therapy_, clinical_caused_parasite_, is_part_of_mac_therapy_);
+  auto* parasite = clinical_caused_parasite();
+  person->receive_therapy(received_therapy_, parasite, is_part_of_mac_therapy_);
+
+  person->schedule_update_by_drug_event(parasite);
+}
 
-  person->schedule_update_by_drug_event(clinical_caused_parasite_);
+void ReceiveTherapyEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & is_part_of_mac_therapy_;
+  Checkpoint::therapy(archive, received_therapy_);
+  archive & clinical_caused_parasite_;
 }
@@ -2,6 +2,7 @@
 #define RECEIVETHERAPYEVENT_H
 
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 #include "Population/ClonalParasitePopulation.h"
 
 class Scheduler;
@@ -10,8 +11,6 @@ class Person;
 
 class Therapy;
 
-class ClonalParasitePopulation;
-
 class ReceiveTherapyEvent : public PersonEvent {
 public:
   // disallow copy and assign and move
@@ -22,15 +21,21 @@ public:
   explicit ReceiveTherapyEvent(Person* person) : PersonEvent(person) {}
   ~ReceiveTherapyEvent() override = default;
 
+  OBJECTPOOL(ReceiveTherapyEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::RECEIVE_THERAPY;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "ReceiveTherapyEvent"; }
 
   Therapy* received_therapy() { return received_therapy_; }
   void set_received_therapy(Therapy* value) { received_therapy_ = value; }
 
-  ClonalParasitePopulation* clinical_caused_parasite() { return clinical_caused_parasite_; }
-  void set_clinical_caused_parasite(ClonalParasitePopulation* value) {
-    clinical_caused_parasite_ = value;
-  }
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* clinical_caused_parasite();
+  void set_clinical_caused_parasite(ClonalParasitePopulation* value);
 
   [[nodiscard]] bool is_part_of_mac_therapy() const { return is_part_of_mac_therapy_; }
   void set_is_part_of_mac_therapy(bool value) { is_part_of_mac_therapy_ = value; }
@@ -38,7 +43,7 @@ public:
 private:
   bool is_part_of_mac_therapy_{false};
   Therapy* received_therapy_{nullptr};
-  ClonalParasitePopulation* clinical_caused_parasite_{nullptr};
+  ClonalParasitePopulation::Handle clinical_caused_parasite_{ClonalParasitePopulation::NO_HANDLE};
   void do_execute() override;
 };
 
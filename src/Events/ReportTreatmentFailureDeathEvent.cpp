@@ -11,6 +11,9 @@
 #include "MDC/ModelDataCollector.h"
 #include "Simulation/Model.h"
 #include "Population/Person/Person.h"
+#include "Utils/CheckpointArchive.h"
+
+OBJECTPOOL_IMPL(ReportTreatmentFailureDeathEvent)
 
 void ReportTreatmentFailureDeathEvent::do_execute() {
   auto* person = get_person();
@@ -20,3 +23,7 @@ void ReportTreatmentFailureDeathEvent::do_execute() {
   Model::get_mdc()->record_1_treatment_failure_by_therapy(
       person->get_location(), person->get_age_class(), therapy_id());
 }
+
+void ReportTreatmentFailureDeathEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & age_class_ & location_id_ & therapy_id_;
+}
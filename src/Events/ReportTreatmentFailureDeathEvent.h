@@ -7,14 +7,13 @@
 #ifndef REPORTTREATMENTFAILUREDEATHEVENT_H
 #define REPORTTREATMENTFAILUREDEATHEVENT_H
 
-// #include "Core/ObjectPool.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Person;
 class Scheduler;
 
 class ReportTreatmentFailureDeathEvent : public PersonEvent {
-  // OBJECTPOOL(ReportTreatmentFailureDeathEvent)
 public:
   ReportTreatmentFailureDeathEvent &operator=(const ReportTreatmentFailureDeathEvent &) = delete;
   ReportTreatmentFailureDeathEvent &operator=(ReportTreatmentFailureDeathEvent &&) = delete;
@@ -26,6 +25,13 @@ public:
       : PersonEvent(person), age_class_(0), location_id_(0), therapy_id_(0) {}
   ~ReportTreatmentFailureDeathEvent() override = default;
 
+  OBJECTPOOL(ReportTreatmentFailureDeathEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::REPORT_TREATMENT_FAILURE_DEATH;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override {
     return "ReportTreatmentFailureDeathEvent";
   }
@@ -10,7 +10,7 @@
 #include "Population/Population.h"
 #include "Simulation/Model.h"
 
-// OBJECTPOOL_IMPL(ReturnToResidenceEvent)
+OBJECTPOOL_IMPL(ReturnToResidenceEvent)
 
 void ReturnToResidenceEvent::do_execute() {
   auto* person = get_person();
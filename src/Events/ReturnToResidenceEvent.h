@@ -1,14 +1,13 @@
 #ifndef RETURNTORESIDENCEEVENT_H
 #define RETURNTORESIDENCEEVENT_H
 
-// #include "Core/ObjectPool.h"
 #include "Event.h"
+#include "Utils/ObjectPool.h"
 
 class Person;
 class Scheduler;
 
 class ReturnToResidenceEvent : public PersonEvent {
-  //  OBJECTPOOL(ReturnToResidenceEvent)
 public:
   ReturnToResidenceEvent &operator=(const ReturnToResidenceEvent &) = delete;
   ReturnToResidenceEvent &operator=(ReturnToResidenceEvent &&) = delete;
@@ -19,6 +18,11 @@ public:
   explicit ReturnToResidenceEvent(Person* person) : PersonEvent(person) {}
   ~ReturnToResidenceEvent() override = default;
 
+  OBJECTPOOL(ReturnToResidenceEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::RETURN_TO_RESIDENCE;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
   [[nodiscard]] const std::string name() const override { return "ReturnToResidenceEvent"; }
 
 private:
@@ -7,7 +7,7 @@
 #include "Population/ImmuneSystem/NonInfantImmuneComponent.h"
 #include "Population/Person/Person.h"
 
-// OBJECTPOOL_IMPL(SwitchImmuneComponentEvent)
+OBJECTPOOL_IMPL(SwitchImmuneComponentEvent)
 
 SwitchImmuneComponentEvent::SwitchImmuneComponentEvent(Person* person) : PersonEvent(person) {
   if (person == nullptr) {
@@ -2,14 +2,13 @@
 #define SWITCH_IMMUNE_COMPONENT_EVENT_H
 
 #include "Event.h"
-// #include "Core/ObjectPool.h"
+#include "Utils/ObjectPool.h"
 
 class Scheduler;
 
 class Person;
 
 class SwitchImmuneComponentEvent : public PersonEvent {
-  // OBJECTPOOL(SwitchImmuneComponentEvent)
 public:
   SwitchImmuneComponentEvent(const SwitchImmuneComponentEvent &) = delete;
   SwitchImmuneComponentEvent(SwitchImmuneComponentEvent &&) = delete;
@@ -20,6 +19,11 @@ public:
 
   ~SwitchImmuneComponentEvent() override;
 
+  OBJECTPOOL(SwitchImmuneComponentEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::SWITCH_IMMUNE_COMPONENT;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
   [[nodiscard]] const std::string name() const override { return "SwitchImmuneComponentEvent"; }
 
 protected:
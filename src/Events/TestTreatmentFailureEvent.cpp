@@ -6,10 +6,22 @@
 #include "Simulation/Model.h"
 #include "Population/ClonalParasitePopulation.h"
 #include "Population/Person/Person.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
-//OBJECTPOOL_IMPL(TestTreatmentFailureEvent)
+OBJECTPOOL_IMPL(TestTreatmentFailureEvent)
 
 
+ClonalParasitePopulation* TestTreatmentFailureEvent::clinical_caused_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(clinical_caused_parasite_);
+}
+
+void TestTreatmentFailureEvent::set_clinical_caused_parasite(ClonalParasitePopulation* value) {
+  clinical_caused_parasite_ =
+      value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
+
 void TestTreatmentFailureEvent::do_execute() {
   auto* person = get_person();
   if (person == nullptr) {
@@ -18,9 +30,9 @@ void TestTreatmentFailureEvent::do_execute() {
 
   // If the parasite is still present at a detectable level, then it's a
   // treatment failure
-  if (person->get_all_clonal_parasite_populations()->contain(
-          clinical_caused_parasite())
-      && clinical_caused_parasite_->last_update_log10_parasite_density()
+  auto* parasite = clinical_caused_parasite();
+  if (parasite != nullptr
+      && parasite->last_update_log10_parasite_density()
              > Model::get_config()->get_parasite_parameters().get_parasite_density_levels().get_log_parasite_density_detectable()) {
     Model::get_mdc()->record_1_treatment_failure_by_therapy(
         person->get_location(), person->get_age_class(), therapy_id_);
@@ -29,3 +41,8 @@ void TestTreatmentFailureEvent::do_execute() {
         person->get_location(), person->get_age_class(), therapy_id_);
   }
 }
+
+void TestTreatmentFailureEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & therapy_id_;
+  archive & clinical_caused_parasite_;
+}
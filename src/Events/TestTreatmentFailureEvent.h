@@ -7,20 +7,18 @@
 #ifndef TESTTREATMENTFAILUREEVENT_H
 #define TESTTREATMENTFAILUREEVENT_H
 
-// #include "Core/ObjectPool.h"
 // #include "Core/PropertyMacro.h"
 #include <cstddef>
 
 #include "Event.h"
-
-class ClonalParasitePopulation;
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
 
 class Scheduler;
 
 class Person;
 
 class TestTreatmentFailureEvent : public PersonEvent {
-  //  OBJECTPOOL(TestTreatmentFailureEvent)
 public:
   // disallow copy, assign and move
   TestTreatmentFailureEvent(const TestTreatmentFailureEvent &) = delete;
@@ -31,18 +29,24 @@ public:
   explicit TestTreatmentFailureEvent(Person* person) : PersonEvent(person) {}
   ~TestTreatmentFailureEvent() override = default;
 
+  OBJECTPOOL(TestTreatmentFailureEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::TEST_TREATMENT_FAILURE;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "TestTreatmentFailureEvent"; }
 
-  ClonalParasitePopulation* clinical_caused_parasite() { return clinical_caused_parasite_; }
-  void set_clinical_caused_parasite(ClonalParasitePopulation* value) {
-    clinical_caused_parasite_ = value;
-  }
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* clinical_caused_parasite();
+  void set_clinical_caused_parasite(ClonalParasitePopulation* value);
   [[nodiscard]] int therapy_id() const { return therapy_id_; }
   void set_therapy_id(int value) { therapy_id_ = value; }
 
 private:
   int therapy_id_{0};
-  ClonalParasitePopulation* clinical_caused_parasite_{nullptr};
+  ClonalParasitePopulation::Handle clinical_caused_parasite_{ClonalParasitePopulation::NO_HANDLE};
   void do_execute() override;
 };
 
@@ -8,7 +8,18 @@
 #include "Configuration/Config.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/Drug.h"
-//OBJECTPOOL_IMPL(UpdateWhenDrugIsPresentEvent)
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
+OBJECTPOOL_IMPL(UpdateWhenDrugIsPresentEvent)
+
+ClonalParasitePopulation* UpdateWhenDrugIsPresentEvent::clinical_caused_parasite() {
+  return get_person()->get_all_clonal_parasite_populations()->find(clinical_caused_parasite_);
+}
+
+void UpdateWhenDrugIsPresentEvent::set_clinical_caused_parasite(ClonalParasitePopulation* value) {
+  clinical_caused_parasite_ =
+      value == nullptr ? ClonalParasitePopulation::NO_HANDLE : value->handle();
+}
 
 void UpdateWhenDrugIsPresentEvent::do_execute() {
   auto *person = get_person();
@@ -16,15 +27,16 @@ void UpdateWhenDrugIsPresentEvent::do_execute() {
     throw std::runtime_error("Person is nullptr");
   }
   if (person->drugs_in_blood()->size() > 0) {
-    if (person->get_all_clonal_parasite_populations()->contain(clinical_caused_parasite_) && person->get_host_state()==
+    auto* parasite = clinical_caused_parasite();
+    if (parasite != nullptr && person->get_host_state()==
         Person::CLINICAL) {
-      if (clinical_caused_parasite_->last_update_log10_parasite_density() <= Model::get_config()->get_parasite_parameters().
+      if (parasite->last_update_log10_parasite_density() <= Model::get_config()->get_parasite_parameters().
           get_parasite_density_levels().
           get_log_parasite_density_asymptomatic()) {
         person->set_host_state(Person::ASYMPTOMATIC);
       }
     }
-    person->schedule_update_by_drug_event(clinical_caused_parasite_);
+    person->schedule_update_by_drug_event(parasite);
   } else {
     for (auto i = 0; i < person->get_all_clonal_parasite_populations()->size(); i++) {
       auto* blood_parasite = person->get_all_clonal_parasite_populations()->at(i);
@@ -34,3 +46,7 @@ void UpdateWhenDrugIsPresentEvent::do_execute() {
     }
   }
 }
+
+void UpdateWhenDrugIsPresentEvent::checkpoint(utils::CheckpointArchive &archive) {
+  archive & clinical_caused_parasite_;
+}
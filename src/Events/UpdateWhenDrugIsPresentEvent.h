@@ -2,18 +2,16 @@
 #define UPDATEWHENDRUGISPRESENTEVENT_H
 
 #include "Event.h"
-// #include "Core/ObjectPool.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
 // #include "Core/PropertyMacro.h"
 #include <string>
 
-class ClonalParasitePopulation;
-
 class Scheduler;
 
 class Person;
 
 class UpdateWhenDrugIsPresentEvent : public PersonEvent {
-  // OBJECTPOOL(UpdateWhenDrugIsPresentEvent)
 public:
   // Disallow copy
   UpdateWhenDrugIsPresentEvent(const UpdateWhenDrugIsPresentEvent&) = delete;
@@ -27,15 +25,21 @@ public:
 
   ~UpdateWhenDrugIsPresentEvent() override = default;
 
+  OBJECTPOOL(UpdateWhenDrugIsPresentEvent)
+
+  static constexpr EventTypeId TYPE_ID = EventTypeId::UPDATE_WHEN_DRUG_IS_PRESENT;
+  [[nodiscard]] EventTypeId type_id() const override { return TYPE_ID; }
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   [[nodiscard]] const std::string name() const override { return "UpdateByHavingDrugEvent"; }
 
-  ClonalParasitePopulation* clinical_caused_parasite() { return clinical_caused_parasite_; }
-  void set_clinical_caused_parasite(ClonalParasitePopulation* value) {
-    clinical_caused_parasite_ = value;
-  }
+  // Looked up by handle in the person's parasites, nullptr once the clone has been cleared
+  ClonalParasitePopulation* clinical_caused_parasite();
+  void set_clinical_caused_parasite(ClonalParasitePopulation* value);
 
 private:
-  ClonalParasitePopulation* clinical_caused_parasite_{nullptr};
+  ClonalParasitePopulation::Handle clinical_caused_parasite_{ClonalParasitePopulation::NO_HANDLE};
 
   void do_execute() override;
 };
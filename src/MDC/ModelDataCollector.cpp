@@ -8,12 +8,14 @@
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Population/ClonalParasitePopulation.h"
 #include "Population/ImmuneSystem/ImmuneSystem.h"
 #include "Population/Person/Person.h"
 #include "Population/Population.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/SCTherapy.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Constants.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include <spdlog/spdlog.h>
@@ -251,6 +253,8 @@ void ModelDataCollector::initialize() {
     current_number_of_mutation_events_in_this_year_ = 0;
     mutation_tracker =
         std::vector<std::vector<MutationTrackerInfo>>(Model::get_config()->number_of_locations());
+    pending_mutation_tracker_ =
+        std::vector<std::vector<PendingMutationInfo>>(Model::get_config()->number_of_locations());
 
     mosquito_recombined_resistant_genotype_tracker =
         std::vector<std::vector<RecombinedResistantGenotypeInfo>>(
@@ -296,70 +300,68 @@ void ModelDataCollector::initialize() {
                    IntVector((ages_count>0)?ages_count:1, 0));
 }
 
+void ModelDataCollector::update_census() {
+  census_.collect(Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>(),
+                  Model::get_genotype_db()->size());
+}
+
 void ModelDataCollector::perform_population_statistic() {
   // this will do every time the reporter execute the report
   zero_population_statistics();
 
-  auto* pi = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+  // the reporters run right after and read the same census
+  update_census();
 
   for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+    popsize_residence_by_location_[loc] = census_.residents(loc);
+    total_immune_by_location_[loc] = census_.total_immune(loc);
+    blood_slide_prevalence_by_location_[loc] = census_.blood_slide_positive(loc);
+    total_parasite_population_by_location_[loc] = census_.number_of_clones(loc);
+
     for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
       for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
-        std::size_t size = pi->vPerson()[loc][hs][ac].size();
-        popsize_by_location_hoststate_[loc][hs] += static_cast<int>(size);
-        popsize_by_location_age_class_[loc][ac] += static_cast<int>(size);
-        popsize_by_location_hoststate_age_class_[loc][hs][ac] += static_cast<int>(size);
-
-        for (int i = 0; i < size; i++) {
-          Person* person = pi->vPerson()[loc][hs][ac][i];
-          popsize_residence_by_location_[person->get_residence_location()]++;
-
-          //                    assert(p->has_birthday_event());
-          //                    assert(p->get_age_class() == ac);
-          // this immune value will include maternal immunity value of the infants
-          double immune_value = person->get_immune_system()->get_latest_immune_value();
-          total_immune_by_location_[loc] += immune_value;
-          total_immune_by_location_age_class_[loc][ac] += immune_value;
-          int age = static_cast<int>(person->get_age());
-          int age_clamp = (age < 80) ? age : 79;
-          total_immune_by_location_age_[loc][age_clamp] += immune_value;
-          //                    popsize_by_location_age_class_[loc][ac] += 1;
-          int ac1 = (person->get_age() > 70) ? 14 : person->get_age() / 5;
-          popsize_by_location_age_class_by_5_[loc][ac1] += 1;
-          popsize_by_location_age_[loc][age_clamp] += 1;
-
-          if (hs == Person::ASYMPTOMATIC) {
-            number_of_positive_by_location_[loc]++;
-            number_of_positive_by_location_age_group_[loc][ac] += 1;
-
-            if (person->has_detectable_parasite()) {
-              blood_slide_prevalence_by_location_[loc] += 1;
-              blood_slide_number_by_location_age_group_[loc][ac] += 1;
-              blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
-              blood_slide_number_by_location_age_[loc][age_clamp] += 1;
-            }
-          } else if (hs == Person::CLINICAL) {
-            number_of_positive_by_location_[loc]++;
-            number_of_positive_by_location_age_group_[loc][ac] += 1;
-            blood_slide_prevalence_by_location_[loc] += 1;
-            blood_slide_number_by_location_age_group_[loc][ac] += 1;
-            blood_slide_number_by_location_age_group_by_5_[loc][ac1] += 1;
-            number_of_clinical_by_location_age_group_[loc][ac] += 1;
-            number_of_clinical_by_location_age_group_by_5_[loc][ac1] += 1;
-            blood_slide_number_by_location_age_[loc][age_clamp] += 1;
-          }
+        const auto size = census_.population(loc, hs, ac);
+        popsize_by_location_hoststate_[loc][hs] += size;
+        popsize_by_location_age_class_[loc][ac] += size;
+        popsize_by_location_hoststate_age_class_[loc][hs][ac] += size;
+      }
+    }
 
-          int moi = static_cast<int>(person->get_all_clonal_parasite_populations()->size());
-          if (moi > 0) {
-            total_parasite_population_by_location_[loc] += moi;
-            total_parasite_population_by_location_age_group_[loc][person->get_age_class()] += moi;
+    for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+      const auto positive = census_.population(loc, Person::ASYMPTOMATIC, ac)
+                            + census_.population(loc, Person::CLINICAL, ac);
+      number_of_positive_by_location_[loc] += positive;
+      number_of_positive_by_location_age_group_[loc][ac] = positive;
+      number_of_clinical_by_location_age_group_[loc][ac] =
+          census_.population(loc, Person::CLINICAL, ac);
+      total_immune_by_location_age_class_[loc][ac] = census_.total_immune_by_age_class(loc, ac);
+      blood_slide_number_by_location_age_group_[loc][ac] =
+          census_.blood_slide_positive_by_age_class(loc, ac);
+      total_parasite_population_by_location_age_group_[loc][ac] =
+          census_.number_of_clones_by_age_class(loc, ac);
+    }
 
-              if (moi <= NUMBER_OF_REPORTED_MOI) {
-                  multiple_of_infection_by_location_[loc][moi - 1]++;
-              }
-          }
-        }
-      }
+    // the 5-year groups are stored in vectors sized by the number of age classes
+    const auto number_of_age_groups_by_5 =
+        std::min(PopulationCensus::NUMBER_OF_AGE_GROUPS_BY_5,
+                 static_cast<int>(popsize_by_location_age_class_by_5_[loc].size()));
+    for (auto group = 0; group < number_of_age_groups_by_5; group++) {
+      popsize_by_location_age_class_by_5_[loc][group] =
+          census_.population_by_age_group_by_5(loc, group);
+      blood_slide_number_by_location_age_group_by_5_[loc][group] =
+          census_.blood_slide_positive_by_age_group_by_5(loc, group);
+      number_of_clinical_by_location_age_group_by_5_[loc][group] =
+          census_.clinical_by_age_group_by_5(loc, group);
+    }
+
+    for (auto age = 0; age < PopulationCensus::NUMBER_OF_AGES; age++) {
+      popsize_by_location_age_[loc][age] = census_.population_by_age(loc, age);
+      total_immune_by_location_age_[loc][age] = census_.total_immune_by_age(loc, age);
+      blood_slide_number_by_location_age_[loc][age] = census_.blood_slide_positive_by_age(loc, age);
+    }
+
+    for (auto moi = 1; moi <= NUMBER_OF_REPORTED_MOI; moi++) {
+      multiple_of_infection_by_location_[loc][moi - 1] = census_.multiple_of_infection(loc, moi);
     }
 
     fraction_of_positive_that_are_clinical_by_location_[loc] =
@@ -683,18 +685,33 @@ void ModelDataCollector::record_1_mutation(const int &location, Genotype* from,
   if (!recording_) { return; }
   cumulative_mutants_by_location_[location] += 1;
   monthly_number_of_mutation_events_by_location_[location] += 1;
+  std::lock_guard lock(mutation_mutex_);
   current_number_of_mutation_events_in_this_year_ += 1;
   current_number_of_mutation_events_ += 1;
 }
 
 void ModelDataCollector::record_1_mutation_by_drug(const int &location, Genotype* from,
                                                    Genotype* to, int drug_id) {
+  if (Model::get_genotype_db()->is_deferring_registration()) {
+    // ids of newly created genotypes are only known after the commit
+    pending_mutation_tracker_[location].emplace_back(from, to, drug_id);
+    return;
+  }
   auto mutation_tracker_info = std::make_tuple(location, Model::get_scheduler()->current_time(),
                                                Model::get_scheduler()->get_current_month_in_year(),
                                                drug_id, from->genotype_id(), to->genotype_id());
   mutation_tracker[location].push_back(mutation_tracker_info);
 }
 
+void ModelDataCollector::flush_pending_mutations_by_drug() {
+  for (auto location = 0; location < pending_mutation_tracker_.size(); location++) {
+    for (const auto &[from, to, drug_id] : pending_mutation_tracker_[location]) {
+      record_1_mutation_by_drug(location, from, to, drug_id);
+    }
+    pending_mutation_tracker_[location].clear();
+  }
+}
+
 void ModelDataCollector::record_1_treatment_failure_by_therapy(const int &location,
                                                                const int &age_class,
                                                                const int &therapy_id) {
@@ -1097,7 +1114,71 @@ void ModelDataCollector::record_1_person_seeking_treatment_by_location_age_index
   monthly_number_of_people_seeking_treatment_by_location_age_index_[location][idx] += 1;
 }
 
-
-
-
-
+void ModelDataCollector::checkpoint(utils::CheckpointArchive &archive) {
+  archive & total_immune_by_location_ & total_immune_by_location_age_class_
+      & total_immune_by_location_age_ & popsize_by_location_ & popsize_residence_by_location_
+      & popsize_by_location_age_class_ & popsize_by_location_age_class_by_5_
+      & popsize_by_location_hoststate_ & popsize_by_location_hoststate_age_class_
+      & blood_slide_prevalence_by_location_ & blood_slide_number_by_location_age_group_
+      & blood_slide_prevalence_by_location_age_group_
+      & blood_slide_number_by_location_age_group_by_5_
+      & blood_slide_prevalence_by_location_age_group_by_5_ & blood_slide_prevalence_by_location_age_
+      & blood_slide_number_by_location_age_ & fraction_of_positive_that_are_clinical_by_location_
+      & total_number_of_bites_by_location_ & total_number_of_bites_by_location_year_
+      & person_days_by_location_year_ & eir_by_location_year_ & eir_by_location_
+      & cumulative_clinical_episodes_by_location_ & cumulative_clinical_episodes_by_location_age_
+      & cumulative_clinical_episodes_by_location_age_group_
+      & average_number_biten_by_location_person_ & percentage_bites_on_top_20_by_location_
+      & cumulative_discounted_ntf_by_location_ & cumulative_ntf_by_location_
+      & cumulative_tf_by_location_ & cumulative_number_treatments_by_location_
+      & today_tf_by_location_ & today_number_of_treatments_by_location_ & today_ritf_by_location_
+      & total_number_of_treatments_60_by_location_ & total_ritf_60_by_location_
+      & total_tf_60_by_location_ & current_ritf_by_location_ & current_tf_by_location_
+      & cumulative_mutants_by_location_ & current_utl_duration_ & utl_duration_
+      & number_of_treatments_with_therapy_id_ & number_of_treatments_success_with_therapy_id_
+      & number_of_treatments_fail_with_therapy_id_ & amu_per_parasite_pop_ & amu_per_person_
+      & amu_for_clinical_caused_parasite_ & afu_ & discounted_amu_per_parasite_pop_
+      & discounted_amu_per_person_ & discounted_amu_for_clinical_caused_parasite_ & discounted_afu_
+      & multiple_of_infection_by_location_ & current_eir_by_location_
+      & last_update_total_number_of_bites_by_location_ & last_10_blood_slide_prevalence_by_location_
+      & last_10_blood_slide_prevalence_by_location_age_class_
+      & last_10_fraction_positive_that_are_clinical_by_location_
+      & last_10_fraction_positive_that_are_clinical_by_location_age_class_
+      & last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_
+      & total_parasite_population_by_location_ & number_of_positive_by_location_
+      & total_parasite_population_by_location_age_group_ & number_of_positive_by_location_age_group_
+      & number_of_clinical_by_location_age_group_ & number_of_clinical_by_location_age_group_by_5_
+      & number_of_death_by_location_age_group_ & number_of_untreated_cases_by_location_age_year_
+      & number_of_treatments_by_location_age_year_ & number_of_deaths_by_location_age_year_
+      & number_of_malaria_deaths_treated_by_location_age_year_
+      & number_of_malaria_deaths_non_treated_by_location_age_year_
+      & monthly_number_of_treatment_by_location_ & monthly_number_of_tf_by_location_
+      & monthly_number_of_new_infections_by_location_
+      & monthly_number_of_recrudescence_treatment_by_location_
+      & monthly_number_of_recrudescence_treatment_by_location_age_class_
+      & monthly_number_of_recrudescence_treatment_by_location_age_
+      & monthly_number_of_clinical_episode_by_location_
+      & monthly_number_of_clinical_episode_by_location_age_
+      & monthly_number_of_mutation_events_by_location_ & popsize_by_location_age_ & tf_at_15_
+      & single_resistance_frequency_at_15_ & double_resistance_frequency_at_15_
+      & triple_resistance_frequency_at_15_ & quadruple_resistance_frequency_at_15_
+      & quintuple_resistance_frequency_at_15_ & art_resistance_frequency_at_15_
+      & total_resistance_frequency_at_15_ & today_tf_by_therapy_
+      & today_number_of_treatments_by_therapy_ & current_tf_by_therapy_
+      & total_number_of_treatments_60_by_therapy_ & total_tf_60_by_therapy_ & mean_moi_
+      & number_of_mutation_events_by_year_ & current_number_of_mutation_events_in_this_year_
+      & mosquito_recombination_events_count_ & monthly_treatment_failure_by_location_
+      & monthly_nontreatment_by_location_ & monthly_number_of_treatment_by_location_age_class_
+      & monthly_number_of_clinical_episode_by_location_age_class_ & births_by_location_
+      & deaths_by_location_ & malaria_deaths_by_location_ & monthly_treatment_success_by_location_
+      & monthly_nontreatment_by_location_age_class_ & malaria_deaths_by_location_age_class_
+      & monthly_number_of_treatment_by_location_therapy_
+      & monthly_treatment_complete_by_location_therapy_
+      & monthly_treatment_failure_by_location_age_class_
+      & monthly_treatment_failure_by_location_therapy_
+      & monthly_treatment_success_by_location_age_class_
+      & monthly_treatment_success_by_location_therapy_ & current_number_of_mutation_events_
+      & recording_ & monthly_number_of_people_seeking_treatment_by_location_age_index_
+      & mutation_tracker & mosquito_recombined_resistant_genotype_tracker
+      & progress_to_clinical_in_7d_counter;
+}
@@ -8,6 +8,9 @@
 #ifndef MODELDATACOLLECTOR_H
 #define MODELDATACOLLECTOR_H
 
+#include <mutex>
+
+#include "PopulationCensus.h"
 #include "Utils/TypeDef.h"
 
 class Model;
@@ -20,6 +23,10 @@ class Therapy;
 
 class ClonalParasitePopulation;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class ModelDataCollector {
 private:
   DoubleVector total_immune_by_location_;
@@ -1005,6 +1012,15 @@ public:
   using MutationTrackerInfo = std::tuple<int, int, int, int, int, int>;
   std::vector<std::vector<MutationTrackerInfo>> mutation_tracker;
 
+private:
+  // (from, to, drug_id) per location, only used while genotype ids are not assigned yet
+  using PendingMutationInfo = std::tuple<Genotype*, Genotype*, int>;
+  std::vector<std::vector<PendingMutationInfo>> pending_mutation_tracker_;
+  // guards the population-wide mutation counters when individuals are updated in parallel
+  std::mutex mutation_mutex_;
+
+public:
+
   // typedef std::tuple<int, int, int, int, int, int, int, int, int, int, int>
   // recombined_resistant_genotype_info;
   // std::vector<std::vector<recombined_resistant_genotype_info>>
@@ -1028,8 +1044,17 @@ public:
 
   void initialize();
 
+  // Save or restore every counter, the pending mutations are empty between days
+  void checkpoint(utils::CheckpointArchive &archive);
+
   void perform_population_statistic();
 
+  // Walk the population once into the census, perform_population_statistic() does it before the
+  // monthly reports so the reporters only read census()
+  void update_census();
+
+  [[nodiscard]] const PopulationCensus &census() const { return census_; }
+
   void monthly_update();
 
   virtual void collect_number_of_bites(const int &location, const int &number_of_bites);
@@ -1063,6 +1088,10 @@ public:
 
   void record_1_mutation_by_drug(const int &location, Genotype* from, Genotype* to, int drug_id);
 
+  // Move the mutations recorded while genotype registration was deferred into mutation_tracker,
+  // must be called after GenotypeDatabase::commit_pending_genotypes
+  void flush_pending_mutations_by_drug();
+
   void begin_time_step();
 
   void end_of_time_step();
@@ -1279,6 +1308,7 @@ public:
 
 private:
   bool recording_ = false;
+  PopulationCensus census_;
   void update_average_number_bitten(const int &location, const int &birthday,
                                     const int &number_of_times_bitten);
 
@@ -0,0 +1,175 @@
+#include "PopulationCensus.h"
+
+#include <algorithm>
+
+#include "Parasites/Genotype.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/ImmuneSystem/ImmuneSystem.h"
+#include "Population/Person/Person.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+
+static_assert(Person::NUMBER_OF_STATE - 1 == 4, "the census indexes every state but the dead");
+
+void PopulationCensus::collect(PersonIndexByLocationStateAgeClass* index,
+                               std::size_t number_of_genotypes) {
+  const auto &persons = index->vPerson();
+  const auto number_of_locations = static_cast<int>(persons.size());
+  const auto number_of_age_classes =
+      number_of_locations == 0 ? 0 : static_cast<int>(persons[0][0].size());
+  reset(number_of_locations, number_of_age_classes, number_of_genotypes);
+
+  for (auto loc = 0; loc < number_of_locations; loc++) {
+    for (auto hs = 0; hs < NUMBER_OF_INDEXED_STATES; hs++) {
+      for (auto ac = 0; ac < number_of_age_classes; ac++) {
+        const auto &people = persons[loc][hs][ac];
+        const auto size = static_cast<int>(people.size());
+        population_[loc] += size;
+        population_by_state_age_class_[(((loc * NUMBER_OF_INDEXED_STATES) + hs)
+                                        * number_of_age_classes)
+                                       + ac] += size;
+
+        for (auto* person : people) {
+          residents_[person->get_residence_location()]++;
+
+          const auto immune_value = person->get_immune_system()->get_latest_immune_value();
+          const auto age = static_cast<int>(person->get_age());
+          const auto age_clamp = std::min(age, NUMBER_OF_AGES - 1);
+          const auto age_group_by_5 = std::min(age / 5, NUMBER_OF_AGE_GROUPS_BY_5 - 1);
+          total_immune_[loc] += immune_value;
+          total_immune_by_age_class_[(loc * number_of_age_classes) + ac] += immune_value;
+          total_immune_by_age_[(loc * NUMBER_OF_AGES) + age_clamp] += immune_value;
+          population_by_age_[(loc * NUMBER_OF_AGES) + age_clamp]++;
+          population_by_age_group_by_5_[(loc * NUMBER_OF_AGE_GROUPS_BY_5) + age_group_by_5]++;
+
+          const auto clinical = hs == Person::CLINICAL;
+          if (clinical || (hs == Person::ASYMPTOMATIC && person->has_detectable_parasite())) {
+            blood_slide_positive_[loc]++;
+            blood_slide_positive_by_age_class_[(loc * number_of_age_classes) + ac]++;
+            blood_slide_positive_by_age_group_by_5_[(loc * NUMBER_OF_AGE_GROUPS_BY_5)
+                                                    + age_group_by_5]++;
+            blood_slide_positive_by_age_[(loc * NUMBER_OF_AGES) + age_clamp]++;
+          }
+          if (clinical) {
+            clinical_by_age_group_by_5_[(loc * NUMBER_OF_AGE_GROUPS_BY_5) + age_group_by_5]++;
+          }
+
+          const auto &parasites = *person->get_all_clonal_parasite_populations();
+          const auto moi = static_cast<int>(parasites.size());
+          auto &histogram = multiple_of_infection_[loc];
+          if (moi >= static_cast<int>(histogram.size())) { histogram.resize(moi + 1, 0); }
+          histogram[moi]++;
+          if (moi == 0) { continue; }
+
+          infected_[loc]++;
+          number_of_clones_[loc] += moi;
+          number_of_clones_by_age_class_[(loc * number_of_age_classes) + ac] += moi;
+
+          for (const auto &parasite : parasites) {
+            const auto genotype_id = parasite.genotype()->genotype_id();
+            if (person_clones_[genotype_id]++ == 0) { person_genotypes_.push_back(genotype_id); }
+          }
+          const auto is_0_5 = age <= 5 ? 1 : 0;
+          const auto is_2_10 = (age >= 2 && age <= 10) ? 1 : 0;
+          for (const auto genotype_id : person_genotypes_) {
+            const auto count = person_clones_[genotype_id];
+            if (location_carriers_[genotype_id]++ == 0) {
+              location_genotypes_.push_back(genotype_id);
+            }
+            location_clones_[genotype_id] += count;
+            location_weighted_carriers_[genotype_id] += count / static_cast<double>(moi);
+            location_clones_0_5_[genotype_id] += count * is_0_5;
+            location_clones_2_10_[genotype_id] += count * is_2_10;
+            location_clinical_clones_[genotype_id] += clinical ? count : 0;
+            person_clones_[genotype_id] = 0;
+          }
+          person_genotypes_.clear();
+        }
+      }
+    }
+    flush_location_genotypes();
+    genotype_offsets_[loc + 1] = genotype_id_.size();
+  }
+}
+
+int PopulationCensus::population_by_host_state(int location, int host_state) const {
+  auto result = 0;
+  for (auto ac = 0; ac < number_of_age_classes_; ac++) {
+    result += population(location, host_state, ac);
+  }
+  return result;
+}
+
+int PopulationCensus::population_by_age_class(int location, int age_class) const {
+  auto result = 0;
+  for (auto hs = 0; hs < NUMBER_OF_INDEXED_STATES; hs++) {
+    result += population(location, hs, age_class);
+  }
+  return result;
+}
+
+void PopulationCensus::reset(int number_of_locations, int number_of_age_classes,
+                             std::size_t number_of_genotypes) {
+  number_of_locations_ = number_of_locations;
+  number_of_age_classes_ = number_of_age_classes;
+  const auto locations = static_cast<std::size_t>(number_of_locations);
+  const auto by_age_class = locations * number_of_age_classes;
+
+  population_.assign(locations, 0);
+  population_by_state_age_class_.assign(by_age_class * NUMBER_OF_INDEXED_STATES, 0);
+  population_by_age_.assign(locations * NUMBER_OF_AGES, 0);
+  population_by_age_group_by_5_.assign(locations * NUMBER_OF_AGE_GROUPS_BY_5, 0);
+  residents_.assign(locations, 0);
+  total_immune_.assign(locations, 0.0);
+  total_immune_by_age_class_.assign(by_age_class, 0.0);
+  total_immune_by_age_.assign(locations * NUMBER_OF_AGES, 0.0);
+  blood_slide_positive_.assign(locations, 0);
+  blood_slide_positive_by_age_class_.assign(by_age_class, 0);
+  blood_slide_positive_by_age_group_by_5_.assign(locations * NUMBER_OF_AGE_GROUPS_BY_5, 0);
+  blood_slide_positive_by_age_.assign(locations * NUMBER_OF_AGES, 0);
+  clinical_by_age_group_by_5_.assign(locations * NUMBER_OF_AGE_GROUPS_BY_5, 0);
+  infected_.assign(locations, 0);
+  number_of_clones_.assign(locations, 0);
+  number_of_clones_by_age_class_.assign(by_age_class, 0);
+  multiple_of_infection_.resize(locations);
+  for (auto &histogram : multiple_of_infection_) { histogram.clear(); }
+
+  genotype_offsets_.assign(locations + 1, 0);
+  genotype_id_.clear();
+  clones_.clear();
+  carriers_.clear();
+  weighted_carriers_.clear();
+  clones_0_5_.clear();
+  clones_2_10_.clear();
+  clinical_clones_.clear();
+
+  // the scratch is left zeroed by the previous census, only new genotypes are added
+  person_clones_.resize(number_of_genotypes, 0);
+  location_clones_.resize(number_of_genotypes, 0);
+  location_carriers_.resize(number_of_genotypes, 0);
+  location_weighted_carriers_.resize(number_of_genotypes, 0.0);
+  location_clones_0_5_.resize(number_of_genotypes, 0);
+  location_clones_2_10_.resize(number_of_genotypes, 0);
+  location_clinical_clones_.resize(number_of_genotypes, 0);
+}
+
+void PopulationCensus::flush_location_genotypes() {
+  std::sort(location_genotypes_.begin(), location_genotypes_.end());
+  for (const auto genotype_id : location_genotypes_) {
+    genotype_id_.push_back(genotype_id);
+    clones_.push_back(location_clones_[genotype_id]);
+    carriers_.push_back(location_carriers_[genotype_id]);
+    weighted_carriers_.push_back(location_weighted_carriers_[genotype_id]);
+    clones_0_5_.push_back(location_clones_0_5_[genotype_id]);
+    clones_2_10_.push_back(location_clones_2_10_[genotype_id]);
+    clinical_clones_.push_back(location_clinical_clones_[genotype_id]);
+
+    location_clones_[genotype_id] = 0;
+    location_carriers_[genotype_id] = 0;
+    location_weighted_carriers_[genotype_id] = 0.0;
+    location_clones_0_5_[genotype_id] = 0;
+    location_clones_2_10_[genotype_id] = 0;
+    location_clinical_clones_[genotype_id] = 0;
+  }
+  location_genotypes_.clear();
+}
@@ -0,0 +1,170 @@
+#ifndef POPULATIONCENSUS_H
+#define POPULATIONCENSUS_H
+
+#include <cstddef>
+#include <vector>
+
+class PersonIndexByLocationStateAgeClass;
+
+/**
+ * @class PopulationCensus
+ * @brief Per-location aggregate of the population filled by a single pass over the persons.
+ *
+ * ModelDataCollector, the SQLite reporters and ReporterUtils used to walk the
+ * PersonIndexByLocationStateAgeClass index each on their own, the SQLite reporters once per admin
+ * level, to count the same persons, clones and genotypes. The census visits every person once
+ * and keeps what these consumers read in flat columns indexed by location: counts by host state
+ * and age class, by age and by 5-year age group, immunity sums, blood slide positives, clones
+ * and the multiplicity of infection. The genotypes carried in a location are kept sparse, sorted
+ * by genotype id, since a location only carries a few of the genotypes of the database.
+ */
+class PopulationCensus {
+public:
+  // ages above are counted in the last one, as ModelDataCollector does
+  static constexpr int NUMBER_OF_AGES = 80;
+  // 0-4, 5-9, ..., 65-69 and 70+
+  static constexpr int NUMBER_OF_AGE_GROUPS_BY_5 = 15;
+
+  // Walk @index once and replace the aggregate, @number_of_genotypes is the size of the
+  // genotype database
+  void collect(PersonIndexByLocationStateAgeClass* index, std::size_t number_of_genotypes);
+
+  [[nodiscard]] int number_of_locations() const { return number_of_locations_; }
+  [[nodiscard]] int number_of_age_classes() const { return number_of_age_classes_; }
+
+  // persons present in @location, excluding the dead
+  [[nodiscard]] int population(int location) const { return population_[location]; }
+  [[nodiscard]] int population(int location, int host_state, int age_class) const {
+    return population_by_state_age_class_[(((location * NUMBER_OF_INDEXED_STATES) + host_state)
+                                           * number_of_age_classes_)
+                                          + age_class];
+  }
+  [[nodiscard]] int population_by_host_state(int location, int host_state) const;
+  [[nodiscard]] int population_by_age_class(int location, int age_class) const;
+  [[nodiscard]] int population_by_age(int location, int age) const {
+    return population_by_age_[(location * NUMBER_OF_AGES) + age];
+  }
+  [[nodiscard]] int population_by_age_group_by_5(int location, int age_group) const {
+    return population_by_age_group_by_5_[(location * NUMBER_OF_AGE_GROUPS_BY_5) + age_group];
+  }
+  // persons whose residence is @location, wherever they are
+  [[nodiscard]] int residents(int location) const { return residents_[location]; }
+
+  // sum of the latest immune values, including the maternal immunity of the infants
+  [[nodiscard]] double total_immune(int location) const { return total_immune_[location]; }
+  [[nodiscard]] double total_immune_by_age_class(int location, int age_class) const {
+    return total_immune_by_age_class_[(location * number_of_age_classes_) + age_class];
+  }
+  [[nodiscard]] double total_immune_by_age(int location, int age) const {
+    return total_immune_by_age_[(location * NUMBER_OF_AGES) + age];
+  }
+
+  // clinical persons and asymptomatic persons with a detectable parasite density
+  [[nodiscard]] int blood_slide_positive(int location) const {
+    return blood_slide_positive_[location];
+  }
+  [[nodiscard]] int blood_slide_positive_by_age_class(int location, int age_class) const {
+    return blood_slide_positive_by_age_class_[(location * number_of_age_classes_) + age_class];
+  }
+  [[nodiscard]] int blood_slide_positive_by_age_group_by_5(int location, int age_group) const {
+    return blood_slide_positive_by_age_group_by_5_[(location * NUMBER_OF_AGE_GROUPS_BY_5)
+                                                   + age_group];
+  }
+  [[nodiscard]] int blood_slide_positive_by_age(int location, int age) const {
+    return blood_slide_positive_by_age_[(location * NUMBER_OF_AGES) + age];
+  }
+  [[nodiscard]] int clinical_by_age_group_by_5(int location, int age_group) const {
+    return clinical_by_age_group_by_5_[(location * NUMBER_OF_AGE_GROUPS_BY_5) + age_group];
+  }
+
+  // persons carrying at least one clone
+  [[nodiscard]] int infected(int location) const { return infected_[location]; }
+  [[nodiscard]] int number_of_clones(int location) const { return number_of_clones_[location]; }
+  // clones by the age class the person is indexed under
+  [[nodiscard]] int number_of_clones_by_age_class(int location, int age_class) const {
+    return number_of_clones_by_age_class_[(location * number_of_age_classes_) + age_class];
+  }
+  // persons carrying @moi clones, the uninfected persons for 0
+  [[nodiscard]] int multiple_of_infection(int location, int moi) const {
+    const auto &histogram = multiple_of_infection_[location];
+    return moi < static_cast<int>(histogram.size()) ? histogram[moi] : 0;
+  }
+  // one more than the highest multiplicity of infection in @location
+  [[nodiscard]] int number_of_moi(int location) const {
+    return static_cast<int>(multiple_of_infection_[location].size());
+  }
+
+  // Genotypes carried in @location are the entries [genotype_begin, genotype_end)
+  [[nodiscard]] std::size_t genotype_begin(int location) const {
+    return genotype_offsets_[location];
+  }
+  [[nodiscard]] std::size_t genotype_end(int location) const {
+    return genotype_offsets_[location + 1];
+  }
+  [[nodiscard]] int genotype_id(std::size_t entry) const { return genotype_id_[entry]; }
+  // clones of the genotype
+  [[nodiscard]] int clones(std::size_t entry) const { return clones_[entry]; }
+  // persons carrying the genotype
+  [[nodiscard]] int carriers(std::size_t entry) const { return carriers_[entry]; }
+  // persons carrying the genotype weighted by the fraction of their clones of the genotype
+  [[nodiscard]] double weighted_carriers(std::size_t entry) const {
+    return weighted_carriers_[entry];
+  }
+  // clones of the genotype carried by persons aged 0-5, 2-10 and by clinical persons
+  [[nodiscard]] int clones_0_5(std::size_t entry) const { return clones_0_5_[entry]; }
+  [[nodiscard]] int clones_2_10(std::size_t entry) const { return clones_2_10_[entry]; }
+  [[nodiscard]] int clinical_clones(std::size_t entry) const { return clinical_clones_[entry]; }
+
+private:
+  // the index leaves the dead out
+  static constexpr int NUMBER_OF_INDEXED_STATES = 4;
+
+  void reset(int number_of_locations, int number_of_age_classes,
+             std::size_t number_of_genotypes);
+  void flush_location_genotypes();
+
+  int number_of_locations_{0};
+  int number_of_age_classes_{0};
+
+  std::vector<int> population_;
+  std::vector<int> population_by_state_age_class_;
+  std::vector<int> population_by_age_;
+  std::vector<int> population_by_age_group_by_5_;
+  std::vector<int> residents_;
+  std::vector<double> total_immune_;
+  std::vector<double> total_immune_by_age_class_;
+  std::vector<double> total_immune_by_age_;
+  std::vector<int> blood_slide_positive_;
+  std::vector<int> blood_slide_positive_by_age_class_;
+  std::vector<int> blood_slide_positive_by_age_group_by_5_;
+  std::vector<int> blood_slide_positive_by_age_;
+  std::vector<int> clinical_by_age_group_by_5_;
+  std::vector<int> infected_;
+  std::vector<int> number_of_clones_;
+  std::vector<int> number_of_clones_by_age_class_;
+  // by location then multiplicity of infection, grown to the highest one
+  std::vector<std::vector<int>> multiple_of_infection_;
+
+  std::vector<std::size_t> genotype_offsets_;
+  std::vector<int> genotype_id_;
+  std::vector<int> clones_;
+  std::vector<int> carriers_;
+  std::vector<double> weighted_carriers_;
+  std::vector<int> clones_0_5_;
+  std::vector<int> clones_2_10_;
+  std::vector<int> clinical_clones_;
+
+  // dense scratch by genotype id, zero between persons and between locations, with the ids
+  // touched since
+  std::vector<int> person_clones_;
+  std::vector<int> person_genotypes_;
+  std::vector<int> location_clones_;
+  std::vector<int> location_carriers_;
+  std::vector<double> location_weighted_carriers_;
+  std::vector<int> location_clones_0_5_;
+  std::vector<int> location_clones_2_10_;
+  std::vector<int> location_clinical_clones_;
+  std::vector<int> location_genotypes_;
+};
+
+#endif  // POPULATIONCENSUS_H
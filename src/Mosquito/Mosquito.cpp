@@ -8,7 +8,9 @@
 #include "Parasites/Genotype.h"
 #include "Population/Population.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Checkpoint.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Random.h"
 #include "Utils/TypeDef.h"
 
@@ -25,7 +27,7 @@ void Mosquito::initialize(Config* config) {
 
   auto &location_db = config->location_db();
   for (auto loc_index = 0; loc_index < location_db.size(); ++loc_index) {
-    if (Model::get_population()->all_alive_persons_by_location()[loc_index].empty()) continue;
+    if (Model::get_population()->number_of_alive_persons(loc_index) == 0) continue;
     for (auto day = 0; day < config->number_of_tracking_days(); ++day) {
       genotypes_table[day][loc_index] =
           std::vector<Genotype*>(location_db[loc_index].mosquito_size, nullptr);
@@ -38,7 +40,7 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
   auto &location_db = config->location_db();
   // for each location fill prmc at tracking_index row with sampling genotypes
   for (int loc = 0; loc < config->number_of_locations(); loc++) {
-    if (!Model::get_population()->all_alive_persons_by_location()[loc].empty()) {
+    if (population->number_of_alive_persons(loc) != 0) {
       // spdlog::info("tracking_index {} Location {} has {} alive persons", tracking_index,loc,
       //   Model::get_population()->all_alive_persons_by_location[loc].size());
     } else {
@@ -56,18 +58,15 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
       return;
     }
     // multinomial sampling of people based on their relative infectivity (summing across all clones inside that person)
-    auto first_sampling = random->roulette_sampling<Person>(location_db[loc].mosquito_size,
-                                                            population->individual_foi_by_location()[loc],
-                                                            population->all_alive_persons_by_location()[loc], false,
-                                                            population->current_force_of_infection_by_location()[loc]);
+    auto first_sampling = population->sample_alive_persons(
+        random, PersonStore::FORCE_OF_INFECTION, loc, location_db[loc].mosquito_size, false);
 
     std::vector<unsigned int> interrupted_feeding_indices = build_interrupted_feeding_indices(
         random, location_db[loc].mosquito_ifr, location_db[loc].mosquito_size);
 
     // uniform sampling in all person
-    auto second_sampling = random->roulette_sampling<Person>(location_db[loc].mosquito_size,
-                                                             population->individual_relative_biting_by_location()[loc],
-                                                             population->all_alive_persons_by_location()[loc], true);
+    auto second_sampling = population->sample_alive_persons(
+        random, PersonStore::RELATIVE_BITING, loc, location_db[loc].mosquito_size, true);
 
     // recombination
     // *p1 , *p2, bool is_interrupted  ===> *genotype
@@ -178,7 +177,7 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
       auto parent_genotypes = random->roulette_sampling<Genotype>(2, relative_infectivity_each_pp, sampled_genotypes, false);
 
       Genotype *sampled_genotype =
-          (parent_genotypes[0]->aa_sequence == parent_genotypes[1]->aa_sequence)
+          (parent_genotypes[0] == parent_genotypes[1])
               ? parent_genotypes[0]
               : Genotype::free_recombine(config, random, parent_genotypes[0], parent_genotypes[1]);
 
@@ -233,16 +232,24 @@ int Mosquito::random_genotype(int location, int tracking_index) {
   return genotypes_table[tracking_index][location][genotype_index]->genotype_id();
 }
 
+int Mosquito::random_genotype(int location, int tracking_index, double uniform_draw) {
+  const auto mosquito_size = Model::get_config()->location_db()[location].mosquito_size;
+  const auto genotype_index =
+      std::min(static_cast<int>(uniform_draw * mosquito_size), mosquito_size - 1);
+  if (genotypes_table[tracking_index][location][genotype_index] == nullptr) return -1;
+  return genotypes_table[tracking_index][location][genotype_index]->genotype_id();
+}
+
 void Mosquito::get_genotypes_profile_from_person(
     Person* person, std::vector<Genotype*> &sampling_genotypes,
     std::vector<double> &relative_infectivity_each_pp) {
   for (auto &pp : *person->get_all_clonal_parasite_populations()) {
     // Select parasites based on gametocyte density
-    auto clonal_foi = pp->gametocyte_level()
-                      * Person::relative_infectivity(pp->last_update_log10_parasite_density());
+    auto clonal_foi = pp.gametocyte_level()
+                      * Person::relative_infectivity(pp.last_update_log10_parasite_density());
     if (clonal_foi > 0) {
       relative_infectivity_each_pp.push_back(clonal_foi);
-      sampling_genotypes.push_back(pp->genotype());
+      sampling_genotypes.push_back(pp.genotype());
     }
   }
 }
@@ -271,3 +278,11 @@ std::string Mosquito::get_old_genotype_string2(std::string new_genotype) {
   return old_chr_7[0] + old_chr_5 + old_chr_13[10] + old_chr_14;
 }
 
+void Mosquito::checkpoint(utils::CheckpointArchive &archive) {
+  for (auto &by_location : genotypes_table) {
+    for (auto &genotypes : by_location) {
+      genotypes.resize(archive.size(genotypes.size()));
+      for (auto* &genotype : genotypes) { Checkpoint::genotype(archive, genotype); }
+    }
+  }
+}
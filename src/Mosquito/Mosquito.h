@@ -9,6 +9,10 @@ class Model;
 class Config;
 class Population;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 typedef std::pair<std::vector<std::pair<int,std::string>>,std::pair<int,int>> MosquitoRecombinedGenotypeInfo;
 class Mosquito {
 public:
@@ -36,6 +40,9 @@ public:
 
   void infect_new_cohort_in_PRMC(Config *config, utils::Random *random, Population *population, const int &tracking_index);
 
+  // Save or restore the genotypes of the mosquito table as genotype ids
+  void checkpoint(utils::CheckpointArchive &archive);
+
 public:
   std::vector<std::vector<std::vector<Genotype *>>> genotypes_table; /* Mosquito table */
 
@@ -44,6 +51,10 @@ public:
 
   int random_genotype(int location, int tracking_index);
 
+  // Same as random_genotype but picks the genotype with a uniform draw in [0, 1) taken by the
+  // caller, so the draws of many bites can be generated in one batch
+  int random_genotype(int location, int tracking_index, double uniform_draw);
+
   // this function will populate values for both parasite densities and genotypes that carried by a person
   void get_genotypes_profile_from_person(Person *person, std::vector<Genotype *> &sampling_genotypes,
                                          std::vector<double> &relative_infectivity_each_pp);
@@ -1,13 +1,26 @@
 #include "Genotype.h"
 
 #include <algorithm>
+#include <unordered_map>
+#include <utility>
 
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
+#include "GenotypeEncoding.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/DrugDatabase.h"
 #include "Utils/Helpers/NumberHelpers.h"
 
+namespace {
+const GenotypeEncoding &genotype_encoding() {
+  const auto* encoding = Model::get_genotype_db()->get_encoding();
+  if (encoding == nullptr) {
+    throw std::runtime_error("Genotype database has no encoding, pf_genotype_info is not processed.");
+  }
+  return *encoding;
+}
+}  // namespace
+
 Genotype::Genotype(const std::string &in_aa_sequence) : aa_sequence{in_aa_sequence} {
   // create aa structure
   std::string chromosome_str;
@@ -39,43 +52,40 @@ Genotype* Genotype::combine_mutation_to(const int &locus, const int &value) {
 
 Genotype* Genotype::modify_genotype_allele(const std::vector<std::tuple<int, int, char>> &alleles,
                                            Config* p_config) const {
-  std::string new_aa_sequence{aa_sequence};
+  const auto &encoding = genotype_encoding();
+  const auto &mutation_mask = p_config->get_genotype_parameters().get_mutation_mask();
+  auto new_code = get_genotype_code();
   /*
-   * allele_map_info is (chromosome_id,locus_pos,allele)
+   * allele_map_info is (chromosome_id,locus_pos,allele), both 1-based and locus_pos counts the
+   * characters of the chromosome in the aa sequence
    */
-  // for (auto & allele : alleles) {
-  //   spdlog::info("Mutation at {}:{}
-  //   {}",std::get<0>(allele),std::get<1>(allele),std::get<2>(allele));
-  // }
-  for (auto const allele_info : alleles) {
-    int chromosome_counter = 0;
-    int locus_counter = 0;
-    for (int char_counter = 0; char_counter < new_aa_sequence.size(); char_counter++) {
-      if (chromosome_counter == (std::get<0>(allele_info) - 1)) {
-        if (locus_counter == (std::get<1>(allele_info) - 1)) {
-          if (p_config->get_genotype_parameters().get_mutation_mask()[char_counter] == '1') {
-            if (new_aa_sequence[char_counter] != std::get<2>(allele_info)) {
-              // spdlog::trace("{}:{} Changing allele at {} ({} -> {}) new aa_sequence {} mask: {}",
-              //   std::get<0>(allele_info),std::get<1>(allele_info),
-              //   char_counter,
-              //   new_aa_sequence[char_counter],std::get<2>(allele_info),new_aa_sequence,
-              //   pConfig->get_genotype_parameters().get_mutation_mask()[char_counter]);
-              new_aa_sequence[char_counter] = std::get<2>(allele_info);
-            }
-          } else {
-            spdlog::error(
-                "{}:{} Changing allele at {} ({} -> {}) of genotype aa_sequence {} but the mask is "
-                "0",
-                std::get<0>(allele_info), std::get<1>(allele_info), char_counter,
-                new_aa_sequence[char_counter], std::get<2>(allele_info), new_aa_sequence);
-          }
-        }
-        locus_counter++;
-      }
-      if (new_aa_sequence[char_counter] == '|') chromosome_counter++;
+  for (auto const &allele_info : alleles) {
+    const auto chromosome_id = std::get<0>(allele_info) - 1;
+    const auto char_counter = encoding.chromosome_start(chromosome_id) + std::get<1>(allele_info) - 1;
+    const auto* locus = encoding.locus_at(char_counter);
+    if (locus == nullptr || locus->chromosome_id != chromosome_id) {
+      spdlog::error("{}:{} is not a locus of genotype aa_sequence {}", std::get<0>(allele_info),
+                    std::get<1>(allele_info), aa_sequence);
+      continue;
+    }
+    if (mutation_mask[char_counter] != '1') {
+      spdlog::error(
+          "{}:{} Changing allele at {} ({} -> {}) of genotype aa_sequence {} but the mask is "
+          "0",
+          std::get<0>(allele_info), std::get<1>(allele_info), char_counter,
+          aa_sequence[char_counter], std::get<2>(allele_info), aa_sequence);
+      continue;
     }
+    const auto value = locus->alphabet.find(std::get<2>(allele_info));
+    if (value == std::string::npos) {
+      spdlog::error("{}:{} Allele {} is not allowed at {} of genotype aa_sequence {}",
+                    std::get<0>(allele_info), std::get<1>(allele_info), std::get<2>(allele_info),
+                    char_counter, aa_sequence);
+      continue;
+    }
+    GenotypeEncoding::set(new_code, *locus, static_cast<int>(value));
   }
-  return Model::get_genotype_db()->get_genotype(new_aa_sequence);
+  return Model::get_genotype_db()->get_genotype(new_code);
 }
 
 double Genotype::get_EC50_power_n(DrugType* dt) { return EC50_power_n[dt->id()]; }
@@ -88,6 +98,13 @@ std::ostream &operator<<(std::ostream &os, Genotype &genotype) {
 
 std::string Genotype::get_aa_sequence() const { return aa_sequence; }
 
+const GenotypeCode &Genotype::get_genotype_code() const {
+  if (!genotype_code) {
+    throw std::runtime_error("Genotype " + aa_sequence + " has no packed encoding.");
+  }
+  return *genotype_code;
+}
+
 bool Genotype::is_valid(const GenotypeParameters::PfGenotypeInfo &gene_info) {
   for (int chromosome_i = 0; chromosome_i < 14; ++chromosome_i) {
     auto chromosome_info = gene_info.chromosome_infos[chromosome_i];
@@ -283,85 +300,133 @@ void Genotype::calculate_EC50_power_n(const GenotypeParameters::PfGenotypeInfo &
 Genotype* Genotype::perform_mutation_by_drug(Config* p_config, utils::Random* p_random,
                                              DrugType* p_drug_type,
                                              double mutation_probability_by_locus) const {
-  std::string new_aa_sequence{aa_sequence};
-  for (auto aa_pos : p_drug_type->resistant_aa_locations) {
+  auto* genotype_db = Model::get_genotype_db();
+  const auto* table = genotype_db->find_mutation_table(*this, p_drug_type->id());
+  std::unique_ptr<GenotypeTransitionTable> built;
+  if (table == nullptr || table->rate != mutation_probability_by_locus) {
+    built = build_mutation_table(p_config, p_drug_type, mutation_probability_by_locus);
+    if (built == nullptr) {
+      return mutate_locus_by_locus(p_config, p_random, p_drug_type, mutation_probability_by_locus);
+    }
+    table = genotype_db->cache_mutation_table(*this, p_drug_type->id(), built);
+  }
+  // no locus of the drug can mutate
+  if (table->codes.size() == 1) { return const_cast<Genotype*>(this); }
+
+  const auto &new_code = table->draw(p_random->random_uniform());
+  if (new_code == get_genotype_code()) { return const_cast<Genotype*>(this); }
+  return genotype_db->get_genotype(new_code);
+}
+
+std::unique_ptr<GenotypeTransitionTable> Genotype::build_mutation_table(
+    Config* p_config, DrugType* p_drug_type, double mutation_probability_by_locus) const {
+  const auto &encoding = genotype_encoding();
+  const auto &mutation_mask = p_config->get_genotype_parameters().get_mutation_mask();
+  const auto &old_code = get_genotype_code();
+  const auto p_mutation = std::clamp(mutation_probability_by_locus, 0.0, 1.0);
+
+  // the loci are mutated in turn as in mutate_locus_by_locus, equal outcomes are merged
+  std::vector<std::pair<GenotypeCode, double>> outcomes{{old_code, 1.0}};
+  std::vector<std::pair<GenotypeCode, double>> next_outcomes;
+  std::unordered_map<GenotypeCode, std::size_t, GenotypeCodeHash> outcome_index;
+  std::vector<std::pair<int, double>> new_values;
+  for (const auto &aa_pos : p_drug_type->resistant_aa_locations) {
+    if (mutation_mask[aa_pos.aa_index_in_aa_string] != '1') { continue; }
+    const auto &locus = *encoding.locus_at(aa_pos.aa_index_in_aa_string);
+    const auto old_value = GenotypeEncoding::get(old_code, locus);
+
+    new_values.clear();
+    if (aa_pos.is_copy_number) {
+      // the value of a copy number locus is copy number - 1
+      const auto max_value = static_cast<int>(locus.alphabet.size()) - 1;
+      if (old_value == 0) {
+        new_values.emplace_back(old_value + 1, 1.0);
+      } else if (old_value == max_value) {
+        new_values.emplace_back(old_value - 1, 1.0);
+      } else {
+        new_values.emplace_back(old_value - 1, 0.5);
+        new_values.emplace_back(old_value + 1, 0.5);
+      }
+    } else {
+      // a draw in [0, aa count - 1) equal to the current aa is replaced by the next one
+      const auto aa_count = static_cast<int>(locus.alphabet.size());
+      for (auto drawn = 0; drawn < aa_count - 1; drawn++) {
+        const auto new_aa_id = drawn != old_value ? drawn : (drawn + 1 < aa_count ? drawn + 1 : 0);
+        new_values.emplace_back(new_aa_id, 1.0 / (aa_count - 1));
+      }
+    }
+    // a single allele cannot mutate
+    if (new_values.empty()) { continue; }
+
+    next_outcomes.clear();
+    outcome_index.clear();
+    auto add_outcome = [&](const GenotypeCode &code, double probability) {
+      if (probability <= 0.0) { return; }
+      const auto [it, inserted] = outcome_index.try_emplace(code, next_outcomes.size());
+      if (inserted) {
+        next_outcomes.emplace_back(code, probability);
+      } else {
+        next_outcomes[it->second].second += probability;
+      }
+    };
+    for (const auto &[code, probability] : outcomes) {
+      add_outcome(code, probability * (1.0 - p_mutation));
+      for (const auto &[new_value, value_probability] : new_values) {
+        auto new_code = code;
+        GenotypeEncoding::set(new_code, locus, new_value);
+        add_outcome(new_code, probability * p_mutation * value_probability);
+      }
+    }
+    if (next_outcomes.size() > GenotypeTransitionTable::MAX_OUTCOMES) { return nullptr; }
+    outcomes.swap(next_outcomes);
+  }
+
+  auto table = std::make_unique<GenotypeTransitionTable>();
+  table->rate = mutation_probability_by_locus;
+  for (const auto &[code, probability] : outcomes) { table->add(code, probability); }
+  return table;
+}
+
+Genotype* Genotype::mutate_locus_by_locus(Config* p_config, utils::Random* p_random,
+                                          DrugType* p_drug_type,
+                                          double mutation_probability_by_locus) const {
+  const auto &encoding = genotype_encoding();
+  const auto &mutation_mask = p_config->get_genotype_parameters().get_mutation_mask();
+  const auto &old_code = get_genotype_code();
+  auto new_code = old_code;
+  for (const auto &aa_pos : p_drug_type->resistant_aa_locations) {
     // get aa position info (aa index in aa string, is copy number)
-    if (p_config->get_genotype_parameters().get_mutation_mask()[aa_pos.aa_index_in_aa_string]
-        == '1') {
+    if (mutation_mask[aa_pos.aa_index_in_aa_string] == '1') {
       const auto p_mutation = p_random->random_flat(0.0, 1.0);
-      // std::cout << "p: " << p << " Mutation probability: " << mutation_probability_by_locus <<
-      // std::endl; std::cout << "aa_pos_id: " << aa_pos_id << " aa_pos.aa_index_in_aa_string: "
-      // << aa_pos.aa_index_in_aa_string << " aa_pos.is_copy_number: " << aa_pos.is_copy_number <<
-      // std::endl;
       if (p_mutation < mutation_probability_by_locus) {
+        const auto &locus = *encoding.locus_at(aa_pos.aa_index_in_aa_string);
+        const auto old_value = GenotypeEncoding::get(old_code, locus);
         if (aa_pos.is_copy_number) {
-          // increase or decrease by 1 step
-          auto old_copy_number =
-              NumberHelpers::char_to_single_digit_number(aa_sequence[aa_pos.aa_index_in_aa_string]);
-          // std::cout << "old_copy_number: " << old_copy_number << std::endl;
+          // increase or decrease by 1 step, the value of a copy number locus is copy number - 1
+          const auto old_copy_number = old_value + 1;
+          const auto max_copies = static_cast<int>(locus.alphabet.size());
+          int new_copy_number;
           if (old_copy_number == 1) {
-            //                  std::cout << "old_copy_number == 1";
-            new_aa_sequence[aa_pos.aa_index_in_aa_string] =
-                NumberHelpers::single_digit_number_to_char(old_copy_number + 1);
-          } else if (old_copy_number
-                     == p_config->get_genotype_parameters()
-                            .get_pf_genotype_info()
-                            .chromosome_infos[aa_pos.chromosome_id]
-                            .get_genes()[aa_pos.gene_id]
-                            .get_max_copies()) {
-            // std::cout << "old_copy_number == max_copies" << std::endl;
-            new_aa_sequence[aa_pos.aa_index_in_aa_string] =
-                NumberHelpers::single_digit_number_to_char(old_copy_number - 1);
+            new_copy_number = old_copy_number + 1;
+          } else if (old_copy_number == max_copies) {
+            new_copy_number = old_copy_number - 1;
           } else {
-            auto new_copy_number =
+            new_copy_number =
                 p_random->random_uniform() < 0.5 ? old_copy_number - 1 : old_copy_number + 1;
-            // std::cout << "else " << "pRandom->random_uniform(): " << pRandom->random_uniform() <<
-            // " new_copy_number: " << new_copy_number << std::endl;
-            new_aa_sequence[aa_pos.aa_index_in_aa_string] =
-                NumberHelpers::single_digit_number_to_char(new_copy_number);
           }
+          GenotypeEncoding::set(new_code, locus, new_copy_number - 1);
         } else {
-          const std::vector<std::string> aa_list = p_config->get_genotype_parameters()
-                                                       .get_pf_genotype_info()
-                                                       .chromosome_infos[aa_pos.chromosome_id]
-                                                       .get_genes()[aa_pos.gene_id]
-                                                       .get_aa_positions()[aa_pos.aa_id]
-                                                       .get_amino_acids();
-          // std::cout << "aa_list: [" << aa_list[0] << "," << aa_list[1] << "]" << std::endl;
-          // draw random aa id
-          auto new_aa_id = p_random->random_uniform(aa_list.size() - 1);
-          // std::cout << "pRandom->random_uniform(aa_list.size() - 1) " <<
-          // pRandom->random_uniform(aa_list.size() - 1) << std::endl;
-          auto old_aa = aa_sequence[aa_pos.aa_index_in_aa_string];
-          auto new_aa = aa_list[new_aa_id][0];
-          // std::cout << "Mutation old_aa: " << old_aa << " -> new_aa: " << new_aa << std::endl;
-          //                if (new_aa == old_aa) {
-          //                    std::cout << "old_aa: " << old_aa << " == new_aa: " << new_aa;
-          //                    new_aa = aa_list[new_aa_id + 1];
-          //                }
-          if (new_aa == old_aa) {
-            if (new_aa_id + 1 < aa_list.size()) {
-              new_aa = aa_list[new_aa_id + 1][0];
-            } else {
-              new_aa = aa_list[0][0];
-            }
-          }
-          new_aa_sequence[aa_pos.aa_index_in_aa_string] = new_aa;
-          // if (old_aa == 'C' && new_aa == 'Y'){
-          //   spdlog::info("{} p: {} < {} select new_aa_id: {} from [0,{}] aa_list[new_aa_id] =
-          //   aa_list[{}] = {}",
-          //             Model::get_scheduler()->current_time(), p, mutation_probability_by_locus,
-          //             new_aa_id, aa_list.size() - 1, new_aa_id, aa_list[new_aa_id]);
-          //   spdlog::info("{} Mutation {} -> {} old: {} new: {} aa_pos_id: {} aa_pos: {}",
-          //             Model::get_scheduler()->current_time(), p, mutation_probability_by_locus,
-          //             old_aa, new_aa, aa_pos_id, aa_pos.aa_index_in_aa_string);
-          // }
+          const auto aa_count = locus.alphabet.size();
+          // draw random aa id, the current aa is replaced by the next one in the list
+          auto new_aa_id = p_random->random_uniform(aa_count - 1);
+          if (new_aa_id == old_value) { new_aa_id = new_aa_id + 1 < aa_count ? new_aa_id + 1 : 0; }
+          GenotypeEncoding::set(new_code, locus, static_cast<int>(new_aa_id));
         }
       }
     }
   }
-  // get genotype pointer from gene database based on aa sequence
-  return Model::get_genotype_db()->get_genotype(new_aa_sequence);
+  // get genotype pointer from gene database based on the packed alleles
+  return Model::get_genotype_db()->get_genotype(new_code);
 }
 
 void Genotype::override_EC50_power_n(
@@ -392,58 +457,7 @@ bool Genotype::match_pattern(const std::string &pattern) {
 
 Genotype* Genotype::free_recombine_with(Config* p_config, utils::Random* p_random,
                                         Genotype* other) {
-  // TODO: this function is not optimized 100%, use with care
-  PfGenotypeStr new_pf_genotype_str = std::vector<ChromosomalGenotypeStr>(14);
-  // for each chromosome
-  for (int chromosome_id = 0; chromosome_id < pf_genotype_str.size(); ++chromosome_id) {
-    if (pf_genotype_str[chromosome_id].empty()) continue;
-    if (pf_genotype_str[chromosome_id].size() == 1) {
-      // if single gene
-      // draw random
-      auto top_or_bottom = p_random->random_uniform();
-      // if < 0.5 take from current, otherwise take from other
-      auto gene_str = top_or_bottom < 0.5 ? pf_genotype_str[chromosome_id][0]
-                                          : other->pf_genotype_str[chromosome_id][0];
-      new_pf_genotype_str[chromosome_id].push_back(gene_str);
-    } else {
-      // if multiple genes
-      // draw random to determine whether
-      // within chromosome recombination happens
-      auto with_chromosome_recombination = p_random->random_uniform();
-      if (with_chromosome_recombination < p_config->get_parasite_parameters()
-                                              .get_recombination_parameters()
-                                              .get_within_chromosome_recombination_rate()) {
-        // if happen draw a random crossover point based on ','
-        auto cutting_gene_id =
-            p_random->random_uniform(pf_genotype_str[chromosome_id].size() - 1) + 1;
-        // draw another random to do top-bottom or bottom-top cross over
-        auto top_or_bottom = p_random->random_uniform();
-        for (auto gene_id = 0; gene_id < cutting_gene_id; ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? pf_genotype_str[chromosome_id][gene_id]
-                                              : other->pf_genotype_str[chromosome_id][gene_id];
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
-        }
-        for (auto gene_id = cutting_gene_id; gene_id < pf_genotype_str[chromosome_id].size();
-             ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? other->pf_genotype_str[chromosome_id][gene_id]
-                                              : pf_genotype_str[chromosome_id][gene_id];
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
-        }
-      } else {
-        // if not do the same with single gene
-        auto top_or_bottom = p_random->random_uniform();
-        for (int gene_id = 0; gene_id < pf_genotype_str[chromosome_id].size(); ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? pf_genotype_str[chromosome_id][gene_id]
-                                              : other->pf_genotype_str[chromosome_id][gene_id];
-
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
-        }
-      }
-    }
-  }
-
-  auto new_aa_sequence = convert_pf_genotype_str_to_string(new_pf_genotype_str);
-  return Model::get_genotype_db()->get_genotype(new_aa_sequence);
+  return free_recombine(p_config, p_random, this, other);
 }
 
 std::string Genotype::convert_pf_genotype_str_to_string(const PfGenotypeStr &pf_genotype_str) {
@@ -460,58 +474,163 @@ std::string Genotype::convert_pf_genotype_str_to_string(const PfGenotypeStr &pf_
 
   return ss.str();
 }
+
 Genotype* Genotype::free_recombine(Config* config, utils::Random* p_random, Genotype* female,
                                    Genotype* male) {
-  PfGenotypeStr new_pf_genotype_str = std::vector<ChromosomalGenotypeStr>(14);
+  auto* genotype_db = Model::get_genotype_db();
+  const auto within_chromosome_recombination_rate =
+      config->get_parasite_parameters()
+          .get_recombination_parameters()
+          .get_within_chromosome_recombination_rate();
+  // the distribution does not depend on which parent is the female, the table of a pair is built
+  // in id order so that the drawn child does not depend on which order cached it
+  if (female->genotype_id() > male->genotype_id()) { std::swap(female, male); }
+
+  const auto* table = genotype_db->find_recombination_table(*female, *male);
+  std::unique_ptr<GenotypeTransitionTable> built;
+  if (table == nullptr || table->rate != within_chromosome_recombination_rate) {
+    built = build_recombination_table(config, *female, *male);
+    if (built == nullptr) {
+      return recombine_chromosome_by_chromosome(config, p_random, female, male);
+    }
+    table = genotype_db->cache_recombination_table(*female, *male, built);
+  }
+  if (table->codes.size() == 1) { return female; }
+  return genotype_db->get_genotype(table->draw(p_random->random_uniform()));
+}
+
+std::unique_ptr<GenotypeTransitionTable> Genotype::build_recombination_table(
+    Config* config, const Genotype &female, const Genotype &male) {
+  const auto &gene_masks = genotype_encoding().gene_masks();
+  const auto within_chromosome_recombination_rate =
+      config->get_parasite_parameters()
+          .get_recombination_parameters()
+          .get_within_chromosome_recombination_rate();
+  const auto p_recombination = std::clamp(within_chromosome_recombination_rate, 0.0, 1.0);
+  const auto &female_code = female.get_genotype_code();
+  const auto &male_code = male.get_genotype_code();
+
+  GenotypeCode differing_bits{};
+  for (std::size_t word = 0; word < differing_bits.size(); word++) {
+    differing_bits[word] = female_code[word] ^ male_code[word];
+  }
+
+  // bits taken from the male genotype with their probability, only the bits where the parents
+  // differ are kept so that choices giving the same child are merged
+  using Choice = std::pair<GenotypeCode, double>;
+  std::vector<Choice> outcomes{{GenotypeCode{}, 1.0}};
+  std::vector<Choice> chromosome_choices;
+  std::vector<Choice> next_outcomes;
+  for (const auto &chromosome_genes : gene_masks) {
+    chromosome_choices.clear();
+    auto add_choice = [&](std::size_t first_gene, std::size_t last_gene, double probability) {
+      if (probability <= 0.0) { return; }
+      GenotypeCode from_male{};
+      for (auto gene_id = first_gene; gene_id < last_gene; gene_id++) {
+        for (std::size_t word = 0; word < from_male.size(); word++) {
+          from_male[word] |= chromosome_genes[gene_id][word] & differing_bits[word];
+        }
+      }
+      for (auto &[code, choice_probability] : chromosome_choices) {
+        if (code == from_male) {
+          choice_probability += probability;
+          return;
+        }
+      }
+      chromosome_choices.emplace_back(from_male, probability);
+    };
+
+    // the same choices as recombine_chromosome_by_chromosome
+    const auto genes = chromosome_genes.size();
+    if (genes == 1) {
+      add_choice(0, 0, 0.5);
+      add_choice(0, 1, 0.5);
+    } else if (genes > 1) {
+      add_choice(0, 0, (1.0 - p_recombination) * 0.5);
+      add_choice(0, genes, (1.0 - p_recombination) * 0.5);
+      const auto p_cut = p_recombination / static_cast<double>(genes - 1) * 0.5;
+      for (std::size_t cutting_gene_id = 1; cutting_gene_id < genes; cutting_gene_id++) {
+        add_choice(0, cutting_gene_id, p_cut);
+        add_choice(cutting_gene_id, genes, p_cut);
+      }
+    }
+    // the parents do not differ on the chromosome
+    if (chromosome_choices.size() <= 1) { continue; }
+
+    if (outcomes.size() * chromosome_choices.size() > GenotypeTransitionTable::MAX_OUTCOMES) {
+      return nullptr;
+    }
+    next_outcomes.clear();
+    for (const auto &[from_male, probability] : outcomes) {
+      for (const auto &[chromosome_from_male, choice_probability] : chromosome_choices) {
+        auto combined = from_male;
+        for (std::size_t word = 0; word < combined.size(); word++) {
+          combined[word] |= chromosome_from_male[word];
+        }
+        next_outcomes.emplace_back(combined, probability * choice_probability);
+      }
+    }
+    outcomes.swap(next_outcomes);
+  }
+
+  auto table = std::make_unique<GenotypeTransitionTable>();
+  table->rate = within_chromosome_recombination_rate;
+  for (const auto &[from_male, probability] : outcomes) {
+    table->add(GenotypeEncoding::combine(female_code, male_code, from_male), probability);
+  }
+  return table;
+}
+
+Genotype* Genotype::recombine_chromosome_by_chromosome(Config* config, utils::Random* p_random,
+                                                       Genotype* female, Genotype* male) {
+  const auto &gene_masks = genotype_encoding().gene_masks();
+  const auto within_chromosome_recombination_rate =
+      config->get_parasite_parameters()
+          .get_recombination_parameters()
+          .get_within_chromosome_recombination_rate();
+  // bits taken from the male genotype, the others come from the female
+  GenotypeCode from_male{};
+  auto take_from_male = [&from_male](const GenotypeCode &gene_mask) {
+    for (std::size_t word = 0; word < from_male.size(); word++) {
+      from_male[word] |= gene_mask[word];
+    }
+  };
+
   // for each chromosome
-  for (int chromosome_id = 0; chromosome_id < female->pf_genotype_str.size(); ++chromosome_id) {
-    if (female->pf_genotype_str[chromosome_id].empty()) continue;
-    if (female->pf_genotype_str[chromosome_id].size() == 1) {
+  for (const auto &chromosome_genes : gene_masks) {
+    if (chromosome_genes.empty()) continue;
+    if (chromosome_genes.size() == 1) {
       // if single gene
       // draw random
       auto top_or_bottom = p_random->random_uniform();
-      // if < 0.5 take from current, otherwise take from other
-      auto gene_str = top_or_bottom < 0.5 ? female->pf_genotype_str[chromosome_id][0]
-                                          : male->pf_genotype_str[chromosome_id][0];
-      new_pf_genotype_str[chromosome_id].push_back(gene_str);
+      // if < 0.5 take from female, otherwise take from male
+      if (top_or_bottom >= 0.5) { take_from_male(chromosome_genes[0]); }
     } else {
       // if multiple genes
       // draw random to determine whether
       // within chromosome recombination happens
       auto with_chromosome_recombination = p_random->random_uniform();
-      if (with_chromosome_recombination < config->get_parasite_parameters()
-                                              .get_recombination_parameters()
-                                              .get_within_chromosome_recombination_rate()) {
+      if (with_chromosome_recombination < within_chromosome_recombination_rate) {
         // if happen draw a random crossover point based on ','
-        auto cutting_gene_id =
-            p_random->random_uniform(female->pf_genotype_str[chromosome_id].size() - 1) + 1;
+        auto cutting_gene_id = p_random->random_uniform(chromosome_genes.size() - 1) + 1;
         // draw another random to do top-bottom or bottom-top cross over
         auto top_or_bottom = p_random->random_uniform();
-        for (auto gene_id = 0; gene_id < cutting_gene_id; ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? female->pf_genotype_str[chromosome_id][gene_id]
-                                              : male->pf_genotype_str[chromosome_id][gene_id];
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
-        }
-        for (auto gene_id = cutting_gene_id;
-             gene_id < female->pf_genotype_str[chromosome_id].size(); ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? male->pf_genotype_str[chromosome_id][gene_id]
-                                              : female->pf_genotype_str[chromosome_id][gene_id];
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
+        for (std::size_t gene_id = 0; gene_id < chromosome_genes.size(); ++gene_id) {
+          if ((gene_id < cutting_gene_id) == (top_or_bottom >= 0.5)) {
+            take_from_male(chromosome_genes[gene_id]);
+          }
         }
       } else {
         // if there is no within chromosome recombination
         // do the same with single gene
         auto top_or_bottom = p_random->random_uniform();
-        for (int gene_id = 0; gene_id < female->pf_genotype_str[chromosome_id].size(); ++gene_id) {
-          auto gene_str = top_or_bottom < 0.5 ? female->pf_genotype_str[chromosome_id][gene_id]
-                                              : male->pf_genotype_str[chromosome_id][gene_id];
-
-          new_pf_genotype_str[chromosome_id].push_back(gene_str);
+        if (top_or_bottom >= 0.5) {
+          for (const auto &gene_mask : chromosome_genes) { take_from_male(gene_mask); }
         }
       }
     }
   }
 
-  auto new_aa_sequence = convert_pf_genotype_str_to_string(new_pf_genotype_str);
-  return Model::get_genotype_db()->get_genotype(new_aa_sequence);
+  return Model::get_genotype_db()->get_genotype(GenotypeEncoding::combine(
+      female->get_genotype_code(), male->get_genotype_code(), from_male));
 }
@@ -1,7 +1,12 @@
 #ifndef Genotype_H
 #define Genotype_H
 
+#include <memory>
+#include <optional>
+
 #include "Configuration/GenotypeParameters.h"
+#include "GenotypeCode.h"
+#include "GenotypeTransitionTable.h"
 #include "Utils/Random.h"
 
 class GenotypeParameters;
@@ -39,6 +44,8 @@ public:
   int genotype_id_{-1};
   PfGenotypeStr pf_genotype_str = std::vector<ChromosomalGenotypeStr>(14);
   std::string aa_sequence;
+  // packed alleles, set by the GenotypeDatabase once its encoding is known
+  std::optional<GenotypeCode> genotype_code;
   double daily_fitness_multiple_infection{1};
   std::vector<double> EC50_power_n;
   std::vector<MosquitoRecombinedGenotypeInfo> resistant_recombinations_in_mosquito;
@@ -57,6 +64,9 @@ public:
 
   [[nodiscard]] std::string get_aa_sequence() const;
 
+  // throws std::runtime_error when the genotype has not been encoded
+  [[nodiscard]] const GenotypeCode &get_genotype_code() const;
+
   bool is_valid(const GenotypeParameters::PfGenotypeInfo &gene_info);
 
   void calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo &gene_info);
@@ -64,10 +74,19 @@ public:
   void calculate_EC50_power_n(const GenotypeParameters::PfGenotypeInfo &info,
                               DrugDatabase* p_database);
 
+  /**
+   * Mutate the resistant loci of the drug that are on in the mutation mask. The outcome is drawn
+   * with a single uniform from the memoized table of the genotype and drug, returns this genotype
+   * when no locus mutates.
+   */
   Genotype* perform_mutation_by_drug(Config* p_config, utils::Random* p_random,
                                      DrugType* p_drug_type,
                                      double mutation_probability_by_locus) const;
 
+  // Distribution of perform_mutation_by_drug, nullptr above GenotypeTransitionTable::MAX_OUTCOMES
+  [[nodiscard]] std::unique_ptr<GenotypeTransitionTable> build_mutation_table(
+      Config* p_config, DrugType* p_drug_type, double mutation_probability_by_locus) const;
+
   friend std::ostream &operator<<(std::ostream &os, const Genotype &genotype);
 
   void override_EC50_power_n(
@@ -78,10 +97,24 @@ public:
 
   Genotype* free_recombine_with(Config* config, utils::Random* p_random, Genotype* other);
 
+  // Child of the two genotypes, drawn with a single uniform from the memoized table of the pair
   static Genotype* free_recombine(Config* config, utils::Random* p_random, Genotype* female,
                                   Genotype* mmale);
 
+  // Distribution of free_recombine, nullptr above GenotypeTransitionTable::MAX_OUTCOMES
+  static std::unique_ptr<GenotypeTransitionTable> build_recombination_table(
+      Config* config, const Genotype &female, const Genotype &male);
+
   static std::string convert_pf_genotype_str_to_string(const PfGenotypeStr &pf_genotype_str);
+
+private:
+  // draw by draw forms of the steps, used when the tables would be too large
+  Genotype* mutate_locus_by_locus(Config* p_config, utils::Random* p_random,
+                                  DrugType* p_drug_type,
+                                  double mutation_probability_by_locus) const;
+
+  static Genotype* recombine_chromosome_by_chromosome(Config* config, utils::Random* p_random,
+                                                      Genotype* female, Genotype* male);
 };
 
 #endif /* Genotype_H */
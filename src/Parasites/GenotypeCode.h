@@ -0,0 +1,25 @@
+#ifndef GENOTYPECODE_H
+#define GENOTYPECODE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Packed allele vector of a genotype, the bit layout is defined by GenotypeEncoding
+using GenotypeCode = std::array<uint64_t, 4>;
+
+struct GenotypeCodeHash {
+  [[nodiscard]] std::size_t operator()(const GenotypeCode &code) const noexcept {
+    // splitmix64 finalizer folded over the words
+    uint64_t hash = 0;
+    for (const auto word : code) {
+      hash ^= word + 0x9E3779B97F4A7C15ULL;
+      hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+      hash ^= hash >> 31;
+    }
+    return static_cast<std::size_t>(hash);
+  }
+};
+
+#endif  // GENOTYPECODE_H
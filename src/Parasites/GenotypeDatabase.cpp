@@ -1,10 +1,13 @@
 #include "GenotypeDatabase.h"
 
 #include <algorithm>
+#include <stdexcept>
 
 #include "Configuration/Config.h"
 #include "Genotype.h"
+#include "GenotypeEncoding.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/TypeDef.h"
 
 // Define the default constructor here
@@ -12,6 +15,7 @@ GenotypeDatabase::GenotypeDatabase() = default;
 
 GenotypeDatabase::~GenotypeDatabase() {
   // for (auto &i : *this) { delete i.second; }
+  clear_transition_tables();
   clear();
 }
 
@@ -19,6 +23,13 @@ void GenotypeDatabase::add(std::unique_ptr<Genotype> genotype) {
   auto id = genotype->genotype_id();
   if (id >= size()) { resize(id + 1); }
   aa_sequence_id_map_[genotype->get_aa_sequence()] = genotype.get();
+  index_genotype_code(genotype.get());
+  if (id >= mutation_tables_.size()) { mutation_tables_.resize(id + 1); }
+  if (Model::get_drug_db() != nullptr) {
+    // never resized while the table slots are used, new slots hold no table
+    mutation_tables_[id] =
+        std::vector<std::atomic<const GenotypeTransitionTable*>>(Model::get_drug_db()->size());
+  }
   GenotypePtrVector::operator[](id) = std::move(genotype);
 
   // spdlog::info("GenotypeDatabase Added genotype id: {} aa_sequence: {}", genotype->genotype_id(),
@@ -35,57 +46,188 @@ unsigned int GenotypeDatabase::get_id(const std::string &aa_sequence) {
 }
 
 Genotype* GenotypeDatabase::get_genotype(const std::string &aa_sequence) {
+  if (deferred_registration_) {
+    // registered genotypes are not modified until commit, so they can be read without locking
+    if (const auto it = aa_sequence_id_map_.find(aa_sequence); it != aa_sequence_id_map_.end()) {
+      return it->second;
+    }
+    std::lock_guard lock(pending_mutex_);
+    auto &pending = pending_genotypes_[aa_sequence];
+    if (pending == nullptr) {
+      pending = create_genotype(aa_sequence);
+      if (pending->genotype_code) { pending_code_map_[*pending->genotype_code] = pending.get(); }
+    }
+    return pending.get();
+  }
+
   if (!aa_sequence_id_map_.contains(aa_sequence)) {
     // not yet exist then initialize new genotype
-    auto new_id = auto_id_;
+    auto new_genotype = create_genotype(aa_sequence);
+    new_genotype->set_genotype_id(static_cast<int>(auto_id_));
     auto_id_++;
-    auto new_genotype = std::make_unique<Genotype>(aa_sequence);
-    new_genotype->set_genotype_id(static_cast<int>(new_id));
-    new_genotype->resistant_recombinations_in_mosquito =
-        std::vector<MosquitoRecombinedGenotypeInfo>();
-
-    // check if aa_sequence is valid
-    if (!new_genotype->is_valid(
-            Model::get_config()->get_genotype_parameters().get_pf_genotype_info())) {
-      spdlog::error("Invalid genotype: " + aa_sequence);
+    // this will update aa_sequence_id_map_ as well
+    register_genotype(std::move(new_genotype));
+    // spdlog::info("GenotypeDB new genotype id {} aa_sequence {}",auto_id,aa_sequence);
+  }
+  return aa_sequence_id_map_[aa_sequence];
+}
+
+Genotype* GenotypeDatabase::get_genotype(const GenotypeCode &code) {
+  // registered genotypes are not modified while registration is deferred, see above
+  if (const auto it = code_id_map_.find(code); it != code_id_map_.end()) { return it->second; }
+
+  if (deferred_registration_) {
+    std::lock_guard lock(pending_mutex_);
+    if (const auto it = pending_code_map_.find(code); it != pending_code_map_.end()) {
+      return it->second;
     }
+    const auto aa_sequence = encoding_->decode(code);
+    auto &pending = pending_genotypes_[aa_sequence];
+    if (pending == nullptr) { pending = create_genotype(aa_sequence); }
+    pending_code_map_[code] = pending.get();
+    return pending.get();
+  }
+
+  // new genotype, the string form is only needed to create it
+  return get_genotype(encoding_->decode(code));
+}
 
-    // calculate cost of resistance
-    new_genotype->calculate_daily_fitness(
-        Model::get_config()->get_genotype_parameters().get_pf_genotype_info());
-
-    // calculate ec50
-    new_genotype->calculate_EC50_power_n(
-        Model::get_config()->get_genotype_parameters().get_pf_genotype_info(),
-        Model::get_drug_db());
-
-    new_genotype->override_EC50_power_n(
-        Model::get_config()->get_genotype_parameters().get_override_ec50_patterns(),
-        Model::get_drug_db());
-
-    // add min ec50 of each drug to db
-    for (int drug_id = 0; drug_id < Model::get_drug_db()->size();
-         drug_id++) {
-      if (!drug_id_ec50_.contains(drug_id)) {
-        if (!drug_id_ec50_[drug_id].contains(new_genotype->get_aa_sequence())) {
-          drug_id_ec50_[drug_id][new_genotype->get_aa_sequence()] = new_genotype->get_EC50_power_n(
-              Model::get_drug_db()->at(drug_id).get());
-        } else {
-          drug_id_ec50_[drug_id][new_genotype->get_aa_sequence()] =
-              std::min(drug_id_ec50_[drug_id][new_genotype->get_aa_sequence()],
-                       new_genotype->get_EC50_power_n(
-                           Model::get_drug_db()->at(drug_id).get()));
-        }
+void GenotypeDatabase::set_encoding(std::unique_ptr<GenotypeEncoding> encoding) {
+  clear_transition_tables();
+  encoding_ = std::move(encoding);
+  code_id_map_.clear();
+  for (auto &genotype : *this) {
+    if (genotype == nullptr) { continue; }
+    genotype->genotype_code.reset();
+    index_genotype_code(genotype.get());
+  }
+}
+
+void GenotypeDatabase::index_genotype_code(Genotype* genotype) {
+  if (encoding_ == nullptr) { return; }
+  if (!genotype->genotype_code) {
+    genotype->genotype_code = encoding_->encode(genotype->get_aa_sequence());
+  }
+  if (genotype->genotype_code) { code_id_map_[*genotype->genotype_code] = genotype; }
+}
+
+void GenotypeDatabase::begin_deferred_registration() { deferred_registration_ = true; }
+
+void GenotypeDatabase::commit_pending_genotypes() {
+  deferred_registration_ = false;
+  // std::map iterates in aa_sequence order which makes the assigned ids reproducible
+  for (auto &[aa_sequence, genotype] : pending_genotypes_) {
+    genotype->set_genotype_id(static_cast<int>(auto_id_));
+    auto_id_++;
+    register_genotype(std::move(genotype));
+  }
+  pending_genotypes_.clear();
+  pending_code_map_.clear();
+}
+
+const GenotypeTransitionTable* GenotypeDatabase::find_mutation_table(const Genotype &genotype,
+                                                                     int drug_id) const {
+  const auto id = genotype.genotype_id();
+  if (id < 0 || static_cast<std::size_t>(id) >= mutation_tables_.size()) { return nullptr; }
+  const auto &slots = mutation_tables_[id];
+  if (drug_id < 0 || static_cast<std::size_t>(drug_id) >= slots.size()) { return nullptr; }
+  return slots[drug_id].load(std::memory_order_acquire);
+}
+
+const GenotypeTransitionTable* GenotypeDatabase::cache_mutation_table(
+    const Genotype &genotype, int drug_id, std::unique_ptr<GenotypeTransitionTable> &table) {
+  const auto id = genotype.genotype_id();
+  // a pending genotype has no id, an id of another database has no slots
+  if (id < 0 || static_cast<std::size_t>(id) >= mutation_tables_.size()
+      || GenotypePtrVector::operator[](id).get() != &genotype) {
+    return table.get();
+  }
+  auto &slots = mutation_tables_[id];
+  if (drug_id < 0 || static_cast<std::size_t>(drug_id) >= slots.size()) { return table.get(); }
+
+  const GenotypeTransitionTable* cached = nullptr;
+  if (slots[drug_id].compare_exchange_strong(cached, table.get(), std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+    return table.release();
+  }
+  // another thread was first, its table is the same when built for the same rate
+  return cached->rate == table->rate ? cached : table.get();
+}
+
+uint64_t GenotypeDatabase::parent_pair_key(const Genotype &first, const Genotype &second) {
+  const auto first_id = static_cast<uint64_t>(first.genotype_id());
+  const auto second_id = static_cast<uint64_t>(second.genotype_id());
+  return first_id < second_id ? (first_id << 32U) | second_id : (second_id << 32U) | first_id;
+}
+
+const GenotypeTransitionTable* GenotypeDatabase::find_recombination_table(
+    const Genotype &first, const Genotype &second) const {
+  if (first.genotype_id() < 0 || second.genotype_id() < 0) { return nullptr; }
+  const auto it = recombination_tables_.find(parent_pair_key(first, second));
+  return it == recombination_tables_.end() ? nullptr : it->second.get();
+}
+
+const GenotypeTransitionTable* GenotypeDatabase::cache_recombination_table(
+    const Genotype &first, const Genotype &second,
+    std::unique_ptr<GenotypeTransitionTable> &table) {
+  if (first.genotype_id() < 0 || second.genotype_id() < 0) { return table.get(); }
+  if (recombination_tables_.size() >= MAX_RECOMBINATION_TABLES) { recombination_tables_.clear(); }
+  // replaces a table of another rate
+  auto &cached = recombination_tables_[parent_pair_key(first, second)];
+  cached = std::move(table);
+  return cached.get();
+}
+
+void GenotypeDatabase::clear_transition_tables() {
+  for (auto &slots : mutation_tables_) {
+    for (auto &slot : slots) { delete slot.exchange(nullptr); }
+  }
+  recombination_tables_.clear();
+}
+
+std::unique_ptr<Genotype> GenotypeDatabase::create_genotype(const std::string &aa_sequence) const {
+  auto new_genotype = std::make_unique<Genotype>(aa_sequence);
+  if (encoding_ != nullptr) { new_genotype->genotype_code = encoding_->encode(aa_sequence); }
+
+  // check if aa_sequence is valid
+  if (!new_genotype->is_valid(
+          Model::get_config()->get_genotype_parameters().get_pf_genotype_info())) {
+    spdlog::error("Invalid genotype: " + aa_sequence);
+  }
+
+  // calculate cost of resistance
+  new_genotype->calculate_daily_fitness(
+      Model::get_config()->get_genotype_parameters().get_pf_genotype_info());
+
+  // calculate ec50
+  new_genotype->calculate_EC50_power_n(
+      Model::get_config()->get_genotype_parameters().get_pf_genotype_info(),
+      Model::get_drug_db());
+
+  new_genotype->override_EC50_power_n(
+      Model::get_config()->get_genotype_parameters().get_override_ec50_patterns(),
+      Model::get_drug_db());
+
+  new_genotype->resistant_recombinations_in_mosquito =
+      std::vector<MosquitoRecombinedGenotypeInfo>();
+  return new_genotype;
+}
+
+void GenotypeDatabase::register_genotype(std::unique_ptr<Genotype> genotype) {
+  // add min ec50 of each drug to db
+  for (int drug_id = 0; drug_id < Model::get_drug_db()->size(); drug_id++) {
+    if (!drug_id_ec50_.contains(drug_id)) {
+      if (!drug_id_ec50_[drug_id].contains(genotype->get_aa_sequence())) {
+        drug_id_ec50_[drug_id][genotype->get_aa_sequence()] =
+            genotype->get_EC50_power_n(Model::get_drug_db()->at(drug_id).get());
+      } else {
+        drug_id_ec50_[drug_id][genotype->get_aa_sequence()] =
+            std::min(drug_id_ec50_[drug_id][genotype->get_aa_sequence()],
+                     genotype->get_EC50_power_n(Model::get_drug_db()->at(drug_id).get()));
       }
     }
-
-    new_genotype->resistant_recombinations_in_mosquito =
-        std::vector<MosquitoRecombinedGenotypeInfo>();
-    // this will update aa_sequence_id_map_ as well
-    add(std::move(new_genotype));
-    // spdlog::info("GenotypeDB new genotype id {} aa_sequence {}",auto_id,aa_sequence);
   }
-  return aa_sequence_id_map_[aa_sequence];
+  add(std::move(genotype));
 }
 
 double GenotypeDatabase::get_min_ec50(int drug_id) {
@@ -96,3 +238,27 @@ double GenotypeDatabase::get_min_ec50(int drug_id) {
   return it->second;
 }
 
+void GenotypeDatabase::checkpoint(utils::CheckpointArchive &archive) {
+  StringVector aa_sequences;
+  if (!archive.is_loading()) {
+    for (const auto &genotype : *this) {
+      aa_sequences.push_back(genotype == nullptr ? "" : genotype->get_aa_sequence());
+    }
+  }
+  archive & aa_sequences & auto_id_;
+  if (!archive.is_loading()) { return; }
+
+  for (std::size_t id = 0; id < aa_sequences.size(); id++) {
+    if (aa_sequences[id].empty()) { continue; }
+    if (id < size() && GenotypePtrVector::operator[](id) != nullptr) {
+      if (GenotypePtrVector::operator[](id)->get_aa_sequence() != aa_sequences[id]) {
+        throw std::runtime_error("Checkpoint genotype " + std::to_string(id)
+                                 + " does not match the configuration");
+      }
+      continue;
+    }
+    auto genotype = create_genotype(aa_sequences[id]);
+    genotype->set_genotype_id(static_cast<int>(id));
+    register_genotype(std::move(genotype));
+  }
+}
@@ -1,14 +1,27 @@
 #ifndef INTPARASITEDATABASE_H
 #define INTPARASITEDATABASE_H
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "GenotypeCode.h"
+#include "GenotypeTransitionTable.h"
 #include "Utils/TypeDef.h"
 
 class Genotype;
+class GenotypeEncoding;
 class Config;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 using GenotypePtrVector = std::vector<std::unique_ptr<Genotype>>;
 
 class GenotypeDatabase : public GenotypePtrVector {
@@ -32,8 +45,61 @@ public:
 
   Genotype* get_genotype(const std::string &aa_sequence);
 
+  /**
+   * Hashed lookup on the packed allele vector, used by mutation and recombination.
+   * The aa sequence string is only built when the genotype is not known yet.
+   */
+  Genotype* get_genotype(const GenotypeCode &code);
+
+  // Sets the packed layout and encodes the genotypes already in the database
+  void set_encoding(std::unique_ptr<GenotypeEncoding> encoding);
+
+  [[nodiscard]] const GenotypeEncoding* get_encoding() const { return encoding_.get(); }
+
+  /**
+   * Switch to deferred registration, used while individuals are updated on several threads.
+   * New genotypes are then created on demand (thread-safe) but kept in a pending set without
+   * an id; commit_pending_genotypes() gives them ids in aa_sequence order, so the numbering
+   * does not depend on which thread saw a genotype first.
+   */
+  void begin_deferred_registration();
+
+  void commit_pending_genotypes();
+
+  [[nodiscard]] bool is_deferring_registration() const { return deferred_registration_; }
+
   unsigned int get_id(const std::string &aa_sequence);
 
+  /**
+   * Memoized mutation tables by genotype and drug. They are read and published from the threads
+   * of the parallel person update without locking, the first table published for a slot is kept.
+   * Only registered genotypes have slots, pending genotypes build their tables on every call.
+   */
+  [[nodiscard]] const GenotypeTransitionTable* find_mutation_table(const Genotype &genotype,
+                                                                   int drug_id) const;
+
+  /**
+   * Store the table and return the cached one, which may be the table of another thread. When
+   * the slot does not exist or holds a table of another rate the table stays with the caller and
+   * is returned as is.
+   */
+  const GenotypeTransitionTable* cache_mutation_table(
+      const Genotype &genotype, int drug_id, std::unique_ptr<GenotypeTransitionTable> &table);
+
+  /**
+   * Memoized recombination tables by unordered pair of registered parents, used by the mosquito
+   * step on the main thread only. Same ownership rules as the mutation tables.
+   */
+  [[nodiscard]] const GenotypeTransitionTable* find_recombination_table(
+      const Genotype &first, const Genotype &second) const;
+
+  const GenotypeTransitionTable* cache_recombination_table(
+      const Genotype &first, const Genotype &second,
+      std::unique_ptr<GenotypeTransitionTable> &table);
+
+  // Drop every memoized table, needed when the mutation mask or a transition rate changes
+  void clear_transition_tables();
+
   Genotype* get_genotype_from_alleles_structure(const IntVector &alleles);
 
   double get_min_ec50(int drug_id);
@@ -41,15 +107,43 @@ public:
   [[nodiscard]] std::vector<int> get_weight() const { return weight_; }
   void set_weight(const std::vector<int> &value) { weight_ = value; }
 
+  /**
+   * Save the aa sequences of the genotypes by id, restoring registers the genotypes found while
+   * running so that the ids match the saved ones.
+   */
+  void checkpoint(utils::CheckpointArchive &archive);
+
   // override at
   Genotype* at(int id) { return GenotypePtrVector::at(id).get(); }
 
 private:
+  std::unique_ptr<Genotype> create_genotype(const std::string &aa_sequence) const;
+
+  void register_genotype(std::unique_ptr<Genotype> genotype);
+
+  void index_genotype_code(Genotype* genotype);
+
+  [[nodiscard]] static uint64_t parent_pair_key(const Genotype &first, const Genotype &second);
+
+  // recombination tables are dropped all at once when this many parent pairs are cached
+  static constexpr std::size_t MAX_RECOMBINATION_TABLES = 1U << 16;
+
   std::map<std::string, Genotype*> aa_sequence_id_map_;
+  std::unique_ptr<GenotypeEncoding> encoding_;
+  std::unordered_map<GenotypeCode, Genotype*, GenotypeCodeHash> code_id_map_;
   std::map<int, std::map<std::string, double>> drug_id_ec50_;
 
   unsigned int auto_id_{0};
   std::vector<int> weight_;
+
+  bool deferred_registration_{false};
+  std::mutex pending_mutex_;
+  std::map<std::string, std::unique_ptr<Genotype>> pending_genotypes_;
+  std::unordered_map<GenotypeCode, Genotype*, GenotypeCodeHash> pending_code_map_;
+
+  // mutation_tables_[genotype id][drug id], owning; sized when the genotype is added
+  std::vector<std::vector<std::atomic<const GenotypeTransitionTable*>>> mutation_tables_;
+  std::unordered_map<uint64_t, std::unique_ptr<GenotypeTransitionTable>> recombination_tables_;
 };
 
 #endif /* INTPARASITEDATABASE_H */
@@ -0,0 +1,111 @@
+#include "GenotypeEncoding.h"
+
+#include <bit>
+#include <stdexcept>
+
+#include "Utils/Helpers/NumberHelpers.h"
+
+GenotypeEncoding::GenotypeEncoding(const GenotypeParameters::PfGenotypeInfo &pf_genotype_info) {
+  const auto number_of_chromosomes = static_cast<int>(pf_genotype_info.chromosome_infos.size());
+  chromosome_starts_.resize(number_of_chromosomes);
+  gene_masks_.resize(number_of_chromosomes);
+
+  int word = 0;
+  int shift = 0;
+  auto add_locus = [&](int chromosome_id, int gene_id, bool is_copy_number,
+                       std::string alphabet) {
+    if (alphabet.empty()) {
+      throw std::invalid_argument("Every locus of pf_genotype_info needs at least one allele.");
+    }
+    const auto width = static_cast<int>(std::bit_width(alphabet.size() - 1));
+    if (shift + width > BITS_PER_WORD) {
+      word++;
+      shift = 0;
+    }
+    if (word >= static_cast<int>(std::tuple_size_v<GenotypeCode>)) {
+      throw std::invalid_argument("pf_genotype_info needs more than "
+                                  + std::to_string(MAX_BITS) + " bits to encode a genotype.");
+    }
+
+    Locus locus;
+    locus.chromosome_id = chromosome_id;
+    locus.gene_id = gene_id;
+    locus.index_in_aa_string = static_cast<int>(sequence_template_.size());
+    locus.word = word;
+    locus.shift = shift;
+    locus.mask = width == 0 ? 0 : (~uint64_t{0} >> (BITS_PER_WORD - width));
+    locus.is_copy_number = is_copy_number;
+    locus.alphabet = std::move(alphabet);
+
+    gene_masks_[chromosome_id][gene_id][word] |= locus.mask << shift;
+    locus_by_position_.push_back(static_cast<int>(loci_.size()));
+    sequence_template_.push_back(locus.alphabet[0]);
+    loci_.push_back(std::move(locus));
+    shift += width;
+    bit_count_ += width;
+  };
+
+  for (int chromosome_id = 0; chromosome_id < number_of_chromosomes; ++chromosome_id) {
+    if (chromosome_id > 0) {
+      sequence_template_.push_back('|');
+      locus_by_position_.push_back(-1);
+    }
+    chromosome_starts_[chromosome_id] = static_cast<int>(sequence_template_.size());
+
+    const auto &genes = pf_genotype_info.chromosome_infos[chromosome_id].get_genes();
+    gene_masks_[chromosome_id].resize(genes.size(), GenotypeCode{});
+    for (int gene_id = 0; gene_id < genes.size(); ++gene_id) {
+      if (gene_id > 0) {
+        sequence_template_.push_back(',');
+        locus_by_position_.push_back(-1);
+      }
+      for (const auto &aa_position : genes[gene_id].get_aa_positions()) {
+        std::string alphabet;
+        for (const auto &amino_acid : aa_position.get_amino_acids()) {
+          alphabet.push_back(amino_acid[0]);
+        }
+        add_locus(chromosome_id, gene_id, false, std::move(alphabet));
+      }
+      if (genes[gene_id].get_max_copies() > 1) {
+        std::string alphabet;
+        for (int copy_number = 1; copy_number <= genes[gene_id].get_max_copies(); ++copy_number) {
+          alphabet.push_back(NumberHelpers::single_digit_number_to_char(copy_number));
+        }
+        add_locus(chromosome_id, gene_id, true, std::move(alphabet));
+      }
+    }
+  }
+}
+
+std::optional<GenotypeCode> GenotypeEncoding::encode(const std::string &aa_sequence) const {
+  if (aa_sequence.size() != sequence_template_.size()) { return std::nullopt; }
+  GenotypeCode code{};
+  for (std::size_t position = 0; position < aa_sequence.size(); ++position) {
+    const auto locus_index = locus_by_position_[position];
+    if (locus_index < 0) {
+      if (aa_sequence[position] != sequence_template_[position]) { return std::nullopt; }
+      continue;
+    }
+    const auto &locus = loci_[locus_index];
+    const auto value = locus.alphabet.find(aa_sequence[position]);
+    if (value == std::string::npos) { return std::nullopt; }
+    set(code, locus, static_cast<int>(value));
+  }
+  return code;
+}
+
+std::string GenotypeEncoding::decode(const GenotypeCode &code) const {
+  std::string aa_sequence{sequence_template_};
+  for (const auto &locus : loci_) {
+    aa_sequence[locus.index_in_aa_string] = locus.alphabet[get(code, locus)];
+  }
+  return aa_sequence;
+}
+
+const GenotypeEncoding::Locus* GenotypeEncoding::locus_at(int index_in_aa_string) const {
+  if (index_in_aa_string < 0 || index_in_aa_string >= static_cast<int>(locus_by_position_.size())) {
+    return nullptr;
+  }
+  const auto locus_index = locus_by_position_[index_in_aa_string];
+  return locus_index < 0 ? nullptr : &loci_[locus_index];
+}
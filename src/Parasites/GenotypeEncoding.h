@@ -0,0 +1,94 @@
+#ifndef GENOTYPEENCODING_H
+#define GENOTYPEENCODING_H
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Configuration/GenotypeParameters.h"
+#include "GenotypeCode.h"
+
+/**
+ * @class GenotypeEncoding
+ * @brief Bit layout of a GenotypeCode derived from pf_genotype_info.
+ *
+ * Every amino acid position and every copy number of the aa sequence is a
+ * locus holding the index of its allele in the per-locus alphabet, packed in
+ * bit_width(alphabet size - 1) bits. A locus never straddles two words, so
+ * reading or writing one is a shift and a mask. The loci of a gene are
+ * contiguous, which lets recombination pick whole genes with one mask per
+ * chromosome. The aa sequence string is only built back for new genotypes
+ * and I/O.
+ */
+class GenotypeEncoding {
+public:
+  static constexpr int BITS_PER_WORD = 64;
+  static constexpr int MAX_BITS = BITS_PER_WORD * static_cast<int>(std::tuple_size_v<GenotypeCode>);
+
+  struct Locus {
+    int chromosome_id{-1};
+    int gene_id{-1};
+    int index_in_aa_string{-1};
+    int word{0};
+    int shift{0};
+    uint64_t mask{0};
+    bool is_copy_number{false};
+    // allowed characters, the value stored in the code is the index in this string
+    std::string alphabet;
+  };
+
+  explicit GenotypeEncoding(const GenotypeParameters::PfGenotypeInfo &pf_genotype_info);
+
+  // Returns nullopt when aa_sequence does not follow the pf_genotype_info layout
+  [[nodiscard]] std::optional<GenotypeCode> encode(const std::string &aa_sequence) const;
+
+  [[nodiscard]] std::string decode(const GenotypeCode &code) const;
+
+  [[nodiscard]] static int get(const GenotypeCode &code, const Locus &locus) noexcept {
+    return static_cast<int>((code[locus.word] >> locus.shift) & locus.mask);
+  }
+
+  static void set(GenotypeCode &code, const Locus &locus, int value) noexcept {
+    code[locus.word] = (code[locus.word] & ~(locus.mask << locus.shift))
+                       | ((static_cast<uint64_t>(value) & locus.mask) << locus.shift);
+  }
+
+  // Bits of from_second taken from second, the others from first
+  [[nodiscard]] static GenotypeCode combine(const GenotypeCode &first, const GenotypeCode &second,
+                                            const GenotypeCode &from_second) noexcept {
+    GenotypeCode result{};
+    for (std::size_t word = 0; word < result.size(); word++) {
+      result[word] = (first[word] & ~from_second[word]) | (second[word] & from_second[word]);
+    }
+    return result;
+  }
+
+  // Locus at the given index of the aa sequence, nullptr for separators and out of range indices
+  [[nodiscard]] const Locus* locus_at(int index_in_aa_string) const;
+
+  // Index in the aa sequence of the first character of the chromosome (0-based id)
+  [[nodiscard]] int chromosome_start(int chromosome_id) const {
+    return chromosome_starts_[chromosome_id];
+  }
+
+  // gene_masks()[chromosome_id][gene_id] has the bits of all loci of the gene set
+  [[nodiscard]] const std::vector<std::vector<GenotypeCode>> &gene_masks() const {
+    return gene_masks_;
+  }
+
+  [[nodiscard]] const std::vector<Locus> &loci() const { return loci_; }
+
+  [[nodiscard]] int bit_count() const { return bit_count_; }
+
+private:
+  std::vector<Locus> loci_;
+  // locus index for each character of the aa sequence, -1 for separators
+  std::vector<int> locus_by_position_;
+  std::vector<int> chromosome_starts_;
+  std::vector<std::vector<GenotypeCode>> gene_masks_;
+  // aa sequence with the separators in place, loci are filled in by decode
+  std::string sequence_template_;
+  int bit_count_{0};
+};
+
+#endif  // GENOTYPEENCODING_H
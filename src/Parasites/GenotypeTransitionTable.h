@@ -0,0 +1,40 @@
+#ifndef GENOTYPETRANSITIONTABLE_H
+#define GENOTYPETRANSITIONTABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "GenotypeCode.h"
+
+/**
+ * Distribution of the genotypes a mutation or recombination step can produce. The outcomes are
+ * kept packed and are only resolved to a Genotype once drawn, so building a table registers no
+ * genotype. Tables are built by Genotype and memoized by the GenotypeDatabase.
+ */
+struct GenotypeTransitionTable {
+  // tables with more outcomes are not built, the step then draws locus by locus
+  static constexpr std::size_t MAX_OUTCOMES = 1024;
+
+  // mutation probability per locus or within chromosome recombination rate of the table
+  double rate{0.0};
+  std::vector<GenotypeCode> codes;
+  std::vector<double> cumulative_probabilities;
+
+  void add(const GenotypeCode &code, double probability) {
+    codes.push_back(code);
+    cumulative_probabilities.push_back(
+        (cumulative_probabilities.empty() ? 0.0 : cumulative_probabilities.back()) + probability);
+  }
+
+  // Outcome of a uniform draw in [0, 1)
+  [[nodiscard]] const GenotypeCode &draw(double uniform) const {
+    const auto it = std::upper_bound(cumulative_probabilities.begin(),
+                                     cumulative_probabilities.end(), uniform);
+    // the last cumulative probability may fall short of 1 by rounding
+    return codes[std::min(static_cast<std::size_t>(it - cumulative_probabilities.begin()),
+                          codes.size() - 1)];
+  }
+};
+
+#endif  // GENOTYPETRANSITIONTABLE_H
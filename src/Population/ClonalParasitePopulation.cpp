@@ -5,14 +5,14 @@
 
 #include "Core/Scheduler/Scheduler.h"
 #include "Parasites/Genotype.h"
+#include "Simulation/Checkpoint.h"
 #include "Simulation/Model.h"
 #include "SingleHostClonalParasitePopulations.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Helpers/NumberHelpers.h"
 
 ClonalParasitePopulation::ClonalParasitePopulation(Genotype* genotype) : genotype_(genotype) {}
 
-ClonalParasitePopulation::~ClonalParasitePopulation() = default;
-
 double ClonalParasitePopulation::get_current_parasite_density(const int &current_time) {
   if (update_function_ == nullptr) { return last_update_log10_parasite_density_; }
 
@@ -63,3 +63,10 @@ void ClonalParasitePopulation::perform_drug_action(double percent_parasite_remov
 
   set_last_update_log10_parasite_density(new_size);
 }
+
+void ClonalParasitePopulation::checkpoint(utils::CheckpointArchive &archive) {
+  archive & handle_ & last_update_log10_parasite_density_ & gametocyte_level_
+      & first_date_in_blood_;
+  Checkpoint::genotype(archive, genotype_);
+  Checkpoint::update_function(archive, update_function_);
+}
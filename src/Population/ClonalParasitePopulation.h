@@ -1,9 +1,10 @@
 #ifndef CLONALPARASITEPOPULATION_H
 #define CLONALPARASITEPOPULATION_H
 
+#include <cstdint>
+
 #include "ParasiteDensity/ParasiteDensityUpdateFunction.h"
 #include "Treatment/Therapies/DrugType.h"
-#include "Utils/Index/Indexer.h"
 
 class Therapy;
 
@@ -11,20 +12,31 @@ class Genotype;
 
 class SingleHostClonalParasitePopulations;
 
-class ClonalParasitePopulation : public utils::Indexer {
-  // OBJECTPOOL(ClonalParasitePopulation);
-public:
-  // disallow copy and assign
+namespace utils {
+class CheckpointArchive;
+}
 
-  ClonalParasitePopulation(ClonalParasitePopulation &&) = delete;
-  ClonalParasitePopulation &operator=(ClonalParasitePopulation &&) = delete;
+// Stored by value in the SingleHostClonalParasitePopulations of its host, so it moves whenever a
+// sibling clone is removed. Whoever has to find the clone again later (an event) keeps its handle.
+class ClonalParasitePopulation {
+public:
+  // disallow copy and assign, moved by the owning population only
+  ClonalParasitePopulation(ClonalParasitePopulation &&) noexcept = default;
+  ClonalParasitePopulation &operator=(ClonalParasitePopulation &&) noexcept = default;
   ClonalParasitePopulation(const ClonalParasitePopulation &) = delete;
   ClonalParasitePopulation &operator=(const ClonalParasitePopulation &) = delete;
   explicit ClonalParasitePopulation(Genotype* genotype = nullptr);
-  ~ClonalParasitePopulation() override;
+  ~ClonalParasitePopulation() = default;
+
+  // Identifies the clone within its host, never reused for the lifetime of the host's population
+  using Handle = std::uint32_t;
+  static constexpr Handle NO_HANDLE = 0;
 
   static constexpr double LOG_ZERO_PARASITE_DENSITY = -1000;
 
+  [[nodiscard]] Handle handle() const noexcept { return handle_; }
+  void set_handle(Handle value) noexcept { handle_ = value; }
+
   [[nodiscard]] double last_update_log10_parasite_density() const noexcept {
     return last_update_log10_parasite_density_;
   }
@@ -62,10 +74,15 @@ public:
 
   void perform_drug_action(double percent_parasite_remove, double log10_parasite_density_cured);
 
+  // Save or restore the parasite with its handle, the owning population is set when it is added
+  // back
+  void checkpoint(utils::CheckpointArchive &archive);
+
 private:
   double last_update_log10_parasite_density_{LOG_ZERO_PARASITE_DENSITY};
   double gametocyte_level_{0.0};
   int first_date_in_blood_{-1};
+  Handle handle_{NO_HANDLE};
   SingleHostClonalParasitePopulations* parasite_population_{nullptr};
   Genotype* genotype_{nullptr};
   ParasiteDensityUpdateFunction* update_function_{nullptr};
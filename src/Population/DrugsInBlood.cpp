@@ -1,11 +1,21 @@
 #include "DrugsInBlood.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "Events/Event.h"
 #include "Population/Person/Person.h"
+#include "Simulation/Model.h"
 #include "Treatment/Therapies/Drug.h"
+#include "Treatment/Therapies/DrugDatabase.h"
 #include "Treatment/Therapies/DrugType.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/TypeDef.h"
 
+OBJECTPOOL_IMPL(DrugsInBlood)
+
 #ifndef DRUG_CUT_OFF_VALUE
 #define DRUG_CUT_OFF_VALUE 0.1
 #endif
@@ -14,17 +24,42 @@ DrugsInBlood::DrugsInBlood(Person* person) : person_(person) {}
 
 void DrugsInBlood::init() { drugs_.clear(); }
 
-DrugsInBlood::~DrugsInBlood() {
-  if (!drugs_.empty()) { clear(); }
+DrugsInBlood::~DrugsInBlood() = default;
+
+DrugsInBlood::DrugVector::const_iterator DrugsInBlood::lower_bound(int key) const {
+  return std::lower_bound(drugs_.begin(), drugs_.end(), key, [](const Drug &drug, int id) {
+    return drug.drug_type()->id() < id;
+  });
+}
+
+Drug* DrugsInBlood::at(const int &key) {
+  return const_cast<Drug*>(std::as_const(*this).at(key));
+}
+
+const Drug* DrugsInBlood::at(const int &key) const {
+  const auto it = lower_bound(key);
+  if (it == drugs_.end() || it->drug_type()->id() != key) {
+    throw std::out_of_range("Drug " + std::to_string(key) + " is not in the blood");
+  }
+  return it;
+}
+
+bool DrugsInBlood::contains(const int &key) const {
+  const auto it = lower_bound(key);
+  return it != drugs_.end() && it->drug_type()->id() == key;
 }
 
-Drug* DrugsInBlood::add_drug(std::unique_ptr<Drug> drug) {
-  int type_id = drug->drug_type()->id();
-  drug->set_person_drugs(this);
+Drug* DrugsInBlood::add_drug(Drug drug) {
+  const int type_id = drug.drug_type()->id();
+  drug.set_person_drugs(this);
 
-  // Create unique_ptr from raw pointer
-  auto [it, inserted] = drugs_.insert_or_assign(type_id, std::move(drug));
-  return it->second.get();
+  auto it = lower_bound(type_id);
+  if (it != drugs_.end() && it->drug_type()->id() == type_id) {
+    auto* existing = drugs_.begin() + (it - drugs_.begin());
+    *existing = std::move(drug);
+    return existing;
+  }
+  return drugs_.insert(it, std::move(drug));
 }
 
 // V5-like behavior
@@ -58,23 +93,45 @@ Drug* DrugsInBlood::add_drug(std::unique_ptr<Drug> drug) {
 
 std::size_t DrugsInBlood::size() const { return drugs_.size(); }
 
-void DrugsInBlood::clear() {
-  if (drugs_.empty()) return;
-  drugs_.clear();
-}
+void DrugsInBlood::clear() { drugs_.clear(); }
 
 void DrugsInBlood::update() {
-  for (auto &drug : *this) { drug.second->update(); }
+  for (auto &drug : drugs_) { drug.update(); }
 }
 
 void DrugsInBlood::clear_cut_off_drugs() {
-  if (!drugs_.empty()) {
-    for (auto pos = drugs_.begin(); pos != drugs_.end();) {
-      if (pos->second->last_update_value() <= DRUG_CUT_OFF_VALUE) {
-        drugs_.erase(pos++);
-      } else {
-        ++pos;
-      }
+  const auto new_end = std::remove_if(drugs_.begin(), drugs_.end(), [](const Drug &drug) {
+    return drug.last_update_value() <= DRUG_CUT_OFF_VALUE;
+  });
+  drugs_.erase(new_end, drugs_.end());
+}
+
+void DrugsInBlood::checkpoint(utils::CheckpointArchive &archive) {
+  const auto number_of_drugs = archive.size(drugs_.size());
+  if (archive.is_loading()) { drugs_.clear(); }
+  for (std::size_t i = 0; i < number_of_drugs; i++) {
+    Drug restored;
+    auto &current = archive.is_loading() ? restored : drugs_[i];
+
+    auto drug_id = archive.is_loading() ? 0 : current.drug_type()->id();
+    auto dosing_days = current.dosing_days();
+    auto start_time = current.start_time();
+    auto end_time = current.end_time();
+    auto last_update_value = current.last_update_value();
+    auto last_update_time = current.last_update_time();
+    auto starting_value = current.starting_value();
+    archive & drug_id & dosing_days & start_time & end_time & last_update_value
+        & last_update_time & starting_value;
+
+    if (archive.is_loading()) {
+      restored.set_drug_type(Model::get_drug_db()->at(drug_id).get());
+      restored.set_dosing_days(dosing_days);
+      restored.set_start_time(start_time);
+      restored.set_end_time(end_time);
+      restored.set_last_update_value(last_update_value);
+      restored.set_last_update_time(last_update_time);
+      restored.set_starting_value(starting_value);
+      add_drug(std::move(restored));
     }
   }
 }
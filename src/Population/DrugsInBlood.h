@@ -1,21 +1,23 @@
 #ifndef DRUGSINBLOOD_H
 #define    DRUGSINBLOOD_H
 
-#include <map>
-#include <memory>
+#include <cstddef>
 
-class Person;
+#include "Treatment/Therapies/Drug.h"
+#include "Utils/ObjectPool.h"
+#include "Utils/SmallVector.h"
 
-class Drug;
+class Person;
 
 class Event;
 
 class DrugType;
 
-using DrugPtrMap = std::map<int, std::unique_ptr<Drug>>;
+namespace utils {
+class CheckpointArchive;
+}
 
 class DrugsInBlood {
-  // OBJECTPOOL(DrugsInBlood)
   // Disallow copy
   DrugsInBlood(const DrugsInBlood&) = delete;
   DrugsInBlood& operator=(const DrugsInBlood&) = delete;
@@ -24,16 +26,23 @@ class DrugsInBlood {
   DrugsInBlood(DrugsInBlood&&) = delete;
   DrugsInBlood& operator=(DrugsInBlood&&) = delete;
 
+ public:
+  // A person rarely carries more than 3 drugs, more spill over to the heap
+  static constexpr std::size_t INLINE_CAPACITY = 3;
+  using DrugVector = utils::SmallVector<Drug, INLINE_CAPACITY>;
+
  private:
   Person *person_{nullptr};
-  DrugPtrMap drugs_{};
+  // Sorted by drug type id, at most one drug per type
+  DrugVector drugs_{};
+
+  [[nodiscard]] DrugVector::const_iterator lower_bound(int key) const;
 
  public:
-  // Iterator type definitions for proxy access
-  using iterator = DrugPtrMap::iterator;
-  using const_iterator = DrugPtrMap::const_iterator;
+  using iterator = DrugVector::iterator;
+  using const_iterator = DrugVector::const_iterator;
 
-  // Iterator proxy methods
+  // Iterate the drugs in drug type id order
   iterator begin() { return drugs_.begin(); }
   iterator end() { return drugs_.end(); }
   const_iterator begin() const { return drugs_.begin(); }
@@ -41,10 +50,12 @@ class DrugsInBlood {
   const_iterator cbegin() const { return drugs_.cbegin(); }
   const_iterator cend() const { return drugs_.cend(); }
 
-  // Map-like proxy methods
-  Drug* at(const int& key) const { return drugs_.at(key).get(); }
-  bool contains(const int& key) const { return drugs_.find(key) != drugs_.end(); }
-  
+  // Map-like access by drug type id, at() throws std::out_of_range for a drug not in the blood.
+  // The returned pointer is invalidated by the next add_drug or clear_cut_off_drugs.
+  Drug* at(const int& key);
+  const Drug* at(const int& key) const;
+  bool contains(const int& key) const;
+
   Person *person() const {
     return person_;
   }
@@ -59,9 +70,12 @@ class DrugsInBlood {
   //    DrugsInBlood(const DrugsInBlood& orig);
   virtual ~DrugsInBlood();
 
+  OBJECTPOOL(DrugsInBlood)
+
   void init();
 
-  Drug *add_drug(std::unique_ptr<Drug> drug);
+  // Insert the drug or replace the one of the same type, returns the stored drug
+  Drug *add_drug(Drug drug);
 
   std::size_t size() const;
 
@@ -71,6 +85,9 @@ class DrugsInBlood {
 
   void clear_cut_off_drugs();
 
+  // Save or restore the drugs with their concentration history
+  void checkpoint(utils::CheckpointArchive &archive);
+
 };
 
 #endif    /* DRUGSINBLOOD_H */
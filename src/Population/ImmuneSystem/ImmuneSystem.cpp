@@ -1,12 +1,18 @@
 #include "ImmuneSystem.h"
 
 #include <cmath>
+#include <cstdint>
 #include <memory>
 
 #include "Configuration//Config.h"
 #include "ImmuneComponent.h"
+#include "InfantImmuneComponent.h"
+#include "NonInfantImmuneComponent.h"
 #include "Population/Person/Person.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
+
+OBJECTPOOL_IMPL(ImmuneSystem)
 
 ImmuneSystem::ImmuneSystem(Person* person) : person_(person), immune_component_(nullptr) {}
 
@@ -37,9 +43,9 @@ double ImmuneSystem::get_parasite_size_after_t_days(const int &duration,
                                                     const double &original_size,
                                                     const double &fitness) const {
   const auto last_immune_level = get_latest_immune_value();
+  const auto &parameters = Model::get_config()->hot_parameters();
   const auto temp =
-      (Model::get_config()->get_immune_system_parameters().c_max * (1 - last_immune_level))
-      + (Model::get_config()->get_immune_system_parameters().c_min * last_immune_level);
+      (parameters.c_max * (1 - last_immune_level)) + (parameters.c_min * last_immune_level);
   // std::cout << "day: " << Model::get_scheduler()->current_time() << "\tc_max: " <<
   // Model::CONFIG->immune_system_information().c_max << "\tc_min: " <<
   // Model::CONFIG->immune_system_information().c_min << "\tlast_immune_level: " <<
@@ -55,7 +61,7 @@ double ImmuneSystem::get_parasite_size_after_t_days(const int &duration,
 double ImmuneSystem::get_clinical_progression_probability() const {
   const auto immune = get_current_value();
 
-  const auto isf = Model::get_config()->get_immune_system_parameters();
+  const auto &isf = Model::get_config()->hot_parameters();
 
   //    double PClinical = (isf.min_clinical_probability - isf.max_clinical_probability) *
   //    pow(immune, isf.immune_effect_on_progression_to_clinical) + isf.max_clinical_probability;
@@ -75,3 +81,29 @@ double ImmuneSystem::get_clinical_progression_probability() const {
 }
 
 void ImmuneSystem::update() { immune_component_->update(); }
+
+void ImmuneSystem::checkpoint(utils::CheckpointArchive &archive) {
+  enum Component : std::uint8_t { NONE = 0, INFANT, NON_INFANT };
+  auto component = NONE;
+  double latest_value = 0;
+  if (!archive.is_loading() && immune_component_ != nullptr) {
+    component = dynamic_cast<InfantImmuneComponent*>(immune_component_.get()) != nullptr
+                    ? INFANT
+                    : NON_INFANT;
+    latest_value = immune_component_->latest_value();
+  }
+  archive & component & latest_value & increase_;
+
+  if (archive.is_loading()) {
+    if (component == NONE) {
+      immune_component_.reset();
+      return;
+    }
+    if (component == INFANT) {
+      set_immune_component(std::make_unique<InfantImmuneComponent>());
+    } else {
+      set_immune_component(std::make_unique<NonInfantImmuneComponent>());
+    }
+    immune_component_->set_latest_value(latest_value);
+  }
+}
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "Utils/ObjectPool.h"
 #include "Utils/TypeDef.h"
 
 class Model;
@@ -14,10 +15,13 @@ class ImmuneComponent;
 
 class Config;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 // typedef std::vector<ImmuneComponent*> ImmuneComponentPtrVector;
 
 class ImmuneSystem {
-  // OBJECTPOOL(ImmuneSystem)
 public:
   // Disallow copy
   ImmuneSystem(const ImmuneSystem&) = delete;
@@ -27,6 +31,8 @@ public:
 
   virtual ~ImmuneSystem();
 
+  OBJECTPOOL(ImmuneSystem)
+
   [[nodiscard]] Person* person() const { return person_; }
   void set_person(Person* person) { person_ = person; }
 
@@ -52,6 +58,9 @@ public:
 
   [[nodiscard]] virtual double get_clinical_progression_probability() const;
 
+  // Save or restore the kind of immune component, its latest value and the increase flag
+  void checkpoint(utils::CheckpointArchive &archive);
+
 private:
   Person* person_{nullptr};
   std::unique_ptr<ImmuneComponent> immune_component_{nullptr};
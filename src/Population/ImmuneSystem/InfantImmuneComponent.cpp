@@ -6,6 +6,8 @@
 
 #include "Core/Scheduler/Scheduler.h"
 
+OBJECTPOOL_IMPL(InfantImmuneComponent)
+
 InfantImmuneComponent::InfantImmuneComponent(ImmuneSystem *immune_system) : ImmuneComponent(immune_system) {}
 
 InfantImmuneComponent::~InfantImmuneComponent() = default;
@@ -2,6 +2,7 @@
 #define    INFANTIMMUNECOMPONENT_H
 
 #include "ImmuneComponent.h"
+#include "Utils/ObjectPool.h"
 
 class InfantImmuneComponent : public ImmuneComponent {
   //disallow copy and assign
@@ -14,6 +15,8 @@ class InfantImmuneComponent : public ImmuneComponent {
   // InfantImmuneComponent(const InfantImmuneComponent& orig);
   virtual ~InfantImmuneComponent();
 
+  OBJECTPOOL(InfantImmuneComponent)
+
   double get_decay_rate(const int &age) const override;
 
   double get_acquire_rate(const int &age) const override;
@@ -3,7 +3,7 @@
 #include "Configuration/Config.h"
 
 
-//OBJECTPOOL_IMPL(NonInfantImmuneComponent)
+OBJECTPOOL_IMPL(NonInfantImmuneComponent)
 
 NonInfantImmuneComponent::NonInfantImmuneComponent(ImmuneSystem *immune_system) : ImmuneComponent(immune_system) {
 }
@@ -14,11 +14,11 @@ NonInfantImmuneComponent::~NonInfantImmuneComponent() {
 double NonInfantImmuneComponent::get_acquire_rate(const int &age) const {
   //    return FastImmuneComponent::acquireRate;
 
-  return (age > 80) ? Model::get_config()->get_immune_system_parameters().acquire_rate_by_age[80]
-                    : Model::get_config()->get_immune_system_parameters().acquire_rate_by_age[age];
+  return (age > 80) ? Model::get_config()->hot_parameters().acquire_rate_by_age[80]
+                    : Model::get_config()->hot_parameters().acquire_rate_by_age[age];
 
 }
 
 double NonInfantImmuneComponent::get_decay_rate(const int &age) const {
-  return Model::get_config()->get_immune_system_parameters().decay_rate;
+  return Model::get_config()->hot_parameters().decay_rate;
 }
\ No newline at end of file
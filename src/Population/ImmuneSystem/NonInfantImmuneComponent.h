@@ -2,6 +2,7 @@
 #define    NONINFANTIMMUNECOMPONENT
 
 #include "ImmuneComponent.h"
+#include "Utils/ObjectPool.h"
 
 class NonInfantImmuneComponent : public ImmuneComponent {
   //disallow copy and assign
@@ -14,6 +15,8 @@ public:
   // NonInfantImmuneComponent(const NonInfantImmuneComponent& orig);
   virtual ~NonInfantImmuneComponent();
 
+  OBJECTPOOL(NonInfantImmuneComponent)
+
   virtual double get_decay_rate(const int &age = 0) const;
 
   virtual double get_acquire_rate(const int &age = 0) const;
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
 
 #include "Core/Scheduler/Scheduler.h"
 #include "Events/BirthdayEvent.h"
@@ -29,10 +30,14 @@
 #include "Population/DrugsInBlood.h"
 #include "Population/ImmuneSystem/ImmuneSystem.h"
 #include "Population/Population.h"
+#include "Simulation/Checkpoint.h"
 #include "Treatment/Therapies/Drug.h"
 #include "Treatment/Therapies/MACTherapy.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Constants.h"
 
+OBJECTPOOL_IMPL(Person)
+
 Person::Person() {
   immune_system_ = std::make_unique<ImmuneSystem>(this);
   drugs_in_blood_ = std::make_unique<DrugsInBlood>(this);
@@ -129,33 +134,25 @@ void Person::set_immune_system(std::unique_ptr<ImmuneSystem> value) {
 }
 
 ClonalParasitePopulation* Person::add_new_parasite_to_blood(Genotype* parasite_type) const {
-  auto blood_parasite = std::make_unique<ClonalParasitePopulation>(parasite_type);
-  auto* raw_ptr = blood_parasite.get();
+  ClonalParasitePopulation blood_parasite(parasite_type);
 
-  blood_parasite->set_last_update_log10_parasite_density(
-      Model::get_config()
-          ->get_parasite_parameters()
-          .get_parasite_density_levels()
-          .get_log_parasite_density_from_liver());
+  blood_parasite.set_last_update_log10_parasite_density(
+      Model::get_config()->hot_parameters().log_parasite_density_from_liver);
 
-  all_clonal_parasite_populations_->add(std::move(blood_parasite));
-  return raw_ptr;
+  return all_clonal_parasite_populations_->add(std::move(blood_parasite));
 }
 
 double Person::relative_infectivity(const double &log10_parasite_density) {
   if (log10_parasite_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) return 0.0;
 
+  const auto &parameters = Model::get_config()->hot_parameters();
   // this sigma has already taken 'ln' and 'log10' into account
-  const auto d_n = (log10_parasite_density
-                    * Model::get_config()
-                          ->get_epidemiological_parameters()
-                          .get_relative_infectivity()
-                          .get_sigma())
-                   + Model::get_config()
-                         ->get_epidemiological_parameters()
-                         .get_relative_infectivity()
-                         .get_ro_star();
-  const auto p = Model::get_random()->cdf_standard_normal_distribution(d_n);
+  const auto d_n = (log10_parasite_density * parameters.relative_infectivity_sigma)
+                   + parameters.relative_infectivity_ro_star;
+  const auto* cdf_table = parameters.relative_infectivity_cdf_table;
+  const auto p = cdf_table != nullptr
+                     ? (*cdf_table)(d_n)
+                     : Model::get_random()->cdf_standard_normal_distribution(d_n);
 
   const auto return_value = (p * p) + 0.01;
   return return_value > 1.0 ? 1.0 : return_value;
@@ -193,16 +190,15 @@ bool Person::will_progress_to_death_when_recieve_treatment() {
 }
 
 int Person::complied_dosing_days(const int &dosing_day) {
-  if (Model::get_config()->get_epidemiological_parameters().get_p_compliance() < 1) {
+  const auto &parameters = Model::get_config()->hot_parameters();
+  if (parameters.p_compliance < 1) {
     const auto prob = Model::get_random()->random_flat(0.0, 1.0);
-    if (prob > Model::get_config()->get_epidemiological_parameters().get_p_compliance()) {
+    if (prob > parameters.p_compliance) {
       // do not comply
       const auto weight =
-          (Model::get_config()->get_epidemiological_parameters().get_min_dosing_days() - dosing_day)
-          / (1 - Model::get_config()->get_epidemiological_parameters().get_p_compliance());
-      return static_cast<int>(std::ceil(
-          (weight * prob)
-          + Model::get_config()->get_epidemiological_parameters().get_min_dosing_days() - weight));
+          (parameters.min_dosing_days - dosing_day) / (1 - parameters.p_compliance);
+      return static_cast<int>(
+          std::ceil((weight * prob) + parameters.min_dosing_days - weight));
     }
   }
   return dosing_day;
@@ -293,9 +289,9 @@ void Person::receive_therapy(SCTherapy* sc_therapy, bool is_mac_therapy) {
 
 void Person::add_drug_to_blood(DrugType* dt, const int &dosing_days, bool is_part_of_mac_therapy) {
   // Prepare the drug object
-  auto drug = std::make_unique<Drug>(dt);
-  drug->set_dosing_days(dosing_days);
-  drug->set_last_update_time(Model::get_scheduler()->current_time());
+  Drug drug(dt);
+  drug.set_dosing_days(dosing_days);
+  drug.set_last_update_time(Model::get_scheduler()->current_time());
 
   // Find the mean and standard deviation for the drug, and use those values to
   // determine the drug level for this individual
@@ -318,17 +314,17 @@ void Person::add_drug_to_blood(DrugType* dt, const int &dosing_days, bool is_par
   }
 
   // Set the starting level for this course of treatment
-  drug->set_starting_value(drug_level);
+  drug.set_starting_value(drug_level);
 
   if (drugs_in_blood_->contains(dt->id())) {
-    drug->set_last_update_value(drugs_in_blood_->at(dt->id())->last_update_value());
+    drug.set_last_update_value(drugs_in_blood_->at(dt->id())->last_update_value());
   } else {
-    drug->set_last_update_value(0.0);
+    drug.set_last_update_value(0.0);
   }
 
-  drug->set_start_time(Model::get_scheduler()->current_time());
-  drug->set_end_time(Model::get_scheduler()->current_time()
-                     + dt->get_total_duration_of_drug_activity(dosing_days));
+  drug.set_start_time(Model::get_scheduler()->current_time());
+  drug.set_end_time(Model::get_scheduler()->current_time()
+                    + dt->get_total_duration_of_drug_activity(dosing_days));
 
   drugs_in_blood_->add_drug(std::move(drug));
 }
@@ -418,11 +414,8 @@ void Person::determine_symptomatic_recrudescence(
     // Set the last update parasite density to the asymptomatic level
 
     clinical_caused_parasite->set_last_update_log10_parasite_density(
-        Model::get_random()->random_normal_truncated(Model::get_config()
-                                                         ->get_parasite_parameters()
-                                                         .get_parasite_density_levels()
-                                                         .get_log_parasite_density_asymptomatic(),
-                                                     0.1));
+        Model::get_random()->random_normal_truncated(
+            Model::get_config()->hot_parameters().log_parasite_density_asymptomatic, 0.1));
     // clinical_caused_parasite->set_last_update_log10_parasite_density(
     //     Model::CONFIG->parasite_density_level()
     //         .log_parasite_density_asymptomatic);
@@ -432,8 +425,9 @@ void Person::determine_symptomatic_recrudescence(
     this->recurrence_status_ = Person::RecurrenceStatus::WITH_SYMPTOM;
     // mark the test treatment failure event as a failure
     for (auto &[time, event] : get_events()) {
-      auto* tf_event = dynamic_cast<TestTreatmentFailureEvent*>(event.get());
-      if (tf_event != nullptr && tf_event->clinical_caused_parasite() == clinical_caused_parasite) {
+      if (event->type_id() != TestTreatmentFailureEvent::TYPE_ID) { continue; }
+      auto* tf_event = static_cast<TestTreatmentFailureEvent*>(event.get());
+      if (tf_event->clinical_caused_parasite() == clinical_caused_parasite) {
         event->set_executable(false);
         Model::get_mdc()->record_1_tf(location_, true);
         Model::get_mdc()->record_1_treatment_failure_by_therapy(location_, age_class_,
@@ -449,17 +443,12 @@ void Person::determine_symptomatic_recrudescence(
     // If the last update parasite density is greater than the asymptomatic
     // level, adjust it. We don't want to have high parasitaemia yn
     // asymptomatic
+    const auto log_parasite_density_asymptomatic =
+        Model::get_config()->hot_parameters().log_parasite_density_asymptomatic;
     if (clinical_caused_parasite->last_update_log10_parasite_density()
-        > Model::get_config()
-              ->get_parasite_parameters()
-              .get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic()) {
+        > log_parasite_density_asymptomatic) {
       clinical_caused_parasite->set_last_update_log10_parasite_density(
-          Model::get_random()->random_normal_truncated(Model::get_config()
-                                                           ->get_parasite_parameters()
-                                                           .get_parasite_density_levels()
-                                                           .get_log_parasite_density_asymptomatic(),
-                                                       0.1));
+          Model::get_random()->random_normal_truncated(log_parasite_density_asymptomatic, 0.1));
     }
 
     if (drugs_in_blood_->size() > 0) {
@@ -481,10 +470,7 @@ void Person::determine_clinical_or_not(ClonalParasitePopulation* clinical_caused
       // progress to clinical after several days
       clinical_caused_parasite->set_update_function(Model::progress_to_clinical_update_function());
       clinical_caused_parasite->set_last_update_log10_parasite_density(
-          Model::get_config()
-              ->get_parasite_parameters()
-              .get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic());
+          Model::get_config()->hot_parameters().log_parasite_density_asymptomatic);
       schedule_progress_to_clinical_event(clinical_caused_parasite);
       /* Old in V5 below (without recurence, schedule_relapse_event makes FOI match FOI in v5 */
       // schedule_relapse_event(clinical_caused_parasite,
@@ -514,14 +500,31 @@ void Person::update() {
   // parasite will be killed by immune system
   all_clonal_parasite_populations_->update();
 
+  update_drugs_in_blood();
+
+  immune_system_->update();
+
+  finish_daily_update();
+  //    std::cout << "End Person Update"<< std::endl;
+}
+
+void Person::update_with_evaluated_immunity(double immune_value) {
+  update_drugs_in_blood();
+
+  immune_system_->set_latest_immune_value(immune_value);
+
+  finish_daily_update();
+}
+
+void Person::update_drugs_in_blood() {
   // update all drugs concentration
   drugs_in_blood_->update();
 
   // update drug activity on parasite
   all_clonal_parasite_populations_->update_by_drugs(drugs_in_blood_.get());
+}
 
-  immune_system_->update();
-
+void Person::finish_daily_update() {
   update_current_state();
 
   // update biting level only less than 1 to save performance
@@ -529,17 +532,21 @@ void Person::update() {
   update_relative_biting_rate();
 
   latest_update_time_ = Model::get_scheduler()->current_time();
-  //    std::cout << "End Person Update"<< std::endl;
 }
 
 void Person::update_relative_biting_rate() {
-  if (Model::get_config()
-          ->get_epidemiological_parameters()
-          .get_using_age_dependent_biting_level()) {
-    current_relative_biting_rate_ =
-        innate_relative_biting_rate_ * get_age_dependent_biting_factor();
+  if (Model::get_config()->hot_parameters().using_age_dependent_biting_level) {
+    set_current_relative_biting_rate(innate_relative_biting_rate_
+                                     * get_age_dependent_biting_factor());
   } else {
-    current_relative_biting_rate_ = innate_relative_biting_rate_;
+    set_current_relative_biting_rate(innate_relative_biting_rate_);
+  }
+}
+
+void Person::set_current_relative_biting_rate(double value) {
+  if (current_relative_biting_rate_ != value) {
+    notify_change(RELATIVE_BITING_RATE, &current_relative_biting_rate_, &value);
+    current_relative_biting_rate_ = value;
   }
 }
 
@@ -547,10 +554,8 @@ void Person::update_current_state() {
   // clear drugs <=0.1
   drugs_in_blood_->clear_cut_off_drugs();
   // clear cured parasite
-  all_clonal_parasite_populations_->clear_cured_parasites(Model::get_config()
-                                                              ->get_parasite_parameters()
-                                                              .get_parasite_density_levels()
-                                                              .get_log_parasite_density_cured());
+  all_clonal_parasite_populations_->clear_cured_parasites(
+      Model::get_config()->hot_parameters().log_parasite_density_cured);
 
   if (all_clonal_parasite_populations_->size() == 0) {
     change_state_when_no_parasite_in_blood();
@@ -643,10 +648,8 @@ void Person::cancel_all_return_to_residence_events() {
 }
 
 bool Person::has_detectable_parasite() const {
-  auto detectable_threshold = Model::get_config()
-                                  ->get_parasite_parameters()
-                                  .get_parasite_density_levels()
-                                  .get_log_parasite_density_detectable_pfpr();
+  auto detectable_threshold =
+      Model::get_config()->hot_parameters().log_parasite_density_detectable_pfpr;
   return all_clonal_parasite_populations_->has_detectable_parasite(detectable_threshold);
 }
 
@@ -733,8 +736,8 @@ double Person::prob_present_at_mda() {
 }
 
 bool Person::has_effective_drug_in_blood() const {
-  for (const auto &kv_drug : *drugs_in_blood_) {
-    if (kv_drug.second->last_update_value() > 0.5) return true;
+  for (const auto &drug : *drugs_in_blood_) {
+    if (drug.last_update_value() > 0.5) return true;
   }
   return false;
 }
@@ -799,6 +802,9 @@ PersonEvent* Person::schedule_basic_event(std::unique_ptr<PersonEvent> event) {
 
   // Simply allow event to be scheduled even if it's time is greater than total time
 
+  // link the event into the population calendar so the person is visited on that day
+  if (population_ != nullptr) { population_->timing_wheel()->schedule(event.get()); }
+
   // schedule and transfer ownership of the event to the event_manager
   event_manager_.schedule_event(std::move(event));
   return event_manager_.get_events().begin()->second.get();
@@ -826,8 +832,8 @@ void Person::schedule_progress_to_clinical_event(ClonalParasitePopulation* paras
   // Time to clinical varies by age
   const int days_to_clinical =
       (age_ <= 5)
-          ? Model::get_config()->get_epidemiological_parameters().get_days_to_clinical_under_five()
-          : Model::get_config()->get_epidemiological_parameters().get_days_to_clinical_over_five();
+          ? Model::get_config()->hot_parameters().days_to_clinical_under_five
+          : Model::get_config()->hot_parameters().days_to_clinical_over_five;
 
   auto event = std::make_unique<ProgressToClinicalEvent>(this);
   event->set_time(calculate_future_time(days_to_clinical));
@@ -857,8 +863,8 @@ void Person::schedule_clinical_recurrence_event(ClonalParasitePopulation* parasi
 
   // Log if similar event is already scheduled within ±7 days
   for (const auto &[time, existing_event] : get_events()) {
-    auto* end_clinical_event = dynamic_cast<EndClinicalEvent*>(existing_event.get());
-    if (end_clinical_event != nullptr) {
+    if (existing_event->type_id() == EndClinicalEvent::TYPE_ID) {
+      auto* end_clinical_event = static_cast<EndClinicalEvent*>(existing_event.get());
       int end_clinical_existing_time = end_clinical_event->get_time();
       if (new_event_time <= end_clinical_existing_time) {
         spdlog::info(
@@ -866,8 +872,8 @@ void Person::schedule_clinical_recurrence_event(ClonalParasitePopulation* parasi
             Model::get_scheduler()->current_time(), new_event_time, end_clinical_existing_time);
       }
     }
-    auto* existing_progress_event = dynamic_cast<ProgressToClinicalEvent*>(existing_event.get());
-    if (existing_progress_event != nullptr) {
+    if (existing_event->type_id() == ProgressToClinicalEvent::TYPE_ID) {
+      auto* existing_progress_event = static_cast<ProgressToClinicalEvent*>(existing_event.get());
       int existing_time = existing_progress_event->get_time();
       if (std::abs(existing_time - new_event_time) <= 7 && (new_event_time != existing_time)
           && existing_progress_event->is_executable()) {
@@ -942,12 +948,9 @@ void Person::schedule_move_parasite_to_blood(Genotype* genotype, int days_delay)
 }
 
 void Person::schedule_mature_gametocyte_event(ClonalParasitePopulation* parasite) {
-  const int days_to_mature = (age_ <= 5) ? Model::get_config()
-                                               ->get_epidemiological_parameters()
-                                               .get_days_mature_gametocyte_under_five()
-                                         : Model::get_config()
-                                               ->get_epidemiological_parameters()
-                                               .get_days_mature_gametocyte_over_five();
+  const int days_to_mature =
+      (age_ <= 5) ? Model::get_config()->hot_parameters().days_mature_gametocyte_under_five
+                  : Model::get_config()->hot_parameters().days_mature_gametocyte_over_five;
 
   auto event = std::make_unique<MatureGametocyteEvent>(this);
   event->set_time(calculate_future_time(days_to_mature));
@@ -997,35 +1000,109 @@ void Person::schedule_relapse_event(ClonalParasitePopulation* clinical_caused_pa
 void Person::determine_relapse_or_not(ClonalParasitePopulation* clinical_caused_parasite) {
   if (all_clonal_parasite_populations_->contain(clinical_caused_parasite)) {
     const auto p = Model::get_random()->random_flat(0.0, 1.0);
+    const auto &parameters = Model::get_config()->hot_parameters();
 
-    if (p <= Model::get_config()->get_epidemiological_parameters().get_p_relapse()) {
+    if (p <= parameters.p_relapse) {
       //        if (P <= get_probability_progress_to_clinical()) {
       // progress to clinical after several days
       clinical_caused_parasite->set_update_function(Model::progress_to_clinical_update_function());
       // std::cout<<"\t\tPerson::determine_relapse_or_not relapse" << std::endl;
       clinical_caused_parasite->set_last_update_log10_parasite_density(
-          Model::get_config()
-              ->get_parasite_parameters()
-              .get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic());
-      schedule_relapse_event(
-          clinical_caused_parasite,
-          Model::get_config()->get_epidemiological_parameters().get_relapse_duration());
+          parameters.log_parasite_density_asymptomatic);
+      schedule_relapse_event(clinical_caused_parasite, parameters.relapse_duration);
 
     } else {
       // progress to clearance
       if (clinical_caused_parasite->last_update_log10_parasite_density()
-          > Model::get_config()
-                ->get_parasite_parameters()
-                .get_parasite_density_levels()
-                .get_log_parasite_density_asymptomatic()) {
+          > parameters.log_parasite_density_asymptomatic) {
         clinical_caused_parasite->set_last_update_log10_parasite_density(
-            Model::get_config()
-                ->get_parasite_parameters()
-                .get_parasite_density_levels()
-                .get_log_parasite_density_asymptomatic());
+            parameters.log_parasite_density_asymptomatic);
       }
       clinical_caused_parasite->set_update_function(Model::immunity_clearance_update_function());
     }
   }
 }
+
+namespace {
+std::unique_ptr<PersonEvent> create_event(EventTypeId type, Person* person) {
+  switch (type) {
+    case EventTypeId::BIRTHDAY:
+      return std::make_unique<BirthdayEvent>(person);
+    case EventTypeId::CIRCULATE_TO_TARGET_LOCATION_NEXT_DAY:
+      return std::make_unique<CirculateToTargetLocationNextDayEvent>(person);
+    case EventTypeId::END_CLINICAL:
+      return std::make_unique<EndClinicalEvent>(person);
+    case EventTypeId::MATURE_GAMETOCYTE:
+      return std::make_unique<MatureGametocyteEvent>(person);
+    case EventTypeId::MOVE_PARASITE_TO_BLOOD:
+      return std::make_unique<MoveParasiteToBloodEvent>(person);
+    case EventTypeId::PROGRESS_TO_CLINICAL:
+      return std::make_unique<ProgressToClinicalEvent>(person);
+    case EventTypeId::RAPT:
+      return std::make_unique<RaptEvent>(person);
+    case EventTypeId::RECEIVE_MDA_THERAPY:
+      return std::make_unique<ReceiveMDATherapyEvent>(person);
+    case EventTypeId::RECEIVE_THERAPY:
+      return std::make_unique<ReceiveTherapyEvent>(person);
+    case EventTypeId::REPORT_TREATMENT_FAILURE_DEATH:
+      return std::make_unique<ReportTreatmentFailureDeathEvent>(person);
+    case EventTypeId::RETURN_TO_RESIDENCE:
+      return std::make_unique<ReturnToResidenceEvent>(person);
+    case EventTypeId::SWITCH_IMMUNE_COMPONENT:
+      return std::make_unique<SwitchImmuneComponentEvent>(person);
+    case EventTypeId::TEST_TREATMENT_FAILURE:
+      return std::make_unique<TestTreatmentFailureEvent>(person);
+    case EventTypeId::UPDATE_WHEN_DRUG_IS_PRESENT:
+      return std::make_unique<UpdateWhenDrugIsPresentEvent>(person);
+    default:
+      throw std::runtime_error("Unknown event type in checkpoint");
+  }
+}
+}  // namespace
+
+void Person::checkpoint(utils::CheckpointArchive &archive) {
+  archive & age_ & location_ & residence_location_ & host_state_ & age_class_ & birthday_
+      & latest_update_time_ & moving_level_ & today_infections_ & today_target_locations_
+      & prob_present_at_mda_by_age_ & number_of_times_bitten_ & number_of_trips_taken_
+      & last_therapy_id_ & starting_drug_values_for_mac_ & innate_relative_biting_rate_
+      & current_relative_biting_rate_ & latest_time_received_public_treatment_
+      & recurrence_status_;
+#ifdef ENABLE_TRAVEL_TRACKING
+  archive & day_that_last_trip_was_initiated_ & day_that_last_trip_outside_district_was_initiated_;
+#endif
+
+  immune_system_->checkpoint(archive);
+  all_clonal_parasite_populations_->checkpoint(archive);
+  drugs_in_blood_->checkpoint(archive);
+  Checkpoint::genotype(archive, liver_parasite_type_);
+
+  // the events last since they refer to the parasites, cancelled ones included
+  auto &events = event_manager_.get_events();
+  const auto number_of_events = archive.size(events.size());
+  for (std::size_t i = 0; i < number_of_events; i++) {
+    auto type = EventTypeId::UNTAGGED;
+    auto time = 0;
+    auto executable = false;
+    if (!archive.is_loading()) {
+      const auto &event = events[i].second;
+      if (event->type_id() == EventTypeId::UNTAGGED) {
+        throw std::runtime_error("Event cannot be saved in a checkpoint: " + event->name());
+      }
+      type = event->type_id();
+      time = event->get_time();
+      executable = event->is_executable();
+    }
+    archive & type & time & executable;
+
+    if (archive.is_loading()) {
+      auto event = create_event(type, this);
+      event->set_time(time);
+      event->checkpoint(archive);
+      auto* scheduled_event = event.get();
+      event_manager_.schedule_event(std::move(event));
+      scheduled_event->set_executable(executable);
+    } else {
+      events[i].second->checkpoint(archive);
+    }
+  }
+}
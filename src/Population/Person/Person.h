@@ -11,10 +11,13 @@
 #include "Utils/Index/PersonIndexAllHandler.h"
 #include "Utils/Index/PersonIndexByLocationMovingLevelHandler.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClassHandler.h"
+#include "Utils/Index/PersonStoreHandler.h"
+#include "Utils/ObjectPool.h"
 
 class SCTherapy;
 
 namespace utils {
+class CheckpointArchive;
 class Random;
 }
 
@@ -24,8 +27,8 @@ class ImmuneSystem;
 
 class Person : public PersonIndexAllHandler,
                public PersonIndexByLocationStateAgeClassHandler,
-               public PersonIndexByLocationMovingLevelHandler {
-  // OBJECTPOOL(Person)
+               public PersonIndexByLocationMovingLevelHandler,
+               public PersonStoreHandler {
 public:
   // day_that_last_trip_outside_district_was_initiated_sable copy and assignment
   Person(const Person &) = delete;
@@ -36,6 +39,8 @@ public:
   Person();
   ~Person() override;
 
+  OBJECTPOOL(Person)
+
   enum RecurrenceStatus : uint8_t { NONE = 0, WITHOUT_SYMPTOM = 1, WITH_SYMPTOM = 2 };
 
   enum Property : uint8_t {
@@ -45,7 +50,9 @@ public:
     AGE_CLASS,
     BITING_LEVEL,
     MOVING_LEVEL,
-    EXTERNAL_POPULATION_MOVING_LEVEL
+    EXTERNAL_POPULATION_MOVING_LEVEL,
+    RELATIVE_BITING_RATE,
+    INFECTIOUS_DENSITY
   };
 
   enum HostStates : uint8_t {
@@ -82,7 +89,7 @@ public:
     event_manager_.cancel_all_events_except<T>(event);
   }
 
-  std::multimap<int, std::unique_ptr<PersonEvent>> &get_events() {
+  EventManager<PersonEvent>::EventList &get_events() {
     return event_manager_.get_events();
   }
 
@@ -90,6 +97,16 @@ public:
 
   void update();
 
+  // Daily update of a person whose parasite densities were already set and whose new immune
+  // value was evaluated by a PersonUpdateBatch
+  void update_with_evaluated_immunity(double immune_value);
+
+  /**
+   * Save or restore the individual with its immune system, parasites, drugs and events. The
+   * fields are assigned directly, a restored person is added to the population afterwards.
+   */
+  void checkpoint(utils::CheckpointArchive &archive);
+
   [[nodiscard]] Population* get_population() const { return population_; }
   void set_population(Population* population) { population_ = population; }
 
@@ -172,9 +189,7 @@ public:
   [[nodiscard]] double get_current_relative_biting_rate() const {
     return current_relative_biting_rate_;
   }
-  void set_current_relative_biting_rate(double current_relative_biting_rate) {
-    current_relative_biting_rate_ = current_relative_biting_rate;
-  }
+  void set_current_relative_biting_rate(double current_relative_biting_rate);
 
   [[nodiscard]] int get_latest_time_received_public_treatment() const {
     return latest_time_received_public_treatment_;
@@ -304,6 +319,12 @@ public:
   void schedule_end_clinical_by_no_treatment_event(ClonalParasitePopulation *clinical_caused_parasite);
 
 private:
+  // Drug concentrations and their effect on the parasites, shared by both daily updates
+  void update_drugs_in_blood();
+
+  // Host state, biting rate and update time at the end of the daily update
+  void finish_daily_update();
+
   int age_{-1};
   Population* population_{nullptr};
   int location_{-1};
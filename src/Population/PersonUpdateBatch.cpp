@@ -0,0 +1,175 @@
+#include "PersonUpdateBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+
+#include "ClinicalUpdateFunction.h"
+#include "ClonalParasitePopulation.h"
+#include "Configuration/HotParameters.h"
+#include "ImmuneSystem/ImmuneSystem.h"
+#include "ImmuneSystem/ImmunityClearanceUpdateFunction.h"
+#include "ImmuneSystem/InfantImmuneComponent.h"
+#include "ImmuneSystem/NonInfantImmuneComponent.h"
+#include "Parasites/Genotype.h"
+#include "Person/Person.h"
+#include "Simulation/Model.h"
+#include "SingleHostClonalParasitePopulations.h"
+
+namespace {
+// values below this are cut to zero by ImmuneComponent::get_current_value when decaying
+constexpr double IMMUNE_CUT_OFF = 0.00001;
+// NonInfantImmuneComponent::get_acquire_rate uses the rate of age 80 for the older persons
+constexpr int MAX_ACQUIRE_RATE_AGE =
+    static_cast<int>(HotParameters::NUMBER_OF_ACQUIRE_RATE_AGES) - 1;
+}  // namespace
+
+void PersonUpdateBatch::begin(int current_time, const HotParameters &parameters) {
+  clear();
+  current_time_ = current_time;
+  parameters_ = &parameters;
+  progress_to_clinical_function_ = Model::progress_to_clinical_update_function();
+  immunity_clearance_function_ = Model::immunity_clearance_update_function();
+  having_drug_function_ = Model::having_drug_update_function();
+  clinical_function_ = Model::clinical_update_function();
+}
+
+void PersonUpdateBatch::add(Person* person) {
+  if (person->get_latest_update_time() == current_time_) { return; }
+
+  auto* immune_system = person->get_immune_system();
+  auto* component = immune_system == nullptr ? nullptr : immune_system->immune_component();
+  const auto duration = current_time_ - person->get_latest_update_time();
+  // the regular update reports a negative duration and handles the derived immune systems
+  const bool is_batched = component != nullptr && duration > 0
+                          && typeid(*immune_system) == typeid(ImmuneSystem)
+                          && (typeid(*component) == typeid(InfantImmuneComponent)
+                              || typeid(*component) == typeid(NonInfantImmuneComponent));
+
+  persons_.push_back(person);
+  batched_.push_back(is_batched ? 1 : 0);
+  if (!is_batched) {
+    immune_latest_.push_back(0);
+    immune_rate_.push_back(0);
+    immune_duration_.push_back(0);
+    immune_increase_.push_back(0);
+    immune_cut_off_.push_back(0);
+    return;
+  }
+
+  const auto latest_value = component->latest_value();
+  immune_latest_.push_back(latest_value);
+  immune_duration_.push_back(duration);
+  if (typeid(*component) == typeid(InfantImmuneComponent)) {
+    // InfantImmuneComponent only decays, without cut off
+    immune_rate_.push_back(component->get_decay_rate(0));
+    immune_increase_.push_back(0);
+    immune_cut_off_.push_back(0);
+  } else if (immune_system->increase()) {
+    const auto age = std::min(static_cast<int>(person->get_age()), MAX_ACQUIRE_RATE_AGE);
+    immune_rate_.push_back(parameters_->acquire_rate_by_age[age]);
+    immune_increase_.push_back(1);
+    immune_cut_off_.push_back(0);
+  } else {
+    immune_rate_.push_back(parameters_->decay_rate);
+    immune_increase_.push_back(0);
+    immune_cut_off_.push_back(1);
+  }
+
+  add_parasites(person, duration, latest_value);
+}
+
+void PersonUpdateBatch::add_parasites(Person* person, double duration, double immune_value) {
+  for (auto &parasite : *person->get_all_clonal_parasite_populations()) {
+    auto* function = parasite.update_function();
+    if (function == nullptr) { continue; }
+
+    if (function == immunity_clearance_function_ || function == having_drug_function_
+        || function == clinical_function_) {
+      parasites_.push_back(&parasite);
+      parasite_log10_density_.push_back(parasite.last_update_log10_parasite_density());
+      parasite_duration_.push_back(duration);
+      parasite_immune_.push_back(immune_value);
+      parasite_fitness_.push_back(parasite.genotype()->daily_fitness_multiple_infection);
+    } else if (function == progress_to_clinical_function_) {
+      progressing_parasites_.push_back(&parasite);
+    } else {
+      other_parasites_.push_back(&parasite);
+    }
+  }
+}
+
+void PersonUpdateBatch::evaluate() {
+  // ImmuneComponent::get_current_value and InfantImmuneComponent::get_current_value, both
+  // branches are evaluated and selected so the loop has no control flow
+  const auto number_of_persons = persons_.size();
+  immune_value_.resize(number_of_persons);
+  const auto* latest = immune_latest_.data();
+  const auto* rate = immune_rate_.data();
+  const auto* immune_duration = immune_duration_.data();
+  const auto* increase = immune_increase_.data();
+  const auto* cut_off = immune_cut_off_.data();
+  auto* immune_value = immune_value_.data();
+  for (std::size_t i = 0; i < number_of_persons; i++) {
+    const auto factor = std::exp(-rate[i] * immune_duration[i]);
+    const auto value = increase[i] != 0 ? 1 - ((1 - latest[i]) * factor) : latest[i] * factor;
+    immune_value[i] = (cut_off[i] != 0 && value < IMMUNE_CUT_OFF) ? 0.0 : value;
+  }
+
+  // ImmuneSystem::get_parasite_size_after_t_days with the immune value before today's update
+  const auto number_of_parasites = parasites_.size();
+  parasite_new_log10_density_.resize(number_of_parasites);
+  const auto* log10_density = parasite_log10_density_.data();
+  const auto* parasite_duration = parasite_duration_.data();
+  const auto* immune = parasite_immune_.data();
+  const auto* fitness = parasite_fitness_.data();
+  auto* new_log10_density = parasite_new_log10_density_.data();
+  const auto c_max = parameters_->c_max;
+  const auto c_min = parameters_->c_min;
+  for (std::size_t i = 0; i < number_of_parasites; i++) {
+    const auto temp = (c_max * (1 - immune[i])) + (c_min * immune[i]);
+    new_log10_density[i] =
+        log10_density[i] + (parasite_duration[i] * (std::log10(temp) + std::log10(fitness[i])));
+  }
+}
+
+void PersonUpdateBatch::apply() {
+  for (std::size_t i = 0; i < parasites_.size(); i++) {
+    parasites_[i]->set_last_update_log10_parasite_density(parasite_new_log10_density_[i]);
+  }
+  for (auto* parasite : progressing_parasites_) {
+    parasite->set_last_update_log10_parasite_density(
+        parameters_->log_parasite_density_asymptomatic);
+  }
+  for (auto* parasite : other_parasites_) { parasite->update(); }
+
+  for (std::size_t i = 0; i < persons_.size(); i++) {
+    if (batched_[i] != 0) {
+      persons_[i]->update_with_evaluated_immunity(immune_value_[i]);
+    } else {
+      persons_[i]->update();
+    }
+  }
+  clear();
+}
+
+void PersonUpdateBatch::clear() {
+  persons_.clear();
+  batched_.clear();
+  immune_latest_.clear();
+  immune_rate_.clear();
+  immune_duration_.clear();
+  immune_increase_.clear();
+  immune_cut_off_.clear();
+  immune_value_.clear();
+
+  parasites_.clear();
+  parasite_log10_density_.clear();
+  parasite_duration_.clear();
+  parasite_immune_.clear();
+  parasite_fitness_.clear();
+  parasite_new_log10_density_.clear();
+
+  progressing_parasites_.clear();
+  other_parasites_.clear();
+}
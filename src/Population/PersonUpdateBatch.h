@@ -0,0 +1,92 @@
+#ifndef PERSONUPDATEBATCH_H
+#define PERSONUPDATEBATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ClonalParasitePopulation;
+class ParasiteDensityUpdateFunction;
+class Person;
+struct HotParameters;
+
+/**
+ * @class PersonUpdateBatch
+ * @brief Daily update of many persons with the parasite density and immune formulas evaluated
+ * over contiguous arrays.
+ *
+ * Person::update() evaluates the density of each clone through its virtual update function and
+ * the immune value through the immune component, one person at a time and with configuration
+ * lookups inside. The batch gathers the inputs of these formulas for all the persons of a
+ * location, evaluates them with the HotParameters it is given in branch-free loops the compiler
+ * can vectorize, writes the densities back and then finishes the update of each person in the order they were added. The formulas
+ * are the ones of ImmuneSystem, ImmuneComponent and the Model update functions written in the
+ * same order, so the results match Person::update(). Persons with another kind of immune system
+ * or component, and clones with another update function, go through the regular virtual calls.
+ */
+class PersonUpdateBatch {
+public:
+  // Start the update of @current_time, @parameters must outlive the batch until apply()
+  void begin(int current_time, const HotParameters &parameters);
+
+  // Queue @person, a person already updated today is left out
+  void add(Person* person);
+
+  // Evaluate the parasite densities and the immune values of the queued persons
+  void evaluate();
+
+  // Write the densities back and finish the daily update of every queued person, then clear
+  void apply();
+
+  void clear();
+
+  [[nodiscard]] std::size_t size() const { return persons_.size(); }
+  [[nodiscard]] Person* person(std::size_t index) const { return persons_[index]; }
+  // Evaluated immune value of the person, only meaningful for a batched person
+  [[nodiscard]] double immune_value(std::size_t index) const { return immune_value_[index]; }
+  [[nodiscard]] bool is_batched(std::size_t index) const { return batched_[index] != 0; }
+
+  [[nodiscard]] std::size_t number_of_parasites() const { return parasites_.size(); }
+  [[nodiscard]] ClonalParasitePopulation* parasite(std::size_t index) const {
+    return parasites_[index];
+  }
+  // Evaluated log10 density of the clone
+  [[nodiscard]] double parasite_density(std::size_t index) const {
+    return parasite_new_log10_density_[index];
+  }
+
+private:
+  void add_parasites(Person* person, double duration, double immune_value);
+
+  int current_time_{0};
+  const HotParameters* parameters_{nullptr};
+  ParasiteDensityUpdateFunction* progress_to_clinical_function_{nullptr};
+  ParasiteDensityUpdateFunction* immunity_clearance_function_{nullptr};
+  ParasiteDensityUpdateFunction* having_drug_function_{nullptr};
+  ParasiteDensityUpdateFunction* clinical_function_{nullptr};
+
+  // one entry per person, in the order they were added
+  std::vector<Person*> persons_;
+  std::vector<std::uint8_t> batched_;
+  std::vector<double> immune_latest_;
+  std::vector<double> immune_rate_;
+  std::vector<double> immune_duration_;
+  std::vector<std::uint8_t> immune_increase_;
+  std::vector<std::uint8_t> immune_cut_off_;
+  std::vector<double> immune_value_;
+
+  // clones whose density is c_max/c_min immunity clearance
+  std::vector<ClonalParasitePopulation*> parasites_;
+  std::vector<double> parasite_log10_density_;
+  std::vector<double> parasite_duration_;
+  std::vector<double> parasite_immune_;
+  std::vector<double> parasite_fitness_;
+  std::vector<double> parasite_new_log10_density_;
+
+  // clones progressing to clinical, their density is set to the asymptomatic level
+  std::vector<ClonalParasitePopulation*> progressing_parasites_;
+  // clones with another update function, updated through it
+  std::vector<ClonalParasitePopulation*> other_parasites_;
+};
+
+#endif  // PERSONUPDATEBATCH_H
@@ -4,8 +4,13 @@
 #include <Utils/Random.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cfloat>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <numeric>
+#include <stdexcept>
 
 #include "ClinicalUpdateFunction.h"
 #include "Configuration/Config.h"
@@ -18,16 +23,24 @@
 #include "MDC/ModelDataCollector.h"
 #include "Mosquito/Mosquito.h"
 #include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Person/Person.h"
+#include "Spatial/Movement/DestinationDistributionCache.h"
+#include "Utils/AliasTable.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Constants.h"
 #include "Utils/Index/PersonIndex.h"
 #include "Utils/Index/PersonIndexAll.h"
 #include "Utils/Index/PersonIndexByLocationMovingLevel.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/Index/PersonStore.h"
+#include "Utils/ThreadPool.h"
 
 Population::Population() {
   person_index_list_ = std::make_unique<PersonIndexPtrList>();
 
+  timing_wheel_ = std::make_unique<TimingWheel>();
+
   all_persons_ = std::make_unique<PersonIndexAll>();
 }
 
@@ -46,39 +59,49 @@ Population::~Population() {
   }
 }
 
-void Population::initialize() {
-  if (Model::get_instance() != nullptr) {
-    all_persons_->clear();
-    // those vector will be used in the initial infection
-    const auto number_of_locations = Model::get_config()->number_of_locations();
+void Population::initialize_empty() {
+  all_persons_->clear();
+  // those vector will be used in the initial infection
+  const auto number_of_locations = Model::get_config()->number_of_locations();
 
-    // Prepare the population size vector
-    popsize_by_location_ = IntVector(number_of_locations, 0);
+  // Prepare the population size vector
+  popsize_by_location_ = IntVector(number_of_locations, 0);
 
-    individual_relative_biting_by_location_ =
-        std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
-    individual_relative_moving_by_location_ =
-        std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
-    individual_foi_by_location_ =
-        std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
+  individual_relative_biting_by_location_ =
+      std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
+  individual_relative_moving_by_location_ =
+      std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
+  individual_foi_by_location_ =
+      std::vector<std::vector<double>>(number_of_locations, std::vector<double>());
 
-    all_alive_persons_by_location_ =
-        std::vector<std::vector<Person*>>(number_of_locations, std::vector<Person*>());
+  all_alive_persons_by_location_ =
+      std::vector<std::vector<Person*>>(number_of_locations, std::vector<Person*>());
 
-    sum_relative_biting_by_location_ = std::vector<double>(number_of_locations, 0);
-    sum_relative_moving_by_location_ = std::vector<double>(number_of_locations, 0);
+  sum_relative_biting_by_location_ = std::vector<double>(number_of_locations, 0);
+  sum_relative_moving_by_location_ = std::vector<double>(number_of_locations, 0);
 
-    current_force_of_infection_by_location_ = std::vector<double>(number_of_locations, 0);
+  current_force_of_infection_by_location_ = std::vector<double>(number_of_locations, 0);
 
-    force_of_infection_for_n_days_by_location_ =
-        std::vector<std::vector<double>>(Model::get_config()->number_of_tracking_days(),
-                                         std::vector<double>(number_of_locations, 0));
+  force_of_infection_for_n_days_by_location_ =
+      std::vector<std::vector<double>>(Model::get_config()->number_of_tracking_days(),
+                                       std::vector<double>(number_of_locations, 0));
 
-    // initalize person indexes
-    initialize_person_indices();
+  // initalize person indexes
+  initialize_person_indices();
+}
 
-    // Initialize population
+void Population::initialize() {
+  if (Model::get_instance() != nullptr) {
+    initialize_empty();
+    const auto number_of_locations = Model::get_config()->number_of_locations();
+
+    // Number of individuals by location and age class, the last age class takes the remainder
     auto &location_db = Model::get_config()->location_db();
+    const auto &initial_age_structure =
+        Model::get_config()->get_population_demographic().get_initial_age_structure();
+    std::vector<IntVector> individuals_by_location_age_class(
+        number_of_locations, IntVector(initial_age_structure.size(), 0));
+    std::size_t total_population = 0;
     for (auto loc = 0; loc < number_of_locations; loc++) {
       const auto popsize_by_location =
           static_cast<int>(location_db[loc].population_size
@@ -86,34 +109,106 @@ void Population::initialize() {
                                  ->get_population_demographic()
                                  .get_artificial_rescaling_of_population_size());
       auto temp_sum = 0;
-      for (auto age_class = 0;
-           age_class
-           < Model::get_config()->get_population_demographic().get_initial_age_structure().size();
-           age_class++) {
+      for (auto age_class = 0; age_class < initial_age_structure.size(); age_class++) {
         auto number_of_individual_by_loc_ageclass = 0;
-        if (age_class
-            == Model::get_config()->get_population_demographic().get_initial_age_structure().size()
-                   - 1) {
+        if (age_class == initial_age_structure.size() - 1) {
           number_of_individual_by_loc_ageclass = popsize_by_location - temp_sum;
         } else {
           number_of_individual_by_loc_ageclass =
               static_cast<int>(popsize_by_location * location_db[loc].age_distribution[age_class]);
           temp_sum += number_of_individual_by_loc_ageclass;
         }
-        // spdlog::info("generate {} individuals for age class {}",
-        //              number_of_individual_by_loc_ageclass, age_class);
-        for (int i = 0; i < number_of_individual_by_loc_ageclass; i++) {
-          generate_individual(loc, age_class);
+        individuals_by_location_age_class[loc][age_class] = number_of_individual_by_loc_ageclass;
+      }
+
+      // the sizes are known, reserve instead of growing the vectors one person at a time
+      individual_relative_biting_by_location_[loc].reserve(popsize_by_location);
+      individual_relative_moving_by_location_[loc].reserve(popsize_by_location);
+      all_alive_persons_by_location_[loc].reserve(popsize_by_location);
+      total_population += popsize_by_location;
+    }
+    all_persons_->reserve(total_population);
+
+    // Initialize population
+    const auto number_of_threads =
+        Model::get_config()->get_model_settings().get_number_of_threads();
+    generate_initial_population(number_of_threads, individuals_by_location_age_class);
+  }
+}
+
+void Population::generate_initial_population(
+    int number_of_threads, const std::vector<IntVector> &individuals_by_location_age_class) {
+  const auto number_of_locations = static_cast<int>(individuals_by_location_age_class.size());
+
+  if (number_of_threads > 1
+      && (thread_pool_ == nullptr
+          || thread_pool_->size() != static_cast<std::size_t>(number_of_threads))) {
+    thread_pool_ = std::make_unique<utils::ThreadPool>(number_of_threads);
+  }
+
+  // Streams of the days before the simulation starts, the daily updates use day >= 0
+  reset_location_randoms(number_of_locations, -1);
+
+  // The shared moving level generator hands out a pre-shuffled chunk and is not thread safe, the
+  // locations draw the levels from their own stream instead
+  const utils::AliasTable moving_levels(
+      Model::get_config()->get_movement_settings().get_v_moving_level_density());
+
+  std::vector<std::vector<std::unique_ptr<Person>>> individuals_by_location(number_of_locations);
+  auto create_location = [&](int location) {
+    Model::set_thread_random(location_randoms_[location].get());
+    try {
+      auto &individuals = individuals_by_location[location];
+      const auto &individuals_by_age_class = individuals_by_location_age_class[location];
+      individuals.reserve(
+          std::accumulate(individuals_by_age_class.begin(), individuals_by_age_class.end(), 0));
+      for (auto age_class = 0; age_class < individuals_by_age_class.size(); age_class++) {
+        for (auto i = 0; i < individuals_by_age_class[age_class]; i++) {
+          individuals.push_back(create_individual(age_class, &moving_levels));
         }
       }
-      popsize_by_location_[loc] = popsize_by_location;
-      // spdlog::info("individual_relative_moving_by_location[{}] size: {} sum: {}",loc,
-      //              individual_relative_moving_by_location[loc].size(),
-      //              sum_relative_moving_by_location[loc]);
+    } catch (...) {
+      Model::set_thread_random(nullptr);
+      throw;
+    }
+    Model::set_thread_random(nullptr);
+  };
+
+  // the person indexes and the data collector are shared, add the individuals on this thread
+  auto add_location = [&](int location) {
+    for (auto &person : individuals_by_location[location]) {
+      add_initial_individual(std::move(person), location);
+    }
+    individuals_by_location[location].clear();
+    individuals_by_location[location].shrink_to_fit();
+  };
+
+  if (number_of_threads > 1) {
+    thread_pool_->parallel_for(0, number_of_locations, create_location);
+    for (auto loc = 0; loc < number_of_locations; loc++) { add_location(loc); }
+  } else {
+    // same streams and order, one location at a time keeps only one location pending
+    for (auto loc = 0; loc < number_of_locations; loc++) {
+      create_location(loc);
+      add_location(loc);
     }
   }
 }
 
+void Population::reset_location_randoms(int number_of_locations, int day) {
+  // the generators are created once and reseeded in place afterwards
+  if (location_randoms_.size() != static_cast<std::size_t>(number_of_locations)) {
+    location_randoms_.clear();
+    for (auto loc = 0; loc < number_of_locations; loc++) {
+      location_randoms_.push_back(Model::get_random()->substream(loc, day));
+    }
+    return;
+  }
+  for (auto loc = 0; loc < number_of_locations; loc++) {
+    Model::get_random()->reset_substream(*location_randoms_[loc], loc, day);
+  }
+}
+
 void Population::initialize_person_indices() {
   const int number_of_location = Model::get_config()->number_of_locations();
   const int number_of_host_states = Person::NUMBER_OF_STATE;
@@ -129,6 +224,14 @@ void Population::initialize_person_indices() {
                               .get_circulation_info()
                               .get_number_of_moving_levels());
   person_index_list_->push_back(std::move(p_index_location_moving_level));
+
+  auto person_store = std::make_unique<PersonStore>(number_of_location);
+  if (Model::get_config()->get_model_settings().get_incremental_force_of_infection()) {
+    person_store->track_weights(
+        Model::get_config()->get_movement_settings().get_v_moving_level_value());
+  }
+  person_store_ = person_store.get();
+  person_index_list_->push_back(std::move(person_store));
 }
 
 void Population::add_person(std::unique_ptr<Person> person) {
@@ -136,6 +239,9 @@ void Population::add_person(std::unique_ptr<Person> person) {
   person->set_population(this);
   for (auto &person_index : *person_index_list_) { person_index->add(person.get()); }
 
+  // events scheduled before the person joined the population
+  for (auto &[time, event] : person->get_events()) { timing_wheel_->schedule(event.get()); }
+
   // Update the count at the location
   popsize_by_location_[person->get_location()]++;
   // all_persons will take ownership
@@ -221,7 +327,9 @@ void Population::perform_infection_event() {
   const auto tracking_index =
       Model::get_scheduler()->current_time() % Model::get_config()->number_of_tracking_days();
 
-  for (int loc = 0; loc < Model::get_config()->number_of_locations(); ++loc) {
+  const auto number_of_locations = Model::get_config()->number_of_locations();
+  bite_poisson_means_.assign(number_of_locations, 0.0);
+  for (int loc = 0; loc < number_of_locations; ++loc) {
     const double foi = force_of_infection_for_n_days_by_location_[tracking_index][loc];
     if (foi <= DBL_EPSILON) continue;
 
@@ -230,15 +338,20 @@ void Population::perform_infection_event() {
         Model::get_config()->get_seasonality_settings().get_seasonal_factor(
             Model::get_scheduler()->get_calendar_date(), loc);
 
-    const double poisson_means = new_beta * foi;
-    const int number_of_bites = Model::get_random()->random_poisson(poisson_means);
+    bite_poisson_means_[loc] = new_beta * foi;
+  }
+  number_of_bites_by_location_.resize(number_of_locations);
+  Model::get_random()->fill_poisson(bite_poisson_means_, number_of_bites_by_location_);
+
+  for (int loc = 0; loc < number_of_locations; ++loc) {
+    const int number_of_bites = number_of_bites_by_location_[loc];
     if (number_of_bites <= 0) continue;
 
     // Stats
     Model::get_mdc()->collect_number_of_bites(loc, number_of_bites);
 
     // Sampling guards
-    if (all_alive_persons_by_location_[loc].empty()) {
+    if (number_of_alive_persons(loc) == 0) {
       spdlog::trace("all_alive_persons_by_location location {} is empty", loc);
       continue;
     }
@@ -248,12 +361,8 @@ void Population::perform_infection_event() {
     }
 
     // Draw bite recipients
-    auto persons_bitten_today = Model::get_random()->roulette_sampling<Person>(
-        number_of_bites,
-        individual_relative_biting_by_location_[loc],
-        all_alive_persons_by_location_[loc],
-        /*allow_repetition=*/false,
-        sum_relative_biting_by_location_[loc]);
+    auto persons_bitten_today = sample_alive_persons(
+        Model::get_random(), PersonStore::RELATIVE_BITING, loc, number_of_bites, false);
 
     // Early guard on mosquito table
     if (Model::get_mosquito()->genotypes_table[tracking_index][loc].empty()) {
@@ -264,17 +373,23 @@ void Population::perform_infection_event() {
     const bool use_challenge =
         Model::get_config()->get_transmission_settings().get_transmission_parameter() > 0.0;
 
-    for (auto* person : persons_bitten_today) {
+    // Two uniforms per bite, the mosquito genotype and the infection draw
+    bite_uniform_draws_.resize(2 * persons_bitten_today.size());
+    Model::get_random()->fill_uniform(bite_uniform_draws_);
+
+    for (std::size_t bite = 0; bite < persons_bitten_today.size(); ++bite) {
+      auto* person = persons_bitten_today[bite];
       assert(person->get_host_state() != Person::DEAD);
       if (!use_challenge) {
         person->increase_number_of_times_bitten();
       }
 
-      const int genotype_id = Model::get_mosquito()->random_genotype(loc, tracking_index);
+      const int genotype_id = Model::get_mosquito()->random_genotype(
+          loc, tracking_index, bite_uniform_draws_[2 * bite]);
       if (genotype_id < 0) continue; // extra safety
 
       // Draw once per bite
-      const double draw = Model::get_random()->random_flat(0.0, 1.0);
+      const double draw = bite_uniform_draws_[(2 * bite) + 1];
 
       bool infected = false;
       if (use_challenge) {
@@ -325,12 +440,11 @@ void Population::perform_infection_event() {
 }
 
 
-void Population::generate_individual(int location, int age_class) {
+std::unique_ptr<Person> Population::create_individual(int age_class,
+                                                      const utils::AliasTable* moving_levels) {
   auto person = std::make_unique<Person>();
   person->initialize();
 
-  person->set_location(location);
-  person->set_residence_location(location);
   person->set_host_state(Person::SUSCEPTIBLE);
 
   // Set the age of the individual, which also sets the age class. Note that we
@@ -387,7 +501,9 @@ void Population::generate_individual(int location, int age_class) {
   // Cache the moving level to avoid repeated lookups
   auto &movement_settings = Model::get_config()->get_movement_settings();
   person->set_moving_level(
-      movement_settings.get_moving_level_generator().draw_random_level(Model::get_random()));
+      moving_levels != nullptr
+          ? static_cast<int>(moving_levels->sample(Model::get_random()))
+          : movement_settings.get_moving_level_generator().draw_random_level(Model::get_random()));
 
   person->set_latest_update_time(0);
 
@@ -395,11 +511,18 @@ void Population::generate_individual(int location, int age_class) {
 
   // spdlog::info("Population::initialize: person {} age {} location {} moving level {}",
   //   i, p->get_age(), loc, p->get_moving_level());
+  return person;
+}
+
+void Population::add_initial_individual(std::unique_ptr<Person> person, int location) {
+  person->set_location(location);
+  person->set_residence_location(location);
 
   // Get current values once to avoid repeated calls
   const auto current_relative_biting_rate = person->get_current_relative_biting_rate();
   const auto moving_level = person->get_moving_level();
-  const auto &moving_level_value = movement_settings.get_v_moving_level_value()[moving_level];
+  const auto &moving_level_value =
+      Model::get_config()->get_movement_settings().get_v_moving_level_value()[moving_level];
 
   individual_relative_biting_by_location_[location].push_back(current_relative_biting_rate);
   individual_relative_moving_by_location_[location].push_back(moving_level_value);
@@ -443,14 +566,13 @@ void Population::introduce_initial_cases() {
 
 void Population::introduce_parasite(const int &location, Genotype* parasite_type,
                                     const int &num_of_infections) {
-  if (all_alive_persons_by_location_[location].empty()) {
+  if (number_of_alive_persons(location) == 0) {
     // spdlog::debug("introduce_parasite all_alive_persons_by_location location {} is empty",
     // location);
     return;
   }
-  auto persons_bitten_today = Model::get_random()->roulette_sampling<Person>(
-      num_of_infections, individual_relative_biting_by_location_[location],
-      all_alive_persons_by_location_[location], false);
+  auto persons_bitten_today = sample_alive_persons(
+      Model::get_random(), PersonStore::RELATIVE_BITING, location, num_of_infections, false);
 
   for (auto* person : persons_bitten_today) { setup_initial_infection(person, parasite_type); }
 }
@@ -613,6 +735,8 @@ void Population::perform_circulation_event() {
     //        std::cout << v_original_pop_size_by_location[target_location] << std::endl;
   }
 
+  refresh_destination_distributions(v_number_of_residents_by_location);
+
   for (int from_location = 0; from_location < Model::get_config()->number_of_locations();
        from_location++) {
     auto poisson_means = static_cast<double>(size(from_location))
@@ -625,6 +749,28 @@ void Population::perform_circulation_event() {
         Model::get_random()->random_poisson(poisson_means);
     if (number_of_circulating_from_this_location == 0) continue;
 
+    if (destination_cache_ != nullptr) {
+      // one alias draw per traveler, then the travelers are grouped by destination
+      traveler_destinations_.clear();
+      destination_cache_->sample(Model::get_random(), from_location,
+                                 static_cast<int>(number_of_circulating_from_this_location),
+                                 traveler_destinations_);
+      std::ranges::sort(traveler_destinations_);
+      for (std::size_t first = 0; first < traveler_destinations_.size();) {
+        auto last = first;
+        while (last < traveler_destinations_.size()
+               && traveler_destinations_[last] == traveler_destinations_[first]) {
+          last++;
+        }
+        perform_circulation_for_1_location(from_location, traveler_destinations_[first],
+                                           static_cast<int>(last - first), today_circulations);
+        first = last;
+      }
+      continue;
+    }
+
+    const auto &relative_distance_vector = distance_row(from_location);
+
     DoubleVector v_relative_outmovement_to_destination(Model::get_config()->number_of_locations(),
                                                        0);
     v_relative_outmovement_to_destination =
@@ -633,10 +779,7 @@ void Population::perform_circulation_event() {
             .get_spatial_model()
             ->get_v_relative_out_movement_to_destination(
                 from_location, Model::get_config()->number_of_locations(),
-                Model::get_config()
-                    ->get_spatial_settings()
-                    .get_spatial_distance_matrix()[from_location],
-                v_number_of_residents_by_location);
+                relative_distance_vector, v_number_of_residents_by_location);
 
     std::vector<unsigned int> v_num_leavers_to_destination(
         static_cast<uint64_t>(Model::get_config()->number_of_locations()));
@@ -668,6 +811,42 @@ void Population::perform_circulation_event() {
   today_circulations.clear();
 }
 
+void Population::refresh_destination_distributions(const IntVector &residents_by_location) {
+  const auto &circulation_info = Model::get_config()->get_movement_settings().get_circulation_info();
+  if (circulation_info.get_destination_cache_tolerance() > 0) {
+    if (destination_cache_ == nullptr
+        || destination_cache_->get_tolerance() != circulation_info.get_destination_cache_tolerance()) {
+      destination_cache_ = std::make_unique<Spatial::DestinationDistributionCache>(
+          circulation_info.get_destination_cache_tolerance());
+    }
+    if (destination_cache_->refresh(
+            *Model::get_config()->get_movement_settings().get_spatial_model(),
+            residents_by_location, [this](int from_location) -> const DoubleVector & {
+              return distance_row(from_location);
+            })) {
+      spdlog::debug("Destination distributions rebuilt at day {}",
+                    Model::get_scheduler()->current_time());
+    }
+  } else {
+    destination_cache_.reset();
+  }
+}
+
+const DoubleVector &Population::distance_row(int from_location) {
+  // with a distance cutoff the distance row is rebuilt from the neighbor list of each location
+  auto &spatial_settings = Model::get_config()->get_spatial_settings();
+  const auto &sparse_distances = spatial_settings.get_sparse_distance_matrix();
+  if (sparse_distances.empty()) {
+    return spatial_settings.get_spatial_distance_matrix()[from_location];
+  }
+  sparse_distances.fill_row(from_location, sparse_distance_row_);
+  return sparse_distance_row_;
+}
+
+void Population::invalidate_destination_distributions() {
+  if (destination_cache_ != nullptr) { destination_cache_->invalidate(); }
+}
+
 void Population::perform_circulation_for_1_location(const int &from_location,
                                                     const int &target_location,
                                                     const int &number_of_circulations,
@@ -677,10 +856,9 @@ void Population::perform_circulation_for_1_location(const int &from_location,
   //              individual_relative_moving_by_location[target_location].size(),
   //              sum_relative_moving_by_location[target_location]);
 
-  auto persons_moving_today = Model::get_random()->roulette_sampling<Person>(
-      number_of_circulations, individual_relative_moving_by_location_[from_location],
-      all_alive_persons_by_location_[from_location], false,
-      sum_relative_moving_by_location_[from_location]);
+  auto persons_moving_today =
+      sample_alive_persons(Model::get_random(), PersonStore::RELATIVE_MOVING, from_location,
+                           number_of_circulations, false);
 
   for (auto* person : persons_moving_today) {
     assert(person->get_host_state() != Person::DEAD);
@@ -716,24 +894,62 @@ bool Population::has_0_case() {
 }
 
 void Population::update_all_individuals() {
-  // update all individuals
+  const auto number_of_threads =
+      Model::get_config()->get_model_settings().get_number_of_threads();
+  const auto number_of_locations = Model::get_config()->number_of_locations();
+
+  if (number_of_threads > 1
+      && (thread_pool_ == nullptr
+          || thread_pool_->size() != static_cast<std::size_t>(number_of_threads))) {
+    thread_pool_ = std::make_unique<utils::ThreadPool>(number_of_threads);
+  }
+
+  // Each location draws from its own counter-based stream for the day, so the draws only depend
+  // on the model seed, the location and the day, whether the locations run on one thread or many
+  reset_location_randoms(number_of_locations, Model::get_scheduler()->current_time());
+  update_batches_.resize(number_of_locations);
+
+  auto update_location = [this](int location) {
+    Model::set_thread_random(location_randoms_[location].get());
+    try {
+      update_individuals_at_location(location);
+    } catch (...) {
+      Model::set_thread_random(nullptr);
+      throw;
+    }
+    Model::set_thread_random(nullptr);
+  };
+
+  // Individuals only touch the person indexes of their own location during the update. The
+  // genotype database and the mutation tracker are shared, new genotypes are kept pending and
+  // registered once all locations are done.
+  Model::get_genotype_db()->begin_deferred_registration();
+  std::exception_ptr exception;
+  try {
+    if (number_of_threads > 1) {
+      thread_pool_->parallel_for(0, number_of_locations, update_location);
+    } else {
+      for (auto loc = 0; loc < number_of_locations; loc++) { update_location(loc); }
+    }
+  } catch (...) { exception = std::current_exception(); }
+  Model::get_genotype_db()->commit_pending_genotypes();
+  Model::get_mdc()->flush_pending_mutations_by_drug();
+
+  if (exception) { std::rethrow_exception(exception); }
+}
+
+void Population::update_individuals_at_location(int location) {
   auto* pi = get_person_index<PersonIndexByLocationStateAgeClass>();
-  for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-    for (int hs = 0; hs < Person::DEAD; hs++) {
-      for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
-        for (auto* person : pi->vPerson()[loc][hs][ac]) { person->update(); }
-      }
+  // gather first, the update moves persons between the index vectors
+  auto &batch = update_batches_[location];
+  batch.begin(Model::get_scheduler()->current_time(), Model::get_config()->hot_parameters());
+  for (int hs = 0; hs < Person::DEAD; hs++) {
+    for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+      for (auto* person : pi->vPerson()[location][hs][ac]) { batch.add(person); }
     }
   }
-  // if (all_persons_ == nullptr) {
-  //   throw std::runtime_error("PersonIndexAll not found in Population::update_all_individuals");
-  // }
-  // for (auto &person_ptr : all_persons_->v_person()) {
-  //   if (person_ptr) {
-  //     if (person_ptr->get_host_state() == Person::DEAD) { continue; }
-  //     person_ptr->update();
-  //   }
-  // }
+  batch.evaluate();
+  batch.apply();
 }
 
 // TODO: it should be called "execute_all_individual_events" for an input time
@@ -742,11 +958,18 @@ void Population::execute_all_individual_events(int up_to_time) {
     throw std::runtime_error(
         "PersonIndexAll not found in Population::update_all_individual_events");
   }
-  for (auto &person_ptr : all_persons_->v_person()) {
-    if (person_ptr) {  // Optional check for the unique_ptr itself
-      if (person_ptr->get_host_state() == Person::DEAD) { continue; }
-      person_ptr->update_events(up_to_time);
-    }
+  // only visit the persons having events due today, in the same order as PersonIndexAll
+  persons_with_due_events_.clear();
+  timing_wheel_->collect_due_persons(up_to_time, persons_with_due_events_);
+  std::ranges::sort(persons_with_due_events_, [](Person* lhs, Person* rhs) {
+    return lhs->PersonIndexAllHandler::get_index() < rhs->PersonIndexAllHandler::get_index();
+  });
+  const auto [first, last] = std::ranges::unique(persons_with_due_events_);
+  persons_with_due_events_.erase(first, last);
+
+  for (auto* person : persons_with_due_events_) {
+    if (person->get_host_state() == Person::DEAD) { continue; }
+    person->update_events(up_to_time);
   }
 }
 
@@ -759,59 +982,176 @@ void Population::persist_current_force_of_infection_to_use_n_days_later() {
 }
 
 void Population::update_current_foi() {
-  auto* pi = get_person_index<PersonIndexByLocationStateAgeClass>();
+  if (is_incremental_force_of_infection()) {
+    // the weights are updated by every change, only drop the accumulated rounding once a year
+    if (Model::get_scheduler()->current_time() % Constants::DAYS_IN_YEAR == 0) {
+      person_store_->rebuild_weights();
+    }
+    for (int location = 0; location < Model::get_config()->number_of_locations(); location++) {
+      current_force_of_infection_by_location_[location] =
+          person_store_->total_weight(PersonStore::FORCE_OF_INFECTION, location);
+      sum_relative_biting_by_location_[location] =
+          person_store_->total_weight(PersonStore::RELATIVE_BITING, location);
+      sum_relative_moving_by_location_[location] =
+          person_store_->total_weight(PersonStore::RELATIVE_MOVING, location);
+    }
+    return;
+  }
+
+  const auto &moving_level_values =
+      Model::get_config()->get_movement_settings().get_v_moving_level_value();
   for (int location = 0; location < Model::get_config()->number_of_locations(); location++) {
-    // spdlog::info("location {} pop {}", location, size(location));
-    // reset force of infection for each location
-    current_force_of_infection_by_location_[location] = 0.0;
-    sum_relative_biting_by_location_[location] = 0.0;
-    sum_relative_moving_by_location_[location] = 0.0;
+    const auto &columns = person_store_->columns_at(location);
+    const auto number_of_slots = columns.size();
 
     // using clear so as system will not reallocate memory slot for vector
-    individual_foi_by_location_[location].clear();
-    individual_relative_biting_by_location_[location].clear();
-    individual_relative_moving_by_location_[location].clear();
-    all_alive_persons_by_location_[location].clear();
+    auto &individual_foi = individual_foi_by_location_[location];
+    auto &individual_relative_biting = individual_relative_biting_by_location_[location];
+    auto &individual_relative_moving = individual_relative_moving_by_location_[location];
+    auto &all_alive_persons = all_alive_persons_by_location_[location];
+    individual_foi.clear();
+    individual_relative_biting.clear();
+    individual_relative_moving.clear();
+    all_alive_persons.clear();
+
+    // one linear pass over the columns of the location, dead persons are skipped
+    for (std::size_t slot = 0; slot < number_of_slots; slot++) {
+      if (columns.host_states[slot] == Person::DEAD) { continue; }
+      all_alive_persons.push_back(columns.persons[slot]);
+      individual_relative_biting.push_back(columns.relative_biting_rates[slot]);
+      individual_relative_moving.push_back(moving_level_values[columns.moving_levels[slot]]);
+      individual_foi.push_back(columns.log10_infectious_densities[slot]);
+    }
 
-    for (int hs = 0; hs < Person::DEAD; hs++) {
-      for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
-        // spdlog::info("There are {} individuals in location {} with host state {} and age class
-        // {}", pi->vPerson()[location][hs][ac].size(), location, hs, ac); for (std::size_t i = 0; i
-        // < pi->vPerson()[location][hs][ac].size(); i++) { Person* person =
-        // pi->vPerson()[location][hs][ac][i];
-        for (auto* person : (pi->vPerson()[location][hs][ac])) {
-          double log_10_total_infectious_density =
-              person->get_all_clonal_parasite_populations()->log10_total_infectious_density();
-          const auto person_relative_biting_rate = person->get_current_relative_biting_rate();
-          auto individual_foi =
-              log_10_total_infectious_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY
-                  ? 0.0
-                  : person_relative_biting_rate
-                        * Person::relative_infectivity(log_10_total_infectious_density);
-
-          individual_foi_by_location_[location].push_back(individual_foi);
-          individual_relative_biting_by_location_[location].push_back(person_relative_biting_rate);
-          const auto &moving_level_value =
-              Model::get_config()
-                  ->get_movement_settings()
-                  .get_v_moving_level_value()[person->get_moving_level()];
-          individual_relative_moving_by_location_[location].push_back(moving_level_value);
-
-          sum_relative_biting_by_location_[location] += person_relative_biting_rate;
-          sum_relative_moving_by_location_[location] += moving_level_value;
-          current_force_of_infection_by_location_[location] += individual_foi;
-          all_alive_persons_by_location_[location].push_back(person);
-          // spdlog::info("person {} individual_relative_biting_by_location[{}]
-          // {}",person->get_id(), location,
-          //              individual_relative_biting_by_location[location].back());
-        }
-      }
+    // separate passes over the compacted columns, the sums carry no branch
+    double sum_relative_biting = 0.0;
+    double sum_relative_moving = 0.0;
+    double force_of_infection = 0.0;
+    const auto number_of_alive_persons = all_alive_persons.size();
+    for (std::size_t i = 0; i < number_of_alive_persons; i++) {
+      sum_relative_biting += individual_relative_biting[i];
+      sum_relative_moving += individual_relative_moving[i];
+    }
+    for (std::size_t i = 0; i < number_of_alive_persons; i++) {
+      const auto log_10_total_infectious_density = individual_foi[i];
+      individual_foi[i] =
+          log_10_total_infectious_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY
+              ? 0.0
+              : individual_relative_biting[i]
+                    * Person::relative_infectivity(log_10_total_infectious_density);
+      force_of_infection += individual_foi[i];
+    }
+
+    sum_relative_biting_by_location_[location] = sum_relative_biting;
+    sum_relative_moving_by_location_[location] = sum_relative_moving;
+    current_force_of_infection_by_location_[location] = force_of_infection;
+  }
+}
+
+std::size_t Population::number_of_alive_persons(int location) const {
+  if (is_incremental_force_of_infection()) {
+    return person_store_->number_of_alive_persons(location);
+  }
+  return all_alive_persons_by_location_[location].size();
+}
+
+std::vector<Person*> Population::sample_alive_persons(utils::Random* random,
+                                                      PersonStore::Weight weight, int location,
+                                                      int number_of_samples, bool is_shuffled) {
+  if (is_incremental_force_of_infection()) {
+    std::vector<Person*> samples;
+    samples.reserve(number_of_samples);
+    person_store_->sample(weight, location, number_of_samples, random, samples);
+    return samples;
+  }
+
+  switch (weight) {
+    case PersonStore::RELATIVE_BITING:
+      return random->roulette_sampling<Person>(
+          number_of_samples, individual_relative_biting_by_location_[location],
+          all_alive_persons_by_location_[location], is_shuffled,
+          sum_relative_biting_by_location_[location]);
+    case PersonStore::RELATIVE_MOVING:
+      return random->roulette_sampling<Person>(
+          number_of_samples, individual_relative_moving_by_location_[location],
+          all_alive_persons_by_location_[location], is_shuffled,
+          sum_relative_moving_by_location_[location]);
+    case PersonStore::FORCE_OF_INFECTION:
+      return random->roulette_sampling<Person>(
+          number_of_samples, individual_foi_by_location_[location],
+          all_alive_persons_by_location_[location], is_shuffled,
+          current_force_of_infection_by_location_[location]);
+    default:
+      throw std::invalid_argument("Unknown sampling weight in Population::sample_alive_persons");
+  }
+}
+
+namespace {
+// Save or restore the order of a bucket of a person index, the persons being referenced by their
+// position in PersonIndexAll. The order decides which person a uniform draw over the bucket picks.
+template <typename Handler>
+void checkpoint_order(utils::CheckpointArchive &archive, PersonIndexAll &all_persons,
+                      std::vector<Person*> &bucket) {
+  std::vector<std::uint64_t> positions;
+  if (!archive.is_loading()) {
+    positions.reserve(bucket.size());
+    for (auto* person : bucket) { positions.push_back(person->PersonIndexAllHandler::get_index()); }
+  }
+  archive & positions;
+  if (archive.is_loading()) {
+    if (positions.size() != bucket.size()) {
+      throw std::runtime_error("Checkpoint person index does not match the restored persons");
+    }
+    for (std::size_t i = 0; i < positions.size(); i++) {
+      auto* person = all_persons.v_person().at(positions[i]).get();
+      person->Handler::set_index(i);
+      bucket[i] = person;
+    }
+  }
+}
+
+template <typename Handler, typename Buckets>
+void checkpoint_order(utils::CheckpointArchive &archive, PersonIndexAll &all_persons,
+                      std::vector<Buckets> &buckets) {
+  for (auto &bucket : buckets) { checkpoint_order<Handler>(archive, all_persons, bucket); }
+}
+}  // namespace
+
+void Population::checkpoint(utils::CheckpointArchive &archive) {
+  // persons in PersonIndexAll order, adding them fills the person indexes in that order
+  const auto number_of_persons = archive.size(all_persons_->size());
+  if (archive.is_loading()) {
+    all_persons_->reserve(number_of_persons);
+    for (std::size_t i = 0; i < number_of_persons; i++) {
+      auto person = std::make_unique<Person>();
+      person->initialize();
+      person->checkpoint(archive);
+      add_person(std::move(person));
     }
-    // spdlog::info("update_current_foi individual_relative_moving_by_location[{}] size: {} sum:
-    // {}",location,
-    //                individual_relative_moving_by_location[location].size(),
-    //                sum_relative_moving_by_location[location]);
-    // spdlog::info("update_current_foi all_alive_persons_by_location[{}] size: {}",location,
-    //                all_alive_persons_by_location[location].size());
+  } else {
+    for (auto &person : all_persons_->v_person()) { person->checkpoint(archive); }
+  }
+
+  // then the actual order of each index
+  checkpoint_order<PersonIndexByLocationStateAgeClassHandler>(
+      archive, *all_persons_, get_person_index<PersonIndexByLocationStateAgeClass>()->vPerson());
+  checkpoint_order<PersonIndexByLocationMovingLevelHandler>(
+      archive, *all_persons_, get_person_index<PersonIndexByLocationMovingLevel>()->vPerson());
+  for (auto location = 0; location < person_store_->number_of_locations(); location++) {
+    auto persons = person_store_->columns_at(location).persons;
+    checkpoint_order<PersonStoreHandler>(archive, *all_persons_, persons);
+    if (archive.is_loading()) { person_store_->assign(location, persons); }
+  }
+  person_store_->checkpoint_weights(archive);
+
+  archive & popsize_by_location_ & sum_relative_biting_by_location_
+      & sum_relative_moving_by_location_ & current_force_of_infection_by_location_
+      & force_of_infection_for_n_days_by_location_;
+
+  auto cached_residents =
+      destination_cache_ == nullptr ? IntVector{} : destination_cache_->get_cached_residents();
+  archive & cached_residents;
+  if (archive.is_loading() && !cached_residents.empty()) {
+    refresh_destination_distributions(cached_residents);
   }
 }
@@ -6,10 +6,24 @@
 #include <memory>
 #include <vector>
 
+#include "Core/Scheduler/TimingWheel.h"
 #include "Person/Person.h"
+#include "PersonUpdateBatch.h"
+#include "Utils/Index/PersonStore.h"
+
+namespace Spatial {
+class DestinationDistributionCache;
+}
 
 using PersonIndexPtrList = std::list<std::unique_ptr<PersonIndex>>;
 
+namespace utils {
+class AliasTable;
+class CheckpointArchive;
+class Random;
+class ThreadPool;
+}  // namespace utils
+
 class Model;
 class PersonIndexAll;
 class PersonIndexByLocationStateAgeClass;
@@ -27,6 +41,15 @@ public:
   virtual ~Population();
 
   void initialize();
+
+  // Size the containers and person indexes for the configuration, without any individual
+  void initialize_empty();
+
+  /**
+   * Save or restore the individuals, the order of every person index and the force of
+   * infection. Restoring expects an empty population made by initialize_empty().
+   */
+  void checkpoint(utils::CheckpointArchive &archive);
   //
   // void update(int current_time);
   //
@@ -85,7 +108,28 @@ public:
 
   void perform_death_event();
 
-  void generate_individual(int location, int age_class);
+  /**
+   * Create an individual of the initial population without adding it to the population. Only
+   * Model::get_random() and read-only state are used, so that individuals of different locations
+   * can be created concurrently, each thread on its own random stream. The moving level is drawn
+   * from @moving_levels when given, otherwise from the shared generator of the movement settings.
+   */
+  std::unique_ptr<Person> create_individual(int age_class,
+                                            const utils::AliasTable* moving_levels = nullptr);
+
+  // Place an individual made by create_individual at @location and add it to the population
+  void add_initial_individual(std::unique_ptr<Person> person, int location);
+
+  /**
+   * Generate the initial population with one task per location on a pool of @number_of_threads
+   * threads, or location by location on the calling thread for a single thread. Every location
+   * draws from its own random stream derived from the model seed, and the individuals are added
+   * to the population in location order, so the outcome does not depend on the number of threads.
+   * @param number_of_threads
+   * @param individuals_by_location_age_class
+   */
+  void generate_initial_population(
+      int number_of_threads, const std::vector<IntVector> &individuals_by_location_age_class);
 
   void give_1_birth(const int &location);
 
@@ -93,6 +137,12 @@ public:
 
   void perform_circulation_event();
 
+  // Drops the cached destination distributions, they are rebuilt on the next circulation event
+  void invalidate_destination_distributions();
+
+  // Rebuild the cached destination distributions if the residents moved past the tolerance
+  void refresh_destination_distributions(const IntVector &residents_by_location);
+
   void perform_circulation_for_1_location(const int &from_location, const int &target_location,
                                           const int &number_of_circulations,
                                           std::vector<Person*> &today_circulations);
@@ -101,18 +151,50 @@ public:
 
   void initialize_person_indices();
 
+  /**
+   * Update all individuals, one task per location on a pool of model_settings.number_of_threads
+   * threads, or location by location on the calling thread for a single thread. Every location
+   * draws from its own random stream derived from the model seed, so the outcome is reproducible
+   * and does not depend on the number of threads.
+   */
   void update_all_individuals();
 
+  // Point the generator of every location to its stream of @day, substream(location, day)
+  void reset_location_randoms(int number_of_locations, int day);
+
   void execute_all_individual_events(int up_to_time);
 
+  /**
+   * Refresh the force of infection, the sampling weights and their sums of every location.
+   * In the incremental mode the person store already holds them up to date and only the
+   * per-location totals are copied, otherwise they are rebuilt from the whole population.
+   */
   void update_current_foi();
 
+  [[nodiscard]] bool is_incremental_force_of_infection() const {
+    return person_store_ != nullptr && person_store_->is_tracking_weights();
+  }
+
+  // Number of alive persons in the location, as of the last update_current_foi in the full mode
+  [[nodiscard]] std::size_t number_of_alive_persons(int location) const;
+
+  /**
+   * Draw alive persons of the location with replacement proportionally to the given weight.
+   * The full mode goes through roulette_sampling over the rebuilt vectors, the incremental
+   * mode draws from the Fenwick trees of the person store in O(log n) per sample, its draws
+   * are already in random order so @is_shuffled only applies to the full mode.
+   */
+  [[nodiscard]] std::vector<Person*> sample_alive_persons(utils::Random* random,
+                                                          PersonStore::Weight weight, int location,
+                                                          int number_of_samples, bool is_shuffled);
+
   // Notify the population that a person has moved from the source location, to
   // the destination location
   void notify_movement(int source, int destination);
 
   PersonIndexPtrList* person_index_list() { return person_index_list_.get(); }
   PersonIndexAll* all_persons() { return all_persons_.get(); }
+  TimingWheel* timing_wheel() { return timing_wheel_.get(); }
 
   template <typename T>
   T* get_person_index();
@@ -155,9 +237,14 @@ public:
   }
 
 private:
+  // declared before all_persons_ so it outlives the events linked into it
+  std::unique_ptr<TimingWheel> timing_wheel_{nullptr};
+
   std::unique_ptr<PersonIndexAll> all_persons_{nullptr};
 
   std::unique_ptr<PersonIndexPtrList> person_index_list_{nullptr};
+  // owned by person_index_list_
+  PersonStore* person_store_{nullptr};
   IntVector popsize_by_location_;
 
   std::vector<std::vector<double>> individual_foi_by_location_;
@@ -170,6 +257,29 @@ private:
   std::vector<double> current_force_of_infection_by_location_;
   std::vector<std::vector<double>> force_of_infection_for_n_days_by_location_;
   std::vector<std::vector<Person*>> all_alive_persons_by_location_;
+
+  std::unique_ptr<utils::ThreadPool> thread_pool_{nullptr};
+  std::vector<std::unique_ptr<utils::Random>> location_randoms_;
+  // one batch per location so the threads never share one, reused between days
+  std::vector<PersonUpdateBatch> update_batches_;
+
+  // batch random draws of perform_infection_event, reused between days
+  std::vector<double> bite_poisson_means_;
+  std::vector<int> number_of_bites_by_location_;
+  std::vector<double> bite_uniform_draws_;
+
+  // persons with events due today, reused between days
+  std::vector<Person*> persons_with_due_events_;
+
+  // set when circulation_info.destination_cache_tolerance is positive
+  std::unique_ptr<Spatial::DestinationDistributionCache> destination_cache_{nullptr};
+  IntVector traveler_destinations_;
+  DoubleVector sparse_distance_row_;
+
+  void update_individuals_at_location(int location);
+
+  // Distance row of a location as passed to the spatial model
+  const DoubleVector &distance_row(int from_location);
 };
 
 template <typename T>
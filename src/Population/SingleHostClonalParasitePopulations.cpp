@@ -12,6 +12,9 @@
 #include "Population/Person/Person.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/Drug.h"
+#include "Utils/CheckpointArchive.h"
+
+OBJECTPOOL_IMPL(SingleHostClonalParasitePopulations)
 
 using std::ranges::any_of;
 
@@ -27,41 +30,26 @@ SingleHostClonalParasitePopulations::~SingleHostClonalParasitePopulations() {
 
 void SingleHostClonalParasitePopulations::clear() { parasites_.clear(); }
 
-// transfer ownership of the parasite to the SingleHostClonalParasitePopulations
-void SingleHostClonalParasitePopulations::add(
-    std::unique_ptr<ClonalParasitePopulation> blood_parasite) {
-  blood_parasite->set_parasite_population(this);
-  // move the parasite to the vector
-  parasites_.push_back(std::move(blood_parasite));
-  parasites_.back()->set_index(parasites_.size() - 1);
+ClonalParasitePopulation* SingleHostClonalParasitePopulations::add(
+    ClonalParasitePopulation blood_parasite) {
+  blood_parasite.set_parasite_population(this);
+  blood_parasite.set_handle(next_handle_++);
+  return &parasites_.emplace_back(std::move(blood_parasite));
 }
 
-// void SingleHostClonalParasitePopulations::remove(ClonalParasitePopulation* blood_parasite) {
-//   if (blood_parasite != parasites_[blood_parasite->get_index()].get()) {
-//     throw std::runtime_error(
-//         "Incorrect index, or parasite not belong to this SingleHostClonalParasitePopulations when
-//         " "remove parasite from SingleHostClonalParasitePopulations");
-//   }
-//   remove(blood_parasite->get_index());
-// }
-
 void SingleHostClonalParasitePopulations::remove(size_t index) {
-  if (index < 0 || index >= parasites_.size()) { throw std::out_of_range("Index out of range"); }
-  ClonalParasitePopulation* bp = parasites_[index].get();
-  //    std::cout << parasites_.size() << std::endl;
-  if (bp->get_index() != index) {
-    spdlog::error(
-        "Incorrect index when remove parasite from SingleHostClonalParasitePopulations: {} - {} - "
-        "{}",
-        bp->get_index(), index, parasites_[index]->get_index());
-    throw std::runtime_error(
-        "Incorrect index when remove parasite from SingleHostClonalParasitePopulations");
-  }
-
-  parasites_.back()->set_index(index);
-  parasites_[index] = std::move(parasites_.back());
+  if (index >= parasites_.size()) { throw std::out_of_range("Index out of range"); }
+  if (index != parasites_.size() - 1) { parasites_[index] = std::move(parasites_.back()); }
   parasites_.pop_back();
-  // bp automatically deleted
+}
+
+ClonalParasitePopulation* SingleHostClonalParasitePopulations::find(
+    ClonalParasitePopulation::Handle handle) {
+  if (handle == ClonalParasitePopulation::NO_HANDLE) { return nullptr; }
+  for (auto &parasite : parasites_) {
+    if (parasite.handle() == handle) { return &parasite; }
+  }
+  return nullptr;
 }
 
 int SingleHostClonalParasitePopulations::latest_update_time() const {
@@ -70,35 +58,23 @@ int SingleHostClonalParasitePopulations::latest_update_time() const {
 
 bool SingleHostClonalParasitePopulations::contain(ClonalParasitePopulation* blood_parasite) {
   return std::ranges::any_of(parasites_, [blood_parasite](const auto &parasite) {
-    if (!parasite) { throw std::runtime_error("Parasite is nullptr"); }
-    return parasite.get() == blood_parasite;
+    return &parasite == blood_parasite;
   });
 }
 
 void SingleHostClonalParasitePopulations::change_all_parasite_update_function(
-    ParasiteDensityUpdateFunction* from, ParasiteDensityUpdateFunction* to) const {
-  for (const auto &parasite : parasites_) {
-    if (parasite->update_function() == from) { parasite->set_update_function(to); }
+    ParasiteDensityUpdateFunction* from, ParasiteDensityUpdateFunction* to) {
+  for (auto &parasite : parasites_) {
+    if (parasite.update_function() == from) { parasite.set_update_function(to); }
   }
 }
 
 void SingleHostClonalParasitePopulations::update() {
-  for (auto &bp : parasites_) {
-    if (bp == nullptr) {
-      throw std::runtime_error(
-          "Parasite is nullptr in SingleHostClonalParasitePopulations::update");
-    }
-    bp->update();
-  }
+  for (auto &bp : parasites_) { bp.update(); }
 }
 
 void SingleHostClonalParasitePopulations::clear_cured_parasites(double cured_threshold) {
-  log10_total_infectious_density_ = ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY;
-
-  // Check if the vector is empty before proceeding
-  if (parasites_.empty()) {
-    return;  // Nothing to clear or update
-  }
+  auto log10_total_infectious_density = ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY;
 
   // Use a signed type for the index to avoid underflow issues with the loop condition
   for (int i = static_cast<int>(parasites_.size()) - 1; i >= 0; --i) {
@@ -108,44 +84,54 @@ void SingleHostClonalParasitePopulations::clear_cured_parasites(double cured_thr
       continue;
     }
 
-    if (parasites_[i]->last_update_log10_parasite_density() <= cured_threshold) {
+    if (parasites_[i].last_update_log10_parasite_density() <= cured_threshold) {
       remove(static_cast<size_t>(i));  // remove expects size_t
     } else {
       // Safely calculate total infectious density
-      double log10_density = parasites_[i]->get_log10_infectious_density();
-      if (log10_total_infectious_density_ == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) {
-        log10_total_infectious_density_ = log10_density;
+      double log10_density = parasites_[i].get_log10_infectious_density();
+      if (log10_total_infectious_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) {
+        log10_total_infectious_density = log10_density;
       } else {
         // Avoid potential floating point issues if density is very low
         if (log10_density > ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) {
-          log10_total_infectious_density_ +=
-              log10(pow(10, log10_density - log10_total_infectious_density_) + 1.0);
+          log10_total_infectious_density +=
+              log10(pow(10, log10_density - log10_total_infectious_density) + 1.0);
         }
       }
     }
   }
+  set_log10_total_infectious_density(log10_total_infectious_density);
+}
+
+void SingleHostClonalParasitePopulations::set_log10_total_infectious_density(double value) {
+  if (log10_total_infectious_density_ == value) { return; }
+  if (person_ != nullptr) {
+    person_->notify_change(Person::INFECTIOUS_DENSITY, &log10_total_infectious_density_, &value);
+  }
+  log10_total_infectious_density_ = value;
 }
 
-void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in_blood) const {
+void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in_blood) {
   if (drugs_in_blood == nullptr) { throw std::invalid_argument("Drugs in blood is nullptr"); }
-  for (const auto &blood_parasite : parasites_) {
-    auto* new_genotype = blood_parasite->genotype();
+  const auto &parameters = Model::get_config()->hot_parameters();
+  for (auto &blood_parasite : parasites_) {
+    auto* new_genotype = blood_parasite.genotype();
 
     double percent_parasite_remove = 0;
-    for (auto &[drug_id, drug] : *drugs_in_blood) {
+    for (const auto &drug : *drugs_in_blood) {
       // select all locus
       // remember to use mask to turn on and off mutation location
       // for a specific time
       Genotype* candidate_genotype = new_genotype->perform_mutation_by_drug(
-          Model::get_config(), Model::get_random(), drug->drug_type(),
-          Model::get_config()->get_genotype_parameters().get_mutation_probability_per_locus());
+          Model::get_config(), Model::get_random(), drug.drug_type(),
+          parameters.mutation_probability_per_locus);
 
-      if (candidate_genotype->get_EC50_power_n(drug->drug_type())
-          > new_genotype->get_EC50_power_n(drug->drug_type())) {
+      if (candidate_genotype->get_EC50_power_n(drug.drug_type())
+          > new_genotype->get_EC50_power_n(drug.drug_type())) {
         // higher EC50^n means lower efficacy then allow mutation occur
         new_genotype = candidate_genotype;
       }
-      if (new_genotype != blood_parasite->genotype()) {
+      if (new_genotype != blood_parasite.genotype()) {
         // if(blood_parasite->genotype()->get_aa_sequence()[35] == 'C'
         //    && new_genotype->get_aa_sequence()[35] == 'Y'){
         //   spdlog::info("580 C -> Y");
@@ -155,31 +141,28 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
         //     {}",blood_parasite->genotype()->aa_sequence,new_genotype->aa_sequence);
         // }
         // mutation occurs
-        Model::get_mdc()->record_1_mutation(person_->get_location(), blood_parasite->genotype(),
+        Model::get_mdc()->record_1_mutation(person_->get_location(), blood_parasite.genotype(),
                                             new_genotype);
-        Model::get_mdc()->record_1_mutation_by_drug(
-            person_->get_location(), blood_parasite->genotype(), new_genotype, drug_id);
+        Model::get_mdc()->record_1_mutation_by_drug(person_->get_location(),
+                                                    blood_parasite.genotype(), new_genotype,
+                                                    drug.drug_type()->id());
 
         //          LOG(TRACE) << Model::get_scheduler()->current_time() << "\t" <<
         //          blood_parasite->genotype()->genotype_id()
         //          << "\t"
         //                     << new_genotype->genotype_id() << "\t"
-        //                     << blood_parasite->genotype()->get_EC50_power_n(drug->drug_type()) <<
+        //                     << blood_parasite->genotype()->get_EC50_power_n(drug.drug_type()) <<
         //                     "\t"
-        //                     << new_genotype->get_EC50_power_n(drug->drug_type());
-        blood_parasite->set_genotype(new_genotype);
+        //                     << new_genotype->get_EC50_power_n(drug.drug_type());
+        blood_parasite.set_genotype(new_genotype);
       }
 
-      const auto p_temp =
-          drug->get_parasite_killing_rate(blood_parasite->genotype()->genotype_id());
+      const auto p_temp = drug.get_parasite_killing_rate(blood_parasite.genotype());
       percent_parasite_remove = percent_parasite_remove + p_temp - percent_parasite_remove * p_temp;
     }
     if (percent_parasite_remove > 0) {
-      blood_parasite->perform_drug_action(percent_parasite_remove,
-                                          Model::get_config()
-                                              ->get_parasite_parameters()
-                                              .get_parasite_density_levels()
-                                              .get_log_parasite_density_cured());
+      blood_parasite.perform_drug_action(percent_parasite_remove,
+                                          parameters.log_parasite_density_cured);
     }
   }
 }
@@ -187,14 +170,29 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
 bool SingleHostClonalParasitePopulations::has_detectable_parasite(
     double detectable_threshold) const {
   return std::ranges::any_of(parasites_, [detectable_threshold](const auto &parasite) {
-    if (!parasite) { throw std::runtime_error("Parasite is nullptr"); }
-    return parasite->last_update_log10_parasite_density() >= detectable_threshold;
+    return parasite.last_update_log10_parasite_density() >= detectable_threshold;
   });
 }
 
 bool SingleHostClonalParasitePopulations::is_gametocytaemic() const {
   for (const auto &parasite : parasites_) {
-    if (parasite->gametocyte_level() > 0) { return true; }
+    if (parasite.gametocyte_level() > 0) { return true; }
   }
   return false;
 }
+
+void SingleHostClonalParasitePopulations::checkpoint(utils::CheckpointArchive &archive) {
+  // assigned directly, a restored person is not in the population yet
+  archive & log10_total_infectious_density_ & next_handle_;
+  const auto number_of_parasites = archive.size(parasites_.size());
+  if (archive.is_loading()) {
+    parasites_.clear();
+    for (std::size_t i = 0; i < number_of_parasites; i++) {
+      auto &parasite = parasites_.emplace_back();
+      parasite.checkpoint(archive);
+      parasite.set_parasite_population(this);
+    }
+  } else {
+    for (auto &parasite : parasites_) { parasite.checkpoint(archive); }
+  }
+}
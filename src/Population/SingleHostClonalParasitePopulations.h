@@ -1,10 +1,11 @@
 #ifndef SINGLEHOSTCLONALPARASITEPOPULATIONS_H
 #define SINGLEHOSTCLONALPARASITEPOPULATIONS_H
 
-#include <memory>
-#include <vector>
+#include <stdexcept>
 
 #include "Population/ClonalParasitePopulation.h"
+#include "Utils/ObjectPool.h"
+#include "Utils/SmallVector.h"
 #include "Utils/TypeDef.h"
 
 class ClonalParasitePopulation;
@@ -13,8 +14,11 @@ class DrugType;
 class DrugsInBlood;
 class ParasiteDensityUpdateFunction;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class SingleHostClonalParasitePopulations {
-  // OBJECTPOOL(SingleHostClonalParasitePopulations)
 public:
   // Disallow copy
   SingleHostClonalParasitePopulations(const SingleHostClonalParasitePopulations&) = delete;
@@ -33,11 +37,17 @@ public:
   // Mark destructor as default if it doesn't need special handling
   virtual ~SingleHostClonalParasitePopulations();
 
+  OBJECTPOOL(SingleHostClonalParasitePopulations)
+
   void init();
 
+  // Clones are kept inline, most hosts carry only a few of them at a time
+  static constexpr std::size_t INLINE_CAPACITY = 4;
+  using ParasiteVector = utils::SmallVector<ClonalParasitePopulation, INLINE_CAPACITY>;
+
   // Iterator type definitions for STL compatibility
-  using Iterator = std::vector<std::unique_ptr<ClonalParasitePopulation>>::iterator;
-  using ConstIterator = std::vector<std::unique_ptr<ClonalParasitePopulation>>::const_iterator;
+  using Iterator = ParasiteVector::iterator;
+  using ConstIterator = ParasiteVector::const_iterator;
 
   // Iterator methods
   [[nodiscard]] ConstIterator begin() const noexcept { return parasites_.begin(); }
@@ -45,13 +55,19 @@ public:
   [[nodiscard]] Iterator begin() noexcept { return parasites_.begin(); }
   [[nodiscard]] Iterator end() noexcept { return parasites_.end(); }
 
-  // Access methods
-  [[nodiscard]] ClonalParasitePopulation* at(size_t index) const {
-    return parasites_.at(index).get();
+  // Access methods, the pointers are invalidated by any add or remove
+  [[nodiscard]] ClonalParasitePopulation* at(size_t index) {
+    if (index >= parasites_.size()) { throw std::out_of_range("Index out of range"); }
+    return &parasites_[index];
+  }
+  [[nodiscard]] const ClonalParasitePopulation* at(size_t index) const {
+    if (index >= parasites_.size()) { throw std::out_of_range("Index out of range"); }
+    return &parasites_[index];
   }
 
-  [[nodiscard]] ClonalParasitePopulation* operator[](size_t index) const {
-    return parasites_[index].get();
+  [[nodiscard]] ClonalParasitePopulation* operator[](size_t index) { return &parasites_[index]; }
+  [[nodiscard]] const ClonalParasitePopulation* operator[](size_t index) const {
+    return &parasites_[index];
   }
 
   // Mark virtual functions that are meant to be overridden with override in derived classes
@@ -59,16 +75,21 @@ public:
 
   [[nodiscard]] bool empty() const noexcept { return parasites_.empty(); }
 
-  virtual void add(std::unique_ptr<ClonalParasitePopulation> blood_parasite);
+  // Move the parasite in and give it a new handle, returns the stored parasite
+  virtual ClonalParasitePopulation* add(ClonalParasitePopulation blood_parasite);
 
+  // Swap-remove, the last parasite takes the place of the removed one
   virtual void remove(size_t index);
 
+  // The parasite with this handle, nullptr once it has been removed
+  [[nodiscard]] ClonalParasitePopulation* find(ClonalParasitePopulation::Handle handle);
+
   [[nodiscard]] virtual int latest_update_time() const;
 
   virtual bool contain(ClonalParasitePopulation* blood_parasite);
 
   void change_all_parasite_update_function(ParasiteDensityUpdateFunction* from,
-                                           ParasiteDensityUpdateFunction* to) const;
+                                           ParasiteDensityUpdateFunction* to);
 
   void update();
 
@@ -76,7 +97,7 @@ public:
 
   void clear();
 
-  void update_by_drugs(DrugsInBlood* drugs_in_blood) const;
+  void update_by_drugs(DrugsInBlood* drugs_in_blood);
 
   [[nodiscard]] bool has_detectable_parasite(double detectable_threshold) const;
 
@@ -87,9 +108,11 @@ public:
     return log10_total_infectious_density_;
   }
 
-  void set_log10_total_infectious_density(double value) noexcept {  // Pass by value for primitives
-    log10_total_infectious_density_ = value;
-  }
+  // Notifies the person so the population stores see the new density
+  void set_log10_total_infectious_density(double value);
+
+  // Save or restore the parasites in order with their handles and the total infectious density
+  void checkpoint(utils::CheckpointArchive &archive);
 
   [[nodiscard]] Person* person() const noexcept { return person_; }
 
@@ -97,7 +120,8 @@ public:
 
 private:
   Person* person_{nullptr};
-  std::vector<std::unique_ptr<ClonalParasitePopulation>> parasites_;
+  ParasiteVector parasites_;
+  ClonalParasitePopulation::Handle next_handle_{ClonalParasitePopulation::NO_HANDLE + 1};
   double log10_total_infectious_density_{DEFAULT_LOG_DENSITY};
 };
 
@@ -0,0 +1,249 @@
+#include "ColumnarReporter.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <tuple>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "MDC/ModelDataCollector.h"
+#include "MDC/PopulationCensus.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+#include "Spatial/GIS/SpatialData.h"
+
+void ColumnarReporter::initialize(int job_number, const std::string &path) {
+  const auto &admin_levels = Model::get_spatial_data()->get_admin_levels();
+  if (admin_levels.empty()) {
+    spdlog::info("No admin levels found, cell level reporting will be enabled.");
+    enable_cell_level_reporting_ = true;
+  }
+
+  levels_.clear();
+  for (auto level_id = 0; level_id < static_cast<int>(admin_levels.size()); level_id++) {
+    const auto* boundary =
+        Model::get_spatial_data()->get_admin_level_manager()->get_boundary(admin_levels[level_id]);
+    levels_.push_back({admin_levels[level_id], level_id, boundary->max_unit_id + 1});
+  }
+  if (enable_cell_level_reporting_) {
+    levels_.push_back({"cell", CELL_LEVEL_ID, Model::get_config()->number_of_locations()});
+  }
+
+  file_path_ = fmt::format("{}columnar_data_{}.mcol", path, job_number);
+  writer_ = std::make_unique<ColumnarFileWriter>(file_path_);
+  spdlog::info("ColumnarReporter writing {} level(s) to {}", levels_.size(), file_path_);
+}
+
+void ColumnarReporter::monthly_report() {
+  const auto record_genome = Model::get_config()->get_model_settings().get_record_genome_db()
+                             && Model::get_mdc()->recording_data();
+  for (const auto &level : levels_) {
+    report_site_data(level);
+    if (record_genome) { report_genome_data(level); }
+  }
+  writer_->flush();
+}
+
+void ColumnarReporter::after_run() {
+  // the genotype database grows during the run
+  report_genotypes();
+  writer_->flush();
+}
+
+int ColumnarReporter::unit_of(const Level &level, int location) {
+  return level.id == CELL_LEVEL_ID ? location
+                                   : Model::get_spatial_data()->get_admin_unit(level.id, location);
+}
+
+void ColumnarReporter::begin_chunk(const std::string &table, const Level* level) {
+  chunk_.table = table;
+  chunk_.level = level == nullptr ? "" : level->name;
+  chunk_.days_elapsed = Model::get_scheduler()->current_time();
+  chunk_.model_time = Model::get_scheduler()->get_unix_time();
+  chunk_.columns.clear();
+}
+
+void ColumnarReporter::report_site_data(const Level &level) {
+  auto* mdc = Model::get_mdc();
+  const auto &census = mdc->census();
+  const auto units = static_cast<std::size_t>(level.number_of_units);
+  const auto age_classes = static_cast<std::size_t>(Model::get_config()->number_of_age_classes());
+  const auto moi_count = static_cast<std::size_t>(ModelDataCollector::NUMBER_OF_REPORTED_MOI);
+
+  population_.assign(units, 0);
+  clinical_episodes_.assign(units, 0);
+  clinical_episodes_by_age_class_.assign(units * age_classes, 0);
+  treatments_.assign(units, 0);
+  treatment_failures_.assign(units, 0);
+  nontreatment_.assign(units, 0);
+  new_infections_.assign(units, 0);
+  infected_individuals_.assign(units, 0);
+  parasite_clones_.assign(units, 0);
+  multiple_of_infection_.assign(units * moi_count, 0);
+  total_immune_.assign(units, 0.0);
+  eir_.assign(units, 0.0);
+  pfpr_under5_.assign(units, 0.0);
+  pfpr_2to10_.assign(units, 0.0);
+  pfpr_all_.assign(units, 0.0);
+
+  for (auto location = 0; location < census.number_of_locations(); location++) {
+    const auto location_population = census.population(location);
+    if (location_population == 0) { continue; }
+    const auto unit = static_cast<std::size_t>(unit_of(level, location));
+
+    population_[unit] += location_population;
+    clinical_episodes_[unit] += mdc->monthly_number_of_clinical_episode_by_location()[location];
+    for (std::size_t ac = 0; ac < age_classes; ac++) {
+      clinical_episodes_by_age_class_[(unit * age_classes) + ac] +=
+          mdc->monthly_number_of_clinical_episode_by_location_age_class()[location][ac];
+    }
+    treatments_[unit] += mdc->monthly_number_of_treatment_by_location()[location];
+    treatment_failures_[unit] += mdc->monthly_treatment_failure_by_location()[location];
+    nontreatment_[unit] += mdc->monthly_nontreatment_by_location()[location];
+    new_infections_[unit] += mdc->monthly_number_of_new_infections_by_location()[location];
+    infected_individuals_[unit] += census.infected(location);
+    parasite_clones_[unit] += census.number_of_clones(location);
+    for (std::size_t moi = 0; moi < moi_count; moi++) {
+      multiple_of_infection_[(unit * moi_count) + moi] +=
+          mdc->multiple_of_infection_by_location()[location][moi];
+    }
+    total_immune_[unit] += census.total_immune(location);
+
+    // EIR and PfPR are not valid before the recording starts, the levels report the population
+    // weighted mean of their locations
+    if (mdc->recording_data()) {
+      const auto &eir_by_year = mdc->eir_by_location_year()[location];
+      eir_[unit] += (eir_by_year.empty() ? 0.0 : eir_by_year.back()) * location_population;
+      pfpr_under5_[unit] += mdc->get_blood_slide_prevalence(location, 0, 5) * location_population;
+      pfpr_2to10_[unit] += mdc->get_blood_slide_prevalence(location, 2, 10) * location_population;
+      pfpr_all_[unit] += mdc->blood_slide_prevalence_by_location()[location] * location_population;
+    }
+  }
+
+  begin_chunk("site", &level);
+  const auto unit_column = chunk_.columns.size();
+  chunk_.add_integer_column(level.id == CELL_LEVEL_ID ? "location_id" : "unit_id",
+                            ColumnChunk::Encoding::DICTIONARY);
+  auto add_integers = [&](const std::string &name, const std::vector<int64_t> &totals,
+                          std::size_t stride = 1, std::size_t offset = 0) {
+    auto &column = chunk_.add_integer_column(name);
+    for (std::size_t unit = 0; unit < units; unit++) {
+      if (population_[unit] != 0) { column.integers.push_back(totals[(unit * stride) + offset]); }
+    }
+  };
+  auto add_means = [&](const std::string &name, const std::vector<double> &totals,
+                       double scale) {
+    auto &column = chunk_.add_real_column(name);
+    for (std::size_t unit = 0; unit < units; unit++) {
+      if (population_[unit] != 0) {
+        column.reals.push_back(totals[unit] / static_cast<double>(population_[unit]) * scale);
+      }
+    }
+  };
+
+  for (std::size_t unit = 0; unit < units; unit++) {
+    if (population_[unit] != 0) {
+      chunk_.columns[unit_column].integers.push_back(static_cast<int64_t>(unit));
+    }
+  }
+  add_integers("population", population_);
+  add_integers("clinical_episodes", clinical_episodes_);
+  const auto &age_structure = Model::get_config()->age_structure();
+  for (std::size_t ac = 0; ac < age_classes; ac++) {
+    add_integers(fmt::format("clinical_episodes_by_age_class_{}_{}",
+                             ac == 0 ? 0 : age_structure[ac - 1], age_structure[ac]),
+                 clinical_episodes_by_age_class_, age_classes, ac);
+  }
+  add_integers("treatments", treatments_);
+  add_integers("treatment_failures", treatment_failures_);
+  add_integers("non_treatment", nontreatment_);
+  add_integers("new_infections", new_infections_);
+  add_integers("infected_individuals", infected_individuals_);
+  add_integers("parasite_clones", parasite_clones_);
+  for (std::size_t moi = 0; moi < moi_count; moi++) {
+    add_integers(fmt::format("moi_{}", moi), multiple_of_infection_, moi_count, moi);
+  }
+  add_means("mean_immune", total_immune_, 1.0);
+  add_means("eir", eir_, 1.0);
+  add_means("pfpr_under5", pfpr_under5_, 100.0);
+  add_means("pfpr_2to10", pfpr_2to10_, 100.0);
+  add_means("pfpr_all", pfpr_all_, 100.0);
+
+  writer_->write(chunk_);
+}
+
+void ColumnarReporter::report_genome_data(const Level &level) {
+  const auto &census = Model::get_mdc()->census();
+
+  genome_rows_.clear();
+  for (auto location = 0; location < census.number_of_locations(); location++) {
+    const auto unit = unit_of(level, location);
+    for (auto entry = census.genotype_begin(location); entry < census.genotype_end(location);
+         entry++) {
+      genome_rows_.push_back({unit, census.genotype_id(entry), census.clones(entry),
+                              census.clinical_clones(entry), census.clones_0_5(entry),
+                              census.clones_2_10(entry), census.weighted_carriers(entry)});
+    }
+  }
+
+  // merge the locations of the same unit
+  std::sort(genome_rows_.begin(), genome_rows_.end(), [](const auto &lhs, const auto &rhs) {
+    return std::tie(lhs.unit_id, lhs.genotype_id) < std::tie(rhs.unit_id, rhs.genotype_id);
+  });
+  std::size_t merged = 0;
+  for (std::size_t i = 0; i < genome_rows_.size(); i++) {
+    if (merged > 0 && genome_rows_[merged - 1].unit_id == genome_rows_[i].unit_id
+        && genome_rows_[merged - 1].genotype_id == genome_rows_[i].genotype_id) {
+      auto &row = genome_rows_[merged - 1];
+      row.occurrences += genome_rows_[i].occurrences;
+      row.clinical_occurrences += genome_rows_[i].clinical_occurrences;
+      row.occurrences_0to5 += genome_rows_[i].occurrences_0to5;
+      row.occurrences_2to10 += genome_rows_[i].occurrences_2to10;
+      row.weighted_occurrences += genome_rows_[i].weighted_occurrences;
+    } else {
+      genome_rows_[merged++] = genome_rows_[i];
+    }
+  }
+  genome_rows_.resize(merged);
+
+  begin_chunk("genome", &level);
+  chunk_.add_integer_column(level.id == CELL_LEVEL_ID ? "location_id" : "unit_id",
+                            ColumnChunk::Encoding::DICTIONARY);
+  chunk_.add_integer_column("genome_id", ColumnChunk::Encoding::DICTIONARY);
+  chunk_.add_integer_column("occurrences");
+  chunk_.add_integer_column("clinical_occurrences");
+  chunk_.add_integer_column("occurrences_0to5");
+  chunk_.add_integer_column("occurrences_2to10");
+  chunk_.add_real_column("weighted_occurrences");
+  for (auto &column : chunk_.columns) {
+    column.integers.reserve(genome_rows_.size());
+    column.reals.reserve(genome_rows_.size());
+  }
+  for (const auto &row : genome_rows_) {
+    chunk_.columns[0].integers.push_back(row.unit_id);
+    chunk_.columns[1].integers.push_back(row.genotype_id);
+    chunk_.columns[2].integers.push_back(row.occurrences);
+    chunk_.columns[3].integers.push_back(row.clinical_occurrences);
+    chunk_.columns[4].integers.push_back(row.occurrences_0to5);
+    chunk_.columns[5].integers.push_back(row.occurrences_2to10);
+    chunk_.columns[6].reals.push_back(row.weighted_occurrences);
+  }
+
+  writer_->write(chunk_);
+}
+
+void ColumnarReporter::report_genotypes() {
+  begin_chunk("genotype", nullptr);
+  chunk_.add_integer_column("id");
+  chunk_.add_string_column("name");
+  auto* genotype_db = Model::get_genotype_db();
+  for (std::size_t id = 0; id < genotype_db->size(); id++) {
+    chunk_.columns[0].integers.push_back(static_cast<int64_t>(id));
+    chunk_.columns[1].strings.push_back(genotype_db->at(id)->get_aa_sequence());
+  }
+  writer_->write(chunk_);
+}
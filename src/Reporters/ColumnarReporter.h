@@ -0,0 +1,89 @@
+/*
+ * ColumnarReporter.h
+ *
+ * Writes the monthly site and genome data of every reporting level, as the SQLite reporters do,
+ * as compressed column chunks (see Utility/ColumnarFile.h) instead of text or SQL rows.
+ */
+#ifndef COLUMNARREPORTER_H
+#define COLUMNARREPORTER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Reporter.h"
+#include "Utility/ColumnarFile.h"
+
+class ColumnarReporter : public Reporter {
+public:
+  // disallow copy and move
+  ColumnarReporter(const ColumnarReporter &orig) = delete;
+  void operator=(const ColumnarReporter &orig) = delete;
+  ColumnarReporter(ColumnarReporter &&orig) = delete;
+  void operator=(ColumnarReporter &&orig) = delete;
+
+  explicit ColumnarReporter(bool cell_level_reporting = false)
+      : enable_cell_level_reporting_(cell_level_reporting) {}
+  ~ColumnarReporter() override = default;
+
+  void initialize(int job_number, const std::string &path) override;
+  void before_run() override {}
+  void begin_time_step() override {}
+  void monthly_report() override;
+  void after_run() override;
+
+  [[nodiscard]] const std::string &file_path() const { return file_path_; }
+
+private:
+  struct Level {
+    std::string name;
+    // admin level id, CELL_LEVEL_ID for the cells
+    int id;
+    int number_of_units;
+  };
+
+  static constexpr int CELL_LEVEL_ID = -1;
+
+  [[nodiscard]] static int unit_of(const Level &level, int location);
+  void begin_chunk(const std::string &table, const Level* level);
+  void report_site_data(const Level &level);
+  void report_genome_data(const Level &level);
+  void report_genotypes();
+
+  bool enable_cell_level_reporting_;
+  std::string file_path_;
+  std::unique_ptr<ColumnarFileWriter> writer_;
+  std::vector<Level> levels_;
+
+  // reused between months and levels
+  ColumnChunk chunk_;
+  std::vector<int64_t> population_;
+  std::vector<int64_t> clinical_episodes_;
+  std::vector<int64_t> clinical_episodes_by_age_class_;
+  std::vector<int64_t> treatments_;
+  std::vector<int64_t> treatment_failures_;
+  std::vector<int64_t> nontreatment_;
+  std::vector<int64_t> new_infections_;
+  std::vector<int64_t> infected_individuals_;
+  std::vector<int64_t> parasite_clones_;
+  std::vector<int64_t> multiple_of_infection_;
+  std::vector<double> total_immune_;
+  std::vector<double> eir_;
+  std::vector<double> pfpr_under5_;
+  std::vector<double> pfpr_2to10_;
+  std::vector<double> pfpr_all_;
+
+  struct GenomeRow {
+    int unit_id;
+    int genotype_id;
+    int64_t occurrences;
+    int64_t clinical_occurrences;
+    int64_t occurrences_0to5;
+    int64_t occurrences_2to10;
+    double weighted_occurrences;
+  };
+  std::vector<GenomeRow> genome_rows_;
+};
+
+#endif  // COLUMNARREPORTER_H
@@ -125,7 +125,7 @@ void ConsoleReporter::monthly_report() {
       report_number_by_state(location, pi);
       std::cout << Model::get_mdc()->blood_slide_prevalence_by_location()[location] * 100 << "\t";
       std::cout << Model::get_mdc()->total_immune_by_location()[location]
-                       / static_cast<double>(Model::get_population()->size(location))
+                       / static_cast<double>(Model::get_mdc()->census().population(location))
                 << "\t";
       std::cout << Model::get_mdc()->current_ritf_by_location()[location] << "-"
                 << Model::get_mdc()->current_tf_by_location()[location] << "\t";
@@ -12,7 +12,6 @@
 #include "Treatment/ITreatmentCoverageModel.h"
 #include "Utility/ReporterUtils.h"
 #include "Utils/Constants.h"
-#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Utils/Random.h"
 
 MMCReporter::MMCReporter() = default;
@@ -101,8 +100,7 @@ void MMCReporter::monthly_report() {
   ss << group_sep;
 
   ReporterUtils::output_genotype_frequency3(
-      ss, Model::get_genotype_db()->size(),
-      Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
+      ss, Model::get_genotype_db()->size(), Model::get_mdc()->census());
 
   ss << group_sep;
   print_ntf_by_location();
@@ -158,9 +156,9 @@ void MMCReporter::after_run() {
   spdlog::get("summary_reporter")->info("{}", ss.str());
   ss.str("");
 
-  // Report MOI
-  ReporterUtils::output_moi(
-      ss, Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
+  // Report MOI, the population changed since the last monthly census
+  Model::get_mdc()->update_census();
+  ReporterUtils::output_moi(ss, Model::get_mdc()->census());
 }
 
 void MMCReporter::print_EIR_PfPR_by_location() {
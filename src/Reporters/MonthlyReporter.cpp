@@ -3,6 +3,8 @@
 #include <date/date.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <filesystem>
+
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "MDC/ModelDataCollector.h"
@@ -14,7 +16,6 @@
 #include "Utility/ReporterUtils.h"
 #include "Utils/Cli.h"
 #include "Utils/Constants.h"
-#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Utils/Random.h"
 
 namespace fs = std::filesystem;
@@ -98,7 +99,7 @@ void MonthlyReporter::monthly_report() {
   std::stringstream gene_freq_ss;
   ReporterUtils::output_genotype_frequency3(
       gene_freq_ss, static_cast<int>(Model::get_genotype_db()->size()),
-      Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
+      Model::get_mdc()->census());
   gene_freq_logger->info(gene_freq_ss.str());
 }
 
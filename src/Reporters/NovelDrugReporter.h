@@ -4,7 +4,7 @@
 #include <sstream>
 #include "Reporter.h"
 
-class PersonIndexByLocationStateAgeClass;
+class PopulationCensus;
 
 class NovelDrugReporter : public Reporter {
 public:
@@ -31,7 +31,7 @@ public:
   void monthly_report() override;
 
 private:
-  void output_genotype_frequency_3(const int& number_of_genotypes, PersonIndexByLocationStateAgeClass* pi);
+  void output_genotype_frequency_3(const int& number_of_genotypes, const PopulationCensus& census);
 
 public:
   std::stringstream ss;
@@ -1,5 +1,6 @@
 #include "Reporter.h"
 // #include "ConsoleReporter.h"
+#include "ColumnarReporter.h"
 #include "ConsoleReporter.h"
 #include "MMCReporter.h"
 #include "Simulation/Model.h"
@@ -28,6 +29,7 @@ std::map<std::string, Reporter::ReportType> Reporter::ReportTypeMap{
     {"AgeBand", AGE_BAND_REPORTER},
     {"SQLiteMonthlyReporter", SQLITE_MONTHLY_REPORTER},
     {"SQLiteValidationReporter", SQLITE_VALIDATION_REPORTER},
+    {"ColumnarReporter", COLUMNAR_REPORTER},
 #ifdef ENABLE_TRAVEL_TACKING
         {"TravelTrackingReporter", TRAVEL_TRACKING_REPORTER},
 #endif
@@ -68,6 +70,10 @@ std::unique_ptr<Reporter> Reporter::MakeReport(ReportType report_type) {
     auto cell_level_reporting = Model::get_config()->get_model_settings().get_cell_level_reporting();
     return std::make_unique<SQLiteValidationReporter>();
   }
+  case COLUMNAR_REPORTER: {
+    auto cell_level_reporting = Model::get_config()->get_model_settings().get_cell_level_reporting();
+    return std::make_unique<ColumnarReporter>(cell_level_reporting);
+  }
 #ifdef ENABLE_TRAVEL_TRACKING
     case TRAVEL_TRACKING_REPORTER:
       return std::make_unique<TravelTrackingReporter>();
@@ -62,6 +62,9 @@ public:
     SQLITE_MONTHLY_REPORTER,
     SQLITE_VALIDATION_REPORTER,
 
+    // Columnar binary reporter
+    COLUMNAR_REPORTER,
+
 #ifdef ENABLE_TRAVEL_TRACKING
     TRAVEL_TRACKING_REPORTER,
 #endif
@@ -411,6 +411,8 @@ void SQLiteDbReporter::initialize(int jobNumber, const std::string &path) {
   // populate the location admin map table data
   populate_location_admin_map_table();
 
+  register_insert_statements();
+
   std::string ageClassColumns;
   for (auto ndx = 0; ndx < Model::get_config()->age_structure().size(); ndx++) {
     auto agFrom = ndx == 0 ? 0 : Model::get_config()->age_structure()[ndx - 1];
@@ -419,6 +421,21 @@ void SQLiteDbReporter::initialize(int jobNumber, const std::string &path) {
   }
 }
 
+void SQLiteDbReporter::register_insert_statements() {
+  // the writer owns the connection from here on, until it is flushed
+  writer_ = std::make_unique<SQLiteBulkWriter>(db->handle());
+
+  insert_common_statement_ = writer_->register_statement(insert_common_query_prefix_);
+  insert_site_statements_.clear();
+  for (const auto &prefix : insert_site_query_prefixes_) {
+    insert_site_statements_.push_back(writer_->register_statement(prefix));
+  }
+  insert_genome_statements_.clear();
+  for (const auto &prefix : insert_genome_query_prefixes_) {
+    insert_genome_statements_.push_back(writer_->register_statement(prefix));
+  }
+}
+
 void SQLiteDbReporter::monthly_report() {
   // Get the relevant data
   auto daysElapsed = Model::get_scheduler()->current_time();
@@ -426,7 +443,13 @@ void SQLiteDbReporter::monthly_report() {
   auto seasonalFactor = Model::get_config()->get_seasonality_settings().get_seasonal_factor(
       Model::get_scheduler()->get_calendar_date(), 0);
 
-  auto monthId = db->insert_data(insert_common_query_, daysElapsed, modelTime, seasonalFactor);
+  auto monthId = next_month_id_++;
+  month_rows_ = writer_->acquire_buffer();
+  month_rows_.begin_row(insert_common_statement_);
+  month_rows_.add(monthId);
+  month_rows_.add(daysElapsed);
+  month_rows_.add(modelTime);
+  month_rows_.add(seasonalFactor);
 
   monthly_report_site_data(monthId);
   if (Model::get_config()->get_model_settings().get_record_genome_db()
@@ -434,6 +457,15 @@ void SQLiteDbReporter::monthly_report() {
     // Add the genome information, this will also update infected individuals
     monthly_report_genome_data(monthId);
   }
+
+  // The month is written in one transaction on the writer thread
+  writer_->submit(std::move(month_rows_));
+}
+
+void SQLiteDbReporter::after_run() {
+  // Wait for the pending months before using the connection again
+  writer_->flush();
+  populate_genotype_table();
 }
 
 void SQLiteDbReporter::batch_insert_query(const std::string &query_prefix,
@@ -451,29 +483,18 @@ void SQLiteDbReporter::batch_insert_query(const std::string &query_prefix,
   }
 }
 
-void SQLiteDbReporter::insert_monthly_site_data(int level_id,
-                                                const std::vector<std::string> &siteData) {
-  // Skip if empty
-  if (siteData.empty()) return;
-
-  // For cell level, use the last index in the query prefix vector
-  int query_index = (level_id == CELL_LEVEL_ID) ? insert_site_query_prefixes_.size() - 1 : level_id;
-
-  // Insert the site data into the database using batch insertion
-  batch_insert_query(insert_site_query_prefixes_[query_index], siteData);
+void SQLiteDbReporter::begin_monthly_site_row(int level_id) {
+  // For cell level, use the last index in the statement vector
+  const auto index =
+      (level_id == CELL_LEVEL_ID) ? insert_site_statements_.size() - 1 : level_id;
+  month_rows_.begin_row(insert_site_statements_[index]);
 }
 
-void SQLiteDbReporter::insert_monthly_genome_data(int level_id,
-                                                  const std::vector<std::string> &genomeData) {
-  // Skip if empty
-  if (genomeData.empty()) return;
-
-  // For cell level, use the last index in the query prefix vector
-  int query_index =
-      (level_id == CELL_LEVEL_ID) ? insert_genome_query_prefixes_.size() - 1 : level_id;
-
-  // Insert the genome data into the database using batch insertion
-  batch_insert_query(insert_genome_query_prefixes_[query_index], genomeData);
+void SQLiteDbReporter::begin_monthly_genome_row(int level_id) {
+  // For cell level, use the last index in the statement vector
+  const auto index =
+      (level_id == CELL_LEVEL_ID) ? insert_genome_statements_.size() - 1 : level_id;
+  month_rows_.begin_row(insert_genome_statements_[index]);
 }
 
 std::string SQLiteDbReporter::get_site_table_name(int level_id) const {
@@ -7,6 +7,7 @@
 #ifndef SQLITEDBREPORTER_H
 #define SQLITEDBREPORTER_H
 
+#include "Utils/Helpers/SQLiteBulkWriter.h"
 #include "Utils/Helpers/SQLiteDatabase.h"
 #include "Reporter.h"
 #include <memory>
@@ -25,11 +26,9 @@ private:
   const std::string insert_location_admin_map_query_ =
       "INSERT INTO location_admin_map (location_id, admin_level_id, admin_unit_id) VALUES (?, ?, ?);";
 
-  const std::string insert_common_query_ = R""""(
-  INSERT INTO monthly_data (days_elapsed, model_time, seasonal_factor)
-  VALUES (?, ?, ?)
-  RETURNING id;
-  )"""";
+  // the month ids are assigned by the reporter, the rows are written by the bulk writer
+  const std::string insert_common_query_prefix_ =
+      "INSERT INTO monthly_data (id, days_elapsed, model_time, seasonal_factor) VALUES";
 
   // Database schema management
   virtual void create_all_reporting_tables();
@@ -43,6 +42,7 @@ private:
   void populate_genotype_table();
   void populate_admin_level_table();
   void populate_location_admin_map_table();
+  void register_insert_statements();
 
   // Utility methods for table names
   virtual std::string get_site_table_name(int level_id) const;
@@ -58,6 +58,17 @@ protected:
   int CELL_LEVEL_ID = -1;
   // Database connection
   std::unique_ptr<SQLiteDatabase> db;
+  // Writes the monthly rows on its own thread, declared after db so it is drained first
+  std::unique_ptr<SQLiteBulkWriter> writer_;
+
+  // Rows of the month being reported, submitted to writer_ at the end of monthly_report()
+  SQLiteRowBuffer month_rows_;
+  int next_month_id_{1};
+
+  // Bulk writer statement ids for each admin level, the cell level last
+  std::size_t insert_common_statement_{0};
+  std::vector<std::size_t> insert_site_statements_;
+  std::vector<std::size_t> insert_genome_statements_;
 
   // Constants for batch size
   static constexpr int DEFAULT_BATCH_SIZE = 1000;
@@ -67,9 +78,10 @@ protected:
   virtual void monthly_report_genome_data(int month_id) = 0;
   virtual void monthly_report_site_data(int month_id) = 0;
 
-  // Data insertion helpers - using level_id = CELL_LEVEL_ID for cell data
-  void insert_monthly_site_data(int level_id, const std::vector<std::string> &site_data);
-  void insert_monthly_genome_data(int level_id, const std::vector<std::string> &genome_data);
+  // Start a site or genome row of the month for level_id, CELL_LEVEL_ID for cell data; the
+  // values are then appended to month_rows_ in the column order of the insert query prefix
+  void begin_monthly_site_row(int level_id);
+  void begin_monthly_genome_row(int level_id);
 
   // Batch insertion helpers
   void batch_insert_query(const std::string &query_prefix, const std::vector<std::string> &values);
@@ -93,9 +105,7 @@ public:
   void before_run() override {}
   void begin_time_step() override {}
   void monthly_report() override;
-  void after_run() override {
-    populate_genotype_table();
-  }
+  void after_run() override;
 
   // Set batch size for database operations
   void set_batch_size(int size) { batch_size = size > 0 ? size : DEFAULT_BATCH_SIZE; }
@@ -9,7 +9,6 @@
 #include "Population/Population.h"
 #include "Simulation//Model.h"
 #include "Spatial/GIS/SpatialData.h"
-#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 
 // Initialize the reporter
 // Sets up the database and prepares it for data entry
@@ -46,19 +45,10 @@ void SQLiteMonthlyReporter::count_infections_for_location(int level_id, int loca
   auto unit_id = (level_id == CELL_LEVEL_ID)
                      ? location_id
                      : Model::get_spatial_data()->get_admin_unit(level_id, location_id);
-  std::vector<int> ageClasses = Model::get_config()->age_structure();
-  auto* index = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
-
-  for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-    for (unsigned int ac = 0; ac < ageClasses.size(); ac++) {
-      for (auto &person : index->vPerson()[location_id][hs][ac]) {
-        // Is the individual infected by at least one parasite?
-        if (person->get_all_clonal_parasite_populations()->empty()) { continue; }
 
-        monthly_site_data_by_level[level_id].infections_by_unit[unit_id]++;
-      }
-    }
-  }
+  // Individuals infected by at least one parasite
+  monthly_site_data_by_level[level_id].infections_by_unit[unit_id] +=
+      Model::get_mdc()->census().infected(location_id);
 }
 
 void SQLiteMonthlyReporter::calculate_and_build_up_site_data_insert_values(int monthId,
@@ -77,8 +67,6 @@ void SQLiteMonthlyReporter::calculate_and_build_up_site_data_insert_values(int m
     max_unit_id = boundary->max_unit_id;
   }
 
-  insert_values.clear();
-
   for (auto unit_id = min_unit_id; unit_id <= max_unit_id; unit_id++) {
     // Skip units with no population
     if (monthly_site_data_by_level[level_id].population[unit_id] == 0) continue;
@@ -103,71 +91,40 @@ void SQLiteMonthlyReporter::calculate_and_build_up_site_data_insert_values(int m
                                          * 100.0
                                    : 0;
 
-    std::string singleRow =
-        fmt::format("({}, {}, {}, {}", monthId, unit_id,
-                    monthly_site_data_by_level[level_id].population[unit_id],
-                    monthly_site_data_by_level[level_id].clinical_episodes[unit_id]);
-
-    // Append clinical episodes by age class
-    for (const auto &episodes :
-         monthly_site_data_by_level[level_id].clinical_episodes_by_age_class[unit_id]) {
-      singleRow += fmt::format(", {}", episodes);
-    }
-
-    for (const auto &treatment :
-         monthly_site_data_by_level[level_id].recrudescence_treatment_by_age_class[unit_id]) {
-      singleRow += fmt::format(", {}", treatment);
-    }
-
-    for (const auto &episodes :
-         monthly_site_data_by_level[level_id].clinical_episodes_by_age[unit_id]) {
-      singleRow += fmt::format(", {}", episodes);
-    }
-
-    for (const auto &population :
-         monthly_site_data_by_level[level_id].population_by_age[unit_id]) {
-      singleRow += fmt::format(", {}", population);
-    }
-
-    for (const auto &immune :
-         monthly_site_data_by_level[level_id].total_immune_by_age[unit_id]) {
-      singleRow += fmt::format(", {}", immune);
-    }
-
-    for (const auto &treatment :
-         monthly_site_data_by_level[level_id].recrudescence_treatment_by_age[unit_id]) {
-      singleRow += fmt::format(", {}", treatment);
-    }
-
-    for (const auto &moi :
-         monthly_site_data_by_level[level_id].multiple_of_infection[unit_id]) {
-      singleRow += fmt::format(", {}", moi);
-    }
-
-    // Append age-indexed seeking-treatment counts (if present)
-    for (const auto &count : monthly_site_data_by_level[level_id].number_of_people_seeking_treatment_by_location_age_index[unit_id]) {
-      singleRow += fmt::format(", {}", count);
-    }
-
-    singleRow +=
-        fmt::format(", {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})",
-                    monthly_site_data_by_level[level_id].treatments[unit_id], calculatedEir,
-                    calculatedPfprUnder5, calculatedPfpr2to10, calculatedPfprAll,
-                    monthly_site_data_by_level[level_id].infections_by_unit[unit_id],
-                    monthly_site_data_by_level[level_id].treatment_failures[unit_id],
-                    monthly_site_data_by_level[level_id].nontreatment[unit_id],
-                    monthly_site_data_by_level[level_id].treatments_under5[unit_id],
-                    monthly_site_data_by_level[level_id].treatments_over5[unit_id],
-                    monthly_site_data_by_level[level_id].progress_to_clinical_in_7d_total[unit_id],
-                    monthly_site_data_by_level[level_id].progress_to_clinical_in_7d_recrudescence[unit_id],
-                    monthly_site_data_by_level[level_id].progress_to_clinical_in_7d_new_infection[unit_id],
-                    monthly_site_data_by_level[level_id].recrudescence_treatment[unit_id],
-                    monthly_site_data_by_level[level_id].total_number_of_bites_by_location[unit_id],
-                    monthly_site_data_by_level[level_id].total_number_of_bites_by_location_year[unit_id],
-                    monthly_site_data_by_level[level_id].person_days_by_location_year[unit_id],
-                    monthly_site_data_by_level[level_id].current_foi_by_location[unit_id]);
-
-    insert_values.push_back(singleRow);
+    const auto &site_data = monthly_site_data_by_level[level_id];
+    begin_monthly_site_row(level_id);
+    month_rows_.add(monthId);
+    month_rows_.add(unit_id);
+    month_rows_.add(site_data.population[unit_id]);
+    month_rows_.add(site_data.clinical_episodes[unit_id]);
+    month_rows_.add_all(site_data.clinical_episodes_by_age_class[unit_id]);
+    month_rows_.add_all(site_data.recrudescence_treatment_by_age_class[unit_id]);
+    month_rows_.add_all(site_data.clinical_episodes_by_age[unit_id]);
+    month_rows_.add_all(site_data.population_by_age[unit_id]);
+    month_rows_.add_all(site_data.total_immune_by_age[unit_id]);
+    month_rows_.add_all(site_data.recrudescence_treatment_by_age[unit_id]);
+    month_rows_.add_all(site_data.multiple_of_infection[unit_id]);
+    // age-indexed seeking-treatment counts
+    month_rows_.add_all(
+        site_data.number_of_people_seeking_treatment_by_location_age_index[unit_id]);
+    month_rows_.add(site_data.treatments[unit_id]);
+    month_rows_.add(calculatedEir);
+    month_rows_.add(calculatedPfprUnder5);
+    month_rows_.add(calculatedPfpr2to10);
+    month_rows_.add(calculatedPfprAll);
+    month_rows_.add(site_data.infections_by_unit[unit_id]);
+    month_rows_.add(site_data.treatment_failures[unit_id]);
+    month_rows_.add(site_data.nontreatment[unit_id]);
+    month_rows_.add(site_data.treatments_under5[unit_id]);
+    month_rows_.add(site_data.treatments_over5[unit_id]);
+    month_rows_.add(site_data.progress_to_clinical_in_7d_total[unit_id]);
+    month_rows_.add(site_data.progress_to_clinical_in_7d_recrudescence[unit_id]);
+    month_rows_.add(site_data.progress_to_clinical_in_7d_new_infection[unit_id]);
+    month_rows_.add(site_data.recrudescence_treatment[unit_id]);
+    month_rows_.add(site_data.total_number_of_bites_by_location[unit_id]);
+    month_rows_.add(site_data.total_number_of_bites_by_location_year[unit_id]);
+    month_rows_.add(site_data.person_days_by_location_year[unit_id]);
+    month_rows_.add(site_data.current_foi_by_location[unit_id]);
   }
 }
 
@@ -175,8 +132,6 @@ void SQLiteMonthlyReporter::calculate_and_build_up_site_data_insert_values(int m
 // Aggregates data related to various site metrics and stores them in the
 // database
 void SQLiteMonthlyReporter::monthly_report_site_data(int monthId) {
-  TransactionGuard transaction{db.get()};
-
   // Handle all levels including cell level in a single loop
   int total_levels = monthly_site_data_by_level.size();
 
@@ -203,7 +158,7 @@ void SQLiteMonthlyReporter::monthly_report_site_data(int monthId) {
 
     // Collect data for this admin level
     for (auto location = 0; location < Model::get_config()->number_of_locations(); location++) {
-      auto locationPopulation = static_cast<int>(Model::get_population()->size(location));
+      auto locationPopulation = Model::get_mdc()->census().population(location);
       if (locationPopulation == 0) continue;
 
       collect_site_data_for_location(location, level_id);
@@ -211,7 +166,6 @@ void SQLiteMonthlyReporter::monthly_report_site_data(int monthId) {
 
     // Calculate and insert data for this admin level
     calculate_and_build_up_site_data_insert_values(monthId, level_id);
-    insert_monthly_site_data(level_id, insert_values);
   }
 }
 
@@ -225,7 +179,7 @@ void SQLiteMonthlyReporter::collect_site_data_for_location(int location_id, int
 
   count_infections_for_location(level_id, location_id);
 
-  auto locationPopulation = static_cast<int>(Model::get_population()->size(location_id));
+  auto locationPopulation = Model::get_mdc()->census().population(location_id);
   // Collect the simple data
   monthly_site_data_by_level[level_id].population[unit_id] += static_cast<int>(locationPopulation);
 
@@ -346,18 +300,19 @@ void SQLiteMonthlyReporter::collect_genome_data_for_location(size_t location_id,
   auto unit_id = (level_id == CELL_LEVEL_ID)
                      ? location_id
                      : Model::get_spatial_data()->get_admin_unit(level_id, location_id);
-  auto* index = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
-  auto ageClasses = index->vPerson()[0][0].size();
-
-  for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-    // Iterate over all the age classes
-    for (unsigned int ac = 0; ac < ageClasses; ac++) {
-      // Iterate over all the genotypes
-      auto peopleInAgeClass = index->vPerson()[location_id][hs][ac];
-      for (auto &person : peopleInAgeClass) {
-        collect_genome_data_for_a_person(person, unit_id, level_id);
-      }
-    }
+  const auto &census = Model::get_mdc()->census();
+  auto &genome_data = monthly_genome_data_by_level[level_id];
+
+  // Iterate over the genotypes carried in the location
+  const auto location = static_cast<int>(location_id);
+  for (auto entry = census.genotype_begin(location); entry < census.genotype_end(location);
+       entry++) {
+    const auto genotypeId = census.genotype_id(entry);
+    genome_data.occurrences[unit_id][genotypeId] += census.clones(entry);
+    genome_data.clinical_occurrences[unit_id][genotypeId] += census.clinical_clones(entry);
+    genome_data.occurrences_0_5[unit_id][genotypeId] += census.clones_0_5(entry);
+    genome_data.occurrences_2_10[unit_id][genotypeId] += census.clones_2_10(entry);
+    genome_data.weighted_occurrences[unit_id][genotypeId] += census.weighted_carriers(entry);
   }
 }
 
@@ -420,43 +375,6 @@ void SQLiteMonthlyReporter::reset_genome_data_structures(int level_id, int vecto
       vector_size, std::vector<double>(numGenotypes, 0));
 }
 
-void SQLiteMonthlyReporter::collect_genome_data_for_a_person(Person* person, int unit_id,
-                                                             int level_id) {
-  const auto numGenotypes = Model::get_config()->number_of_parasite_types();
-  auto individual = std::vector<int>(numGenotypes, 0);
-  // Get the person, press on if they are not infected
-  auto &parasites = *person->get_all_clonal_parasite_populations();
-  auto numClones = parasites.size();
-  if (numClones == 0) { return; }
-
-  // Note the age and clinical status of the person
-  auto age = person->get_age();
-  auto clinical = static_cast<int>(person->get_host_state() == Person::HostStates::CLINICAL);
-
-  // Count the genotypes present in the individual
-  for (unsigned int ndx = 0; ndx < numClones; ndx++) {
-    auto* parasitePopulation = parasites[ndx];
-    auto genotypeId = parasitePopulation->genotype()->genotype_id();
-    monthly_genome_data_by_level[level_id].occurrences[unit_id][genotypeId]++;
-    monthly_genome_data_by_level[level_id].occurrences_0_5[unit_id][genotypeId] +=
-        (age <= 5) ? 1 : 0;
-    monthly_genome_data_by_level[level_id].occurrences_2_10[unit_id][genotypeId] +=
-        (age >= 2 && age <= 10) ? 1 : 0;
-    individual[genotypeId]++;
-
-    // Count a clinical occurrence if the individual has clinical
-    // symptoms
-    monthly_genome_data_by_level[level_id].clinical_occurrences[unit_id][genotypeId] += clinical;
-  }
-
-  // Update the weighted occurrences and reset the individual count
-  for (unsigned int ndx = 0; ndx < numGenotypes; ndx++) {
-    if (individual[ndx] == 0) { continue; }
-    monthly_genome_data_by_level[level_id].weighted_occurrences[unit_id][ndx] +=
-        (individual[ndx] / static_cast<double>(numClones));
-  }
-}
-
 void SQLiteMonthlyReporter::build_up_genome_data_insert_values(int monthId, int level_id) {
   auto numGenotypes = Model::get_config()->number_of_parasite_types();
 
@@ -473,8 +391,6 @@ void SQLiteMonthlyReporter::build_up_genome_data_insert_values(int monthId, int
     max_unit_id = boundary->max_unit_id;
   }
 
-  insert_values.clear();
-
   // Iterate over the admin units and append the query
   for (auto unit_id = min_unit_id; unit_id <= max_unit_id; unit_id++) {
     // Skip if there are no infections in this unit
@@ -484,22 +400,21 @@ void SQLiteMonthlyReporter::build_up_genome_data_insert_values(int monthId, int
       if (monthly_genome_data_by_level[level_id].weighted_occurrences[unit_id][genotype] == 0) {
         continue;
       }
-      std::string singleRow = fmt::format(
-          "({}, {}, {}, {}, {}, {}, {}, {})", monthId, unit_id, genotype,
-          monthly_genome_data_by_level[level_id].occurrences[unit_id][genotype],
-          monthly_genome_data_by_level[level_id].clinical_occurrences[unit_id][genotype],
-          monthly_genome_data_by_level[level_id].occurrences_0_5[unit_id][genotype],
-          monthly_genome_data_by_level[level_id].occurrences_2_10[unit_id][genotype],
-          monthly_genome_data_by_level[level_id].weighted_occurrences[unit_id][genotype]);
-
-      insert_values.push_back(singleRow);
+      const auto &genome_data = monthly_genome_data_by_level[level_id];
+      begin_monthly_genome_row(level_id);
+      month_rows_.add(monthId);
+      month_rows_.add(unit_id);
+      month_rows_.add(genotype);
+      month_rows_.add(genome_data.occurrences[unit_id][genotype]);
+      month_rows_.add(genome_data.clinical_occurrences[unit_id][genotype]);
+      month_rows_.add(genome_data.occurrences_0_5[unit_id][genotype]);
+      month_rows_.add(genome_data.occurrences_2_10[unit_id][genotype]);
+      month_rows_.add(genome_data.weighted_occurrences[unit_id][genotype]);
     }
   }
 }
 
 void SQLiteMonthlyReporter::monthly_report_genome_data(int monthId) {
-  TransactionGuard transaction{db.get()};
-
   // Get admin levels count
   int admin_level_count = monthly_site_data_by_level.size();
 
@@ -525,24 +440,21 @@ void SQLiteMonthlyReporter::monthly_report_genome_data(int monthId) {
 
     reset_genome_data_structures(level_id, vector_size, numGenotypes);
 
-    auto* index = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
-
     // Iterate over all locations
-    for (auto location = 0; location < index->vPerson().size(); location++) {
+    for (auto location = 0; location < Model::get_mdc()->census().number_of_locations();
+         location++) {
       collect_genome_data_for_location(location, level_id);
     }
 
+    const auto rows_before = month_rows_.number_of_rows();
     build_up_genome_data_insert_values(monthId, level_id);
 
-    if (insert_values.empty()) {
+    if (month_rows_.number_of_rows() == rows_before) {
       spdlog::info(
           "No genotypes recorded in the simulation at timestep, "
           "{}",
           Model::get_scheduler()->current_time());
-      continue;
     }
-
-    insert_monthly_genome_data(level_id, insert_values);
   }
 }
 
@@ -63,8 +63,6 @@ protected:
   std::vector<MonthlySiteData> monthly_site_data_by_level;
   std::vector<MonthlyGenomeData> monthly_genome_data_by_level;
 
-  std::vector<std::string> insert_values;
-
 private:
   void reset_site_data_structures(int level_id, int vector_size, size_t numAgeClasses);
   void reset_genome_data_structures(int level_id, int vector_size, size_t numGenotypes);
@@ -72,7 +70,6 @@ private:
   void collect_site_data_for_location(int location, int level_id);
   void calculate_and_build_up_site_data_insert_values(int monthId, int level_id);
   void collect_genome_data_for_location(size_t location, int level_id);
-  void collect_genome_data_for_a_person(Person* person, int unit_id, int level_id);
   void build_up_genome_data_insert_values(int monthId, int level_id);
 
 public:
@@ -59,7 +59,6 @@ protected:
 
   std::vector<MonthlySiteData> monthly_site_data_by_level;
   std::vector<MonthlyGenomeData> monthly_genome_data_by_level;
-  std::vector<std::string> insert_values;
 
 private:
   void create_all_reporting_tables() override;
@@ -78,7 +77,6 @@ private:
   void collect_site_data_for_location(int location, int level_id);
   void calculate_and_build_up_site_data_insert_values(int monthId, int level_id);
   void collect_genome_data_for_location(size_t location, int level_id);
-  void collect_genome_data_for_a_person(Person* person, int unit_id, int level_id);
   void build_up_genome_data_insert_values(int monthId, int level_id);
 };
 
@@ -89,12 +89,12 @@ void CellularReporter::monthly_report() {
         for (auto& parasite_population : parasites) {
           parasiteClones++;
 
-          if (parasite_population->genotype()->get_aa_sequence()[2] == 1) {
+          if (parasite_population.genotype()->get_aa_sequence()[2] == 1) {
             _580yCount++;
             _580yWeighted += (1.0 / static_cast<double>(parasites.size()));
           }
 
-          if (parasite_population->genotype()->get_aa_sequence()[3] == 1) {
+          if (parasite_population.genotype()->get_aa_sequence()[3] == 1) {
             plasmepsinDoubleCopy++;
             plasmepsinDoubleCopyWeighted += (1.0 / static_cast<double>(parasites.size()));
           }
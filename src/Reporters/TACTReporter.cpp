@@ -7,7 +7,6 @@
 #include <Simulation/Model.h>
 #include <Treatment/Strategies/IStrategy.h>
 #include <Treatment/Strategies/NestedMFTStrategy.h>
-#include <Utils/Index/PersonIndexByLocationStateAgeClass.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
@@ -79,9 +78,7 @@ void TACTReporter::monthly_report() {
     ss << Model::get_mdc()->monthly_number_of_clinical_episode_by_location()[loc] << sep;
   }
 
-  output_genotype_frequency_3(
-      Model::get_genotype_db()->size(),
-      Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
+  output_genotype_frequency_3(Model::get_genotype_db()->size(), Model::get_mdc()->census());
 
   ss << group_sep;
 
@@ -124,48 +121,13 @@ void TACTReporter::after_run() {
 void TACTReporter::begin_time_step() {}
 
 void TACTReporter::output_genotype_frequency_3(const int &number_of_genotypes,
-                                               PersonIndexByLocationStateAgeClass* pi) {
-  auto sum1_all = 0.0;
-  std::vector<double> result3_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
-
-  for (auto loc = 0; loc < number_of_locations; loc++) {
+                                               const PopulationCensus &census) {
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
     std::vector<double> result3(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ull; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->get_all_clonal_parasite_populations()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            if (individual_genotype_map.find(g_id) == individual_genotype_map.end()) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result3[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-            result3_all[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          }
-        }
-      }
+    const auto sum1 = static_cast<double>(census.infected(loc));
+
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      result3[census.genotype_id(entry)] += census.weighted_carriers(entry);
     }
     // output per location
     for (auto &i : result3) {
@@ -5,7 +5,7 @@
 #include <sstream>
 #include "Reporter.h"
 
-class PersonIndexByLocationStateAgeClass;
+class PopulationCensus;
 
 class TACTReporter : public Reporter {
 public:
@@ -36,7 +36,7 @@ public:
 private:
   void output_genotype_frequency_3(
       const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      const PopulationCensus& census
   );
 
 public:
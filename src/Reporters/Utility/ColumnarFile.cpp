@@ -0,0 +1,257 @@
+#include "ColumnarFile.h"
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+static_assert(std::endian::native == std::endian::little,
+              "the columnar format is written in the byte order of the host");
+
+namespace {
+constexpr char MAGIC[8] = {'M', 'A', 'L', 'A', 'S', 'C', 'O', 'L'};
+
+template <typename T>
+void append(std::string &buffer, T value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void append_string(std::string &buffer, const std::string &value) {
+  append(buffer, static_cast<uint32_t>(value.size()));
+  buffer.append(value);
+}
+
+// Bounds-checked cursor over a byte range
+class Cursor {
+public:
+  Cursor(const char* data, std::size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  T read() {
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    return {take(length), length};
+  }
+
+  const char* take(std::size_t size) {
+    if (size > size_ - position_) { throw std::runtime_error("Truncated columnar data."); }
+    const auto* result = data_ + position_;
+    position_ += size;
+    return result;
+  }
+
+  [[nodiscard]] bool at_end() const { return position_ == size_; }
+
+private:
+  const char* data_;
+  std::size_t size_;
+  std::size_t position_{0};
+};
+
+void decode_column(ColumnChunk::Column &column, const std::string &raw, uint32_t rows) {
+  Cursor cursor{raw.data(), raw.size()};
+  if (column.encoding == ColumnChunk::Encoding::DICTIONARY) {
+    if (column.type != ColumnChunk::Type::INT64) {
+      throw std::runtime_error("Dictionary encoding is only defined for integer columns.");
+    }
+    std::vector<int64_t> dictionary(cursor.read<uint32_t>());
+    for (auto &value : dictionary) { value = cursor.read<int64_t>(); }
+    column.integers.resize(rows);
+    for (auto &value : column.integers) {
+      const auto index = cursor.read<uint32_t>();
+      if (index >= dictionary.size()) {
+        throw std::runtime_error("Dictionary index out of range in column " + column.name);
+      }
+      value = dictionary[index];
+    }
+  } else if (column.type == ColumnChunk::Type::INT64) {
+    column.integers.resize(rows);
+    for (auto &value : column.integers) { value = cursor.read<int64_t>(); }
+  } else if (column.type == ColumnChunk::Type::FLOAT64) {
+    column.reals.resize(rows);
+    for (auto &value : column.reals) { value = cursor.read<double>(); }
+  } else {
+    column.strings.resize(rows);
+    for (auto &value : column.strings) { value = cursor.read_string(); }
+  }
+  if (!cursor.at_end()) {
+    throw std::runtime_error("Unexpected trailing data in column " + column.name);
+  }
+}
+}  // namespace
+
+std::size_t ColumnChunk::Column::size() const {
+  switch (type) {
+  case Type::INT64:
+    return integers.size();
+  case Type::FLOAT64:
+    return reals.size();
+  case Type::STRING:
+    return strings.size();
+  }
+  return 0;
+}
+
+ColumnChunk::Column &ColumnChunk::add_integer_column(const std::string &name, Encoding encoding) {
+  auto &column = columns.emplace_back();
+  column.name = name;
+  column.type = Type::INT64;
+  column.encoding = encoding;
+  return column;
+}
+
+ColumnChunk::Column &ColumnChunk::add_real_column(const std::string &name) {
+  auto &column = columns.emplace_back();
+  column.name = name;
+  column.type = Type::FLOAT64;
+  return column;
+}
+
+ColumnChunk::Column &ColumnChunk::add_string_column(const std::string &name) {
+  auto &column = columns.emplace_back();
+  column.name = name;
+  column.type = Type::STRING;
+  return column;
+}
+
+std::size_t ColumnChunk::number_of_rows() const {
+  return columns.empty() ? 0 : columns.front().size();
+}
+
+const ColumnChunk::Column* ColumnChunk::find(const std::string &name) const {
+  for (const auto &column : columns) {
+    if (column.name == name) { return &column; }
+  }
+  return nullptr;
+}
+
+ColumnarFileWriter::ColumnarFileWriter(const std::string &path, int compression_level)
+    : out_(path, std::ios::binary | std::ios::trunc),
+      compression_level_(compression_level),
+      context_(ZSTD_createCCtx()) {
+  if (!out_) { throw std::runtime_error("Cannot open columnar file " + path); }
+  std::string header{MAGIC, sizeof(MAGIC)};
+  append(header, ColumnChunk::FORMAT_VERSION);
+  out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+ColumnarFileWriter::~ColumnarFileWriter() { ZSTD_freeCCtx(context_); }
+
+void ColumnarFileWriter::write(const ColumnChunk &chunk) {
+  const auto rows = chunk.number_of_rows();
+  for (const auto &column : chunk.columns) {
+    if (column.size() != rows) {
+      throw std::invalid_argument("Column " + column.name + " of table " + chunk.table
+                                  + " does not have the number of rows of the chunk.");
+    }
+  }
+
+  std::string header;
+  append_string(header, chunk.table);
+  append_string(header, chunk.level);
+  append(header, chunk.days_elapsed);
+  append(header, chunk.model_time);
+  append(header, static_cast<uint32_t>(rows));
+  append(header, static_cast<uint32_t>(chunk.columns.size()));
+  out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+  for (const auto &column : chunk.columns) { write_column(column); }
+}
+
+void ColumnarFileWriter::flush() { out_.flush(); }
+
+void ColumnarFileWriter::write_column(const ColumnChunk::Column &column) {
+  raw_.clear();
+  if (column.encoding == ColumnChunk::Encoding::DICTIONARY) {
+    if (column.type != ColumnChunk::Type::INT64) {
+      throw std::invalid_argument("Dictionary encoding is only defined for integer columns.");
+    }
+    std::vector<int64_t> dictionary{column.integers};
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+    append(raw_, static_cast<uint32_t>(dictionary.size()));
+    for (const auto value : dictionary) { append(raw_, value); }
+    for (const auto value : column.integers) {
+      const auto index = std::lower_bound(dictionary.begin(), dictionary.end(), value)
+                         - dictionary.begin();
+      append(raw_, static_cast<uint32_t>(index));
+    }
+  } else if (column.type == ColumnChunk::Type::INT64) {
+    raw_.append(reinterpret_cast<const char*>(column.integers.data()),
+                column.integers.size() * sizeof(int64_t));
+  } else if (column.type == ColumnChunk::Type::FLOAT64) {
+    raw_.append(reinterpret_cast<const char*>(column.reals.data()),
+                column.reals.size() * sizeof(double));
+  } else {
+    for (const auto &value : column.strings) { append_string(raw_, value); }
+  }
+
+  compressed_.resize(ZSTD_compressBound(raw_.size()));
+  const auto compressed_size = ZSTD_compressCCtx(context_, compressed_.data(), compressed_.size(),
+                                                 raw_.data(), raw_.size(), compression_level_);
+  if (ZSTD_isError(compressed_size) != 0U) {
+    throw std::runtime_error(std::string("Error compressing column ") + column.name + ": "
+                             + ZSTD_getErrorName(compressed_size));
+  }
+
+  std::string header;
+  append_string(header, column.name);
+  append(header, static_cast<uint8_t>(column.type));
+  append(header, static_cast<uint8_t>(column.encoding));
+  append(header, static_cast<uint64_t>(raw_.size()));
+  append(header, static_cast<uint64_t>(compressed_size));
+  out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+  out_.write(compressed_.data(), static_cast<std::streamsize>(compressed_size));
+}
+
+std::vector<ColumnChunk> ColumnarFileReader::read_all(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) { throw std::runtime_error("Cannot open columnar file " + path); }
+  const std::string content{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+  Cursor cursor{content.data(), content.size()};
+  if (content.size() < sizeof(MAGIC)
+      || std::memcmp(cursor.take(sizeof(MAGIC)), MAGIC, sizeof(MAGIC)) != 0) {
+    throw std::runtime_error(path + " is not a columnar file.");
+  }
+  if (const auto version = cursor.read<uint32_t>(); version != ColumnChunk::FORMAT_VERSION) {
+    throw std::runtime_error("Unsupported columnar format version " + std::to_string(version));
+  }
+
+  std::vector<ColumnChunk> chunks;
+  std::string raw;
+  while (!cursor.at_end()) {
+    auto &chunk = chunks.emplace_back();
+    chunk.table = cursor.read_string();
+    chunk.level = cursor.read_string();
+    chunk.days_elapsed = cursor.read<int32_t>();
+    chunk.model_time = cursor.read<int64_t>();
+    const auto rows = cursor.read<uint32_t>();
+    chunk.columns.resize(cursor.read<uint32_t>());
+
+    for (auto &column : chunk.columns) {
+      column.name = cursor.read_string();
+      column.type = static_cast<ColumnChunk::Type>(cursor.read<uint8_t>());
+      column.encoding = static_cast<ColumnChunk::Encoding>(cursor.read<uint8_t>());
+      const auto raw_size = cursor.read<uint64_t>();
+      const auto compressed_size = cursor.read<uint64_t>();
+      const auto* compressed = cursor.take(compressed_size);
+
+      raw.resize(raw_size);
+      const auto size = ZSTD_decompress(raw.data(), raw.size(), compressed, compressed_size);
+      if (ZSTD_isError(size) != 0U || size != raw_size) {
+        throw std::runtime_error("Error decompressing column " + column.name);
+      }
+      decode_column(column, raw, rows);
+    }
+  }
+  return chunks;
+}
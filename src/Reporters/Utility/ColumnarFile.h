@@ -0,0 +1,99 @@
+/*
+ * ColumnarFile.h
+ *
+ * Self-describing binary columnar format used by the ColumnarReporter.
+ *
+ * A file is the header "MALASCOL" followed by the format version (uint32) and a sequence of
+ * chunks. A chunk holds the rows of one table for one month and one reporting level:
+ *
+ *   table, level (string), days elapsed (int32), model time (int64), rows, columns (uint32)
+ *   then for every column:
+ *     name (string), type, encoding (uint8), raw size, compressed size (uint64),
+ *     the zstd-compressed column data
+ *
+ * Strings are a uint32 length followed by the bytes; all numbers are little-endian. The raw data
+ * of a PLAIN column is its values, int64, float64 or strings. A DICTIONARY column stores the
+ * sorted distinct values (a uint32 count then the int64 values) followed by the uint32 index of
+ * every row into them, which suits the repetitive location, unit and genotype id columns.
+ */
+#ifndef COLUMNARFILE_H
+#define COLUMNARFILE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct ZSTD_CCtx_s;
+
+struct ColumnChunk {
+  static constexpr uint32_t FORMAT_VERSION = 1;
+
+  enum class Type : uint8_t { INT64 = 0, FLOAT64 = 1, STRING = 2 };
+  enum class Encoding : uint8_t { PLAIN = 0, DICTIONARY = 1 };
+
+  struct Column {
+    std::string name;
+    Type type{Type::INT64};
+    Encoding encoding{Encoding::PLAIN};
+    // the values of the column type, the others are empty
+    std::vector<int64_t> integers;
+    std::vector<double> reals;
+    std::vector<std::string> strings;
+
+    [[nodiscard]] std::size_t size() const;
+  };
+
+  std::string table;
+  std::string level;
+  int32_t days_elapsed{0};
+  int64_t model_time{0};
+  std::vector<Column> columns;
+
+  // Add a column and return it for filling, the reference is valid until the next add
+  Column &add_integer_column(const std::string &name, Encoding encoding = Encoding::PLAIN);
+  Column &add_real_column(const std::string &name);
+  Column &add_string_column(const std::string &name);
+
+  // Rows of the first column, every column has the same number of rows
+  [[nodiscard]] std::size_t number_of_rows() const;
+  [[nodiscard]] const Column* find(const std::string &name) const;
+};
+
+// Appends ColumnChunks to a columnar file, a new file replaces an existing one
+class ColumnarFileWriter {
+public:
+  static constexpr int DEFAULT_COMPRESSION_LEVEL = 3;
+
+  explicit ColumnarFileWriter(const std::string &path,
+                              int compression_level = DEFAULT_COMPRESSION_LEVEL);
+  ~ColumnarFileWriter();
+
+  ColumnarFileWriter(const ColumnarFileWriter &) = delete;
+  ColumnarFileWriter &operator=(const ColumnarFileWriter &) = delete;
+  ColumnarFileWriter(ColumnarFileWriter &&) = delete;
+  ColumnarFileWriter &operator=(ColumnarFileWriter &&) = delete;
+
+  // Throws std::invalid_argument if the columns do not have the same number of rows
+  void write(const ColumnChunk &chunk);
+  void flush();
+
+private:
+  void write_column(const ColumnChunk::Column &column);
+
+  std::ofstream out_;
+  int compression_level_;
+  ZSTD_CCtx_s* context_{nullptr};
+  // reused between columns
+  std::string raw_;
+  std::string compressed_;
+};
+
+// Reads back every chunk of a columnar file, dictionary columns are decoded to their values
+class ColumnarFileReader {
+public:
+  // Throws std::runtime_error if the file cannot be read or is not a columnar file
+  static std::vector<ColumnChunk> read_all(const std::string &path);
+};
+
+#endif  // COLUMNARFILE_H
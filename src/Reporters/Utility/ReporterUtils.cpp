@@ -6,16 +6,15 @@
 
 #include <Configuration/Config.h>
 
+#include <map>
 #include <vector>
 
 #include "Core/Scheduler/Scheduler.h"
+#include "MDC/PopulationCensus.h"
 #include "Mosquito/Mosquito.h"
 #include "Parasites/Genotype.h"
-#include "Population/ClonalParasitePopulation.h"
-#include "Population/SingleHostClonalParasitePopulations.h"
 #include "Simulation/Model.h"
 #include "Utils/Cli.h"
-#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "spdlog/sinks/basic_file_sink.h"
 
 const std::string GROUP_SEP = "-1111\t";
@@ -23,46 +22,18 @@ const std::string SEP = "\t";
 
 void ReporterUtils::output_genotype_frequency1(std::stringstream &ss,
                                                const int &number_of_genotypes,
-                                               PersonIndexByLocationStateAgeClass* pi) {
+                                               const PopulationCensus &census) {
   auto sum1_all = 0.0;
   std::vector<double> result1_all(number_of_genotypes, 0.0);
 
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
-
-  for (auto loc = 0; loc < number_of_locations; loc++) {
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
     std::vector<double> result1(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ULL; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->get_all_clonal_parasite_populations()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-          // sum2 += person->get_all_clonal_parasite_populations()->parasites()->size();
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            // result2[g_id] += 1;
-            if (!individual_genotype_map.contains(g_id)) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result1[genotype.first] += 1;
-            result1_all[genotype.first] += 1;
-          }
-        }
-      }
+    const auto sum1 = static_cast<double>(census.infected(loc));
+    sum1_all += sum1;
+
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      result1[census.genotype_id(entry)] += census.carriers(entry);
+      result1_all[census.genotype_id(entry)] += census.carriers(entry);
     }
 
     for (auto &genotype_count : result1) {
@@ -79,33 +50,18 @@ void ReporterUtils::output_genotype_frequency1(std::stringstream &ss,
 
 void ReporterUtils::output_genotype_frequency2(std::stringstream &ss,
                                                const int &number_of_genotypes,
-                                               PersonIndexByLocationStateAgeClass* pi) {
+                                               const PopulationCensus &census) {
   auto sum2_all = 0.0;
   std::vector<double> result2_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
 
-  for (auto loc = 0; loc < number_of_locations; loc++) {
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
     std::vector<double> result2(number_of_genotypes, 0.0);
-    auto sum2 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ULL; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          sum2 += static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          sum2_all += sum2;
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            result2[g_id] += 1;
-            result2_all[g_id] += 1;
-          }
-        }
-      }
+    const auto sum2 = static_cast<double>(census.number_of_clones(loc));
+    sum2_all += sum2;
+
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      result2[census.genotype_id(entry)] += census.clones(entry);
+      result2_all[census.genotype_id(entry)] += census.clones(entry);
     }
 
     // output for each location
@@ -124,123 +80,42 @@ void ReporterUtils::output_genotype_frequency2(std::stringstream &ss,
 
 void ReporterUtils::output_genotype_frequency3(std::stringstream &ss,
                                                const int &number_of_genotypes,
-                                               PersonIndexByLocationStateAgeClass* pi) {
+                                               const PopulationCensus &census) {
   auto sum1_all = 0.0;
   std::vector<double> result3_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
 
-  for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result3(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ULL; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->get_all_clonal_parasite_populations()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            if (!individual_genotype_map.contains(g_id)) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-            //            individual_genotype_cr[parasite_population->genotype()->genotype_id()] =
-            //            parasite_population->genotype()->daily_fitness_multiple_infection;
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result3[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-            result3_all[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          }
-        }
-      }
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
+    sum1_all += census.infected(loc);
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      result3_all[census.genotype_id(entry)] += census.weighted_carriers(entry);
     }
     // output per location
     // TODO: implement dynamic way to output for each location
   }
-  //  ss << group_sep;
 
   // this is for all locations
   for (auto &weighted_genotype : result3_all) {
     weighted_genotype /= sum1_all;
     ss << (sum1_all == 0 ? 0 : weighted_genotype) << SEP;
   }
-  //
-  //  ss << group_sep;
-  //  ss << sum1_all << sep;
 }
 
 void ReporterUtils::output_genotype_frequency4(std::stringstream &ss, std::stringstream &ss2,
                                                const int &number_of_genotypes,
-                                               PersonIndexByLocationStateAgeClass* pi) {
+                                               const PopulationCensus &census) {
   auto sum1_all = 0.0;
   std::vector<double> result4_all(number_of_genotypes, 0.0);
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
 
-  for (auto loc = 0; loc < number_of_locations; loc++) {
-    std::vector<double> result4(number_of_genotypes, 0.0);
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
     std::vector<double> prmc4(number_of_genotypes, 0.0);
-    std::vector<double> prmc4_all(number_of_genotypes, 0.0);
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ULL; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->get_all_clonal_parasite_populations()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            if (!individual_genotype_map.contains(g_id)) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-            //            individual_genotype_cr[parasite_population->genotype()->genotype_id()] =
-            //            parasite_population->genotype()->daily_fitness_multiple_infection;
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result4[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-            result4_all[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          }
-        }
-      }
+
+    sum1_all += census.infected(loc);
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      result4_all[census.genotype_id(entry)] += census.weighted_carriers(entry);
     }
     // output per location
     // TODO: implement dynamic way to output for each location
 
-    //    for (auto& i : result3) {
-    //      i /= sum1;
-    //      ss << (sum1 == 0 ? 0 : i) << sep;
-    //    }
-
     std::map<int, int> prmc_genotype_map;
     auto tracking_day =
         Model::get_scheduler()->current_time() % Model::get_config()->number_of_tracking_days();
@@ -264,83 +139,46 @@ void ReporterUtils::output_genotype_frequency4(std::stringstream &ss, std::strin
         prmc4[genotype.first] +=
             genotype.second
             / static_cast<double>(Model::get_mosquito()->genotypes_table[tracking_day][loc].size());
-        prmc4_all[genotype.first] +=
-            genotype.second
-            / static_cast<double>(Model::get_mosquito()->genotypes_table[tracking_day][loc].size());
       }
 
       for (auto &weighted_genotype : prmc4) { ss2 << weighted_genotype << SEP; }
     }
   }
-  //  ss << group_sep;
 
   // this is for all locations
   for (auto &weighted_genotyp : result4_all) {
     weighted_genotyp /= sum1_all;
     ss << (sum1_all == 0 ? 0 : weighted_genotyp) << SEP;
   }
-  //
-  //  ss << group_sep;
-  //  ss << sum1_all << sep;
 }
 
 void ReporterUtils::output_3_genotype_frequency(std::stringstream &ss,
                                                 const int &number_of_genotypes,
-                                                PersonIndexByLocationStateAgeClass* pi) {
+                                                const PopulationCensus &census) {
   auto sum1_all = 0.0;
   auto sum2_all = 0.0;
   std::vector<double> result1_all(number_of_genotypes, 0.0);
   std::vector<double> result2_all(number_of_genotypes, 0.0);
   std::vector<double> result3_all(number_of_genotypes, 0.0);
 
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
-
-  for (auto loc = 0; loc < number_of_locations; loc++) {
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
     std::vector<double> result1(number_of_genotypes, 0.0);
     std::vector<double> result2(number_of_genotypes, 0.0);
     std::vector<double> result3(number_of_genotypes, 0.0);
 
-    auto sum2 = 0.0;
-    auto sum1 = 0.0;
-
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0; ac < number_of_age_classes; ac++) {
-        const auto size = pi->vPerson()[loc][hs][ac].size();
-        for (auto i = 0ULL; i < size; i++) {
-          auto* person = pi->vPerson()[loc][hs][ac][i];
-
-          if (!person->get_all_clonal_parasite_populations()->empty()) {
-            sum1 += 1;
-            sum1_all += 1;
-          }
-          sum2 += static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          sum2_all += sum2;
-          std::map<int, int> individual_genotype_map;
-
-          for (auto &parasite_population : *person->get_all_clonal_parasite_populations()) {
-            const auto g_id = parasite_population->genotype()->genotype_id();
-            result2[g_id] += 1;
-            result2_all[g_id] += 1;
-            if (!individual_genotype_map.contains(g_id)) {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] = 1;
-            } else {
-              individual_genotype_map[parasite_population->genotype()->genotype_id()] += 1;
-            }
-          }
-
-          for (const auto genotype : individual_genotype_map) {
-            result1[genotype.first] += 1;
-            result1_all[genotype.first] += 1;
-            result3[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-            result3_all[genotype.first] +=
-                genotype.second
-                / static_cast<double>(person->get_all_clonal_parasite_populations()->size());
-          }
-        }
-      }
+    const auto sum1 = static_cast<double>(census.infected(loc));
+    const auto sum2 = static_cast<double>(census.number_of_clones(loc));
+    sum1_all += sum1;
+    sum2_all += sum2;
+
+    for (auto entry = census.genotype_begin(loc); entry < census.genotype_end(loc); entry++) {
+      const auto g_id = census.genotype_id(entry);
+      result1[g_id] += census.carriers(entry);
+      result1_all[g_id] += census.carriers(entry);
+      result2[g_id] += census.clones(entry);
+      result2_all[g_id] += census.clones(entry);
+      result3[g_id] += census.weighted_carriers(entry);
+      result3_all[g_id] += census.weighted_carriers(entry);
     }
 
     for (auto &genotype_count : result1) { genotype_count /= sum1; }
@@ -379,21 +217,11 @@ void ReporterUtils::output_3_genotype_frequency(std::stringstream &ss,
   }
 }
 
-void ReporterUtils::output_moi(std::stringstream &ss, PersonIndexByLocationStateAgeClass* pi) {
-  const auto number_of_locations = pi->vPerson().size();
-  const auto number_of_age_classes = pi->vPerson()[0][0].size();
-
-  for (auto loc = 0UL; loc < number_of_locations; loc++) {
-    auto pop_sum_location = 0;
-    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
-      for (auto ac = 0UL; ac < number_of_age_classes; ac++) {
-        std::size_t size = pi->vPerson()[loc][hs][ac].size();
-        for (int i = 0; i < size; i++) {
-          Person* person = pi->vPerson()[loc][hs][ac][i];
-          int moi = static_cast<int>(person->get_all_clonal_parasite_populations()->size());
-          ss << moi << "\n";
-        }
-      }
+void ReporterUtils::output_moi(std::stringstream &ss, const PopulationCensus &census) {
+  // one line per person, grouped by multiplicity of infection
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
+    for (auto moi = 0; moi < census.number_of_moi(loc); moi++) {
+      for (auto i = 0; i < census.multiple_of_infection(loc, moi); i++) { ss << moi << "\n"; }
     }
   }
   spdlog::get("moi_reporter")->info(ss.str());
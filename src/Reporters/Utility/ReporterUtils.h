@@ -4,7 +4,7 @@
 
 #include <sstream>
 
-class PersonIndexByLocationStateAgeClass;
+class PopulationCensus;
 
 class ReporterUtils {
 
@@ -13,20 +13,20 @@ public:
   /// individuals
   /// \param ss the output string stream
   /// \param number_of_genotypes total number of genotypes defined in configuration
-  /// \param pi person index by location state and ageclass that obtained from the population object
+  /// \param census population census filled by the model data collector
   static void output_genotype_frequency1(
       std::stringstream& ss, const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      const PopulationCensus& census
   );
 
   /// outputs genotype frequencies by number of clonal parasite populations carrying genotype X / total number of clonal parasite
   ///  populations
   /// \param ss the output string stream
   /// \param number_of_genotypes total number of genotypes defined in configuration
-  /// \param pi person index by location state and ageclass that obtained from the population object
+  /// \param census population census filled by the model data collector
   static void output_genotype_frequency2(
       std::stringstream& ss, const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      const PopulationCensus& census
   );
 
   /// outputs genotype frequencies by the weighted number of parasite-positive individuals carrying genotype X / total number of
@@ -35,10 +35,10 @@ public:
   /// carry genotype X would be given a weight of 2/5).
   /// \param ss the output string stream
   /// \param number_of_genotypes total number of genotypes defined in configuration
-  /// \param pi person index by location state and ageclass that obtained from the population object
+  /// \param census population census filled by the model data collector
   static void output_genotype_frequency3(
       std::stringstream& ss, const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      const PopulationCensus& census
   );
 
   /// outputs genotype frequencies by the weighted number of parasite-positive individuals carrying genotype X / total number of
@@ -48,10 +48,10 @@ public:
     /// \param ss the output string stream
     /// \param ss2 the output string stream - prmc
     /// \param number_of_genotypes total number of genotypes defined in configuration
-    /// \param pi person index by location state and ageclass that obtained from the population object
+    /// \param census population census filled by the model data collector
     static void output_genotype_frequency4(
             std::stringstream& ss, std::stringstream& ss2, const int& number_of_genotypes,
-            PersonIndexByLocationStateAgeClass* pi
+            const PopulationCensus& census
     );
 
   /// \brief outputs genotype frequencies by all 3 methods:
@@ -66,15 +66,15 @@ public:
   ///     carry genotype X would be given a weight of 2/5).
   /// \param ss the output string stream
   /// \param number_of_genotypes total number of genotypes defined in configuration
-  /// \param pi person index by location state and ageclass that obtained from the population object
+  /// \param census population census filled by the model data collector
   static void output_3_genotype_frequency(
       std::stringstream& ss, const int& number_of_genotypes,
-      PersonIndexByLocationStateAgeClass* pi
+      const PopulationCensus& census
   );
 
   static void initialize_moi_file_logger();
 
-  static void output_moi(std::stringstream& ss, PersonIndexByLocationStateAgeClass* pi);
+  static void output_moi(std::stringstream& ss, const PopulationCensus& census);
 
 
 };
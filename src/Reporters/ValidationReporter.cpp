@@ -16,7 +16,6 @@
 #include "Utility/ReporterUtils.h"
 #include "Utils/Cli.h"
 #include "Utils/Constants.h"
-#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
 #include "Utils/Random.h"
 
 namespace fs = std::filesystem;
@@ -367,7 +366,7 @@ void ValidationReporter::monthly_report() {
   //                                              Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
   ReporterUtils::output_genotype_frequency3(
       gene_freq_ss, static_cast<int>(Model::get_genotype_db()->size()),
-      Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>());
+      Model::get_mdc()->census());
 
   gene_freq_logger->info(gene_freq_ss.str());
   // prmc_freq_logger->info(prmc_freq_ss.str());
@@ -0,0 +1,96 @@
+#include "Checkpoint.h"
+
+#include <array>
+#include <stdexcept>
+
+#include "Configuration/Config.h"
+#include "Model.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Treatment/Strategies/IStrategy.h"
+#include "Treatment/Therapies/Therapy.h"
+#include "Utils/CheckpointArchive.h"
+
+void Checkpoint::save(const std::string &path) {
+  utils::CheckpointWriter writer(path);
+  header(writer);
+  Model::get_instance()->checkpoint(writer);
+  writer.close();
+}
+
+void Checkpoint::restore(const std::string &path) {
+  utils::CheckpointReader reader(path);
+  header(reader);
+  Model::get_instance()->checkpoint(reader);
+  if (!reader.is_at_end()) {
+    throw std::runtime_error("Checkpoint file has unexpected trailing data: " + path);
+  }
+}
+
+void Checkpoint::header(utils::CheckpointArchive &archive) {
+  constexpr std::array<char, 8> MAGIC{'M', 'S', 'C', 'H', 'K', 'P', 'N', 'T'};
+  auto magic = MAGIC;
+  auto version = VERSION;
+  archive & magic & version;
+  if (magic != MAGIC) { throw std::runtime_error("Not a checkpoint file"); }
+  if (version != VERSION) {
+    throw std::runtime_error("Unsupported checkpoint version " + std::to_string(version));
+  }
+
+  // sizes of the configuration, the strategies are left out since a strategy may add new ones
+  const std::array<std::int64_t, 5> expected_sizes{
+      Model::get_config()->number_of_locations(), Model::get_config()->number_of_age_classes(),
+      Model::get_config()->number_of_tracking_days(),
+      static_cast<std::int64_t>(Model::get_therapy_db().size()),
+      static_cast<std::int64_t>(Model::get_drug_db()->size())};
+  auto sizes = expected_sizes;
+  archive & sizes;
+  if (sizes != expected_sizes) {
+    throw std::runtime_error("Checkpoint was saved with another configuration");
+  }
+}
+
+void Checkpoint::genotype(utils::CheckpointArchive &archive, Genotype* &genotype) {
+  std::int32_t id = genotype == nullptr ? -1 : genotype->genotype_id();
+  archive & id;
+  if (archive.is_loading()) { genotype = id < 0 ? nullptr : Model::get_genotype_db()->at(id); }
+}
+
+void Checkpoint::therapy(utils::CheckpointArchive &archive, Therapy* &therapy) {
+  auto &therapy_db = Model::get_therapy_db();
+  std::int32_t index = -1;
+  if (!archive.is_loading() && therapy != nullptr) {
+    for (std::size_t i = 0; i < therapy_db.size(); i++) {
+      if (therapy_db[i].get() == therapy) { index = static_cast<std::int32_t>(i); }
+    }
+    if (index == -1) { throw std::runtime_error("Therapy is not in the therapy database"); }
+  }
+  archive & index;
+  if (archive.is_loading()) { therapy = index < 0 ? nullptr : therapy_db.at(index).get(); }
+}
+
+void Checkpoint::strategy(utils::CheckpointArchive &archive, IStrategy* &strategy) {
+  auto &strategy_db = Model::get_strategy_db();
+  std::int32_t index = -1;
+  if (!archive.is_loading() && strategy != nullptr) {
+    for (std::size_t i = 0; i < strategy_db.size(); i++) {
+      if (strategy_db[i].get() == strategy) { index = static_cast<std::int32_t>(i); }
+    }
+    if (index == -1) { throw std::runtime_error("Strategy is not in the strategy database"); }
+  }
+  archive & index;
+  if (archive.is_loading()) { strategy = index < 0 ? nullptr : strategy_db.at(index).get(); }
+}
+
+void Checkpoint::update_function(utils::CheckpointArchive &archive,
+                                 ParasiteDensityUpdateFunction* &function) {
+  const std::array<ParasiteDensityUpdateFunction*, 4> functions{
+      Model::progress_to_clinical_update_function(), Model::immunity_clearance_update_function(),
+      Model::having_drug_update_function(), Model::clinical_update_function()};
+  std::int8_t index = -1;
+  for (std::size_t i = 0; i < functions.size(); i++) {
+    if (function != nullptr && functions[i] == function) { index = static_cast<std::int8_t>(i); }
+  }
+  archive & index;
+  if (archive.is_loading()) { function = index < 0 ? nullptr : functions.at(index); }
+}
@@ -0,0 +1,53 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+
+namespace utils {
+class CheckpointArchive;
+}
+
+class Genotype;
+class IStrategy;
+class ParasiteDensityUpdateFunction;
+class Therapy;
+
+/**
+ * @class Checkpoint
+ * @brief Saves the simulation state at the start of a day and resumes from it.
+ *
+ * The configuration is not part of the checkpoint: a checkpoint is restored on a model
+ * initialized from the same input file by the same build, then the state of the scheduler with
+ * its pending population events, the random generator, the treatment strategies, the mosquitoes,
+ * the population and the data collector is overwritten with the saved one, as are the
+ * configuration values the population events change (see Config::checkpoint). The header holds a
+ * few sizes of the configuration to reject an obviously different input file.
+ *
+ * Shared objects referenced by the state (genotypes, therapies, strategies, update functions) are
+ * saved as ids through the helpers below, parasites of a person are referred to by their handle.
+ */
+class Checkpoint {
+public:
+  static constexpr std::uint32_t VERSION = 3;
+
+  // Throws std::runtime_error when the file can not be written
+  static void save(const std::string &path);
+
+  // Throws std::runtime_error when the file is missing, truncated or does not match the model
+  static void restore(const std::string &path);
+
+  static void genotype(utils::CheckpointArchive &archive, Genotype* &genotype);
+
+  static void therapy(utils::CheckpointArchive &archive, Therapy* &therapy);
+
+  static void strategy(utils::CheckpointArchive &archive, IStrategy* &strategy);
+
+  static void update_function(utils::CheckpointArchive &archive,
+                              ParasiteDensityUpdateFunction* &function);
+
+private:
+  static void header(utils::CheckpointArchive &archive);
+};
+
+#endif  // CHECKPOINT_H
@@ -4,6 +4,7 @@
 #include <Population/Population.h>
 #include <Utils/Random.h>
 
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 
@@ -11,9 +12,13 @@
 #include "MDC/ModelDataCollector.h"
 #include "Mosquito/Mosquito.h"
 #include "Reporters/Reporter.h"
+#include "Simulation/Checkpoint.h"
 #include "Treatment/LinearTCM.h"
 #include "Treatment/SteadyTCM.h"
+#include "Utils/CheckpointArchive.h"
 #include "Utils/Cli.h"
+#include "Utils/Helpers/TimeHelpers.h"
+#include "Utils/YamlFile.h"
 
 bool Model::initialize() {
   config_ = std::make_unique<Config>();
@@ -42,6 +47,10 @@ bool Model::initialize() {
   // if input path is not empty, load configuration file
   spdlog::info("Loading configuration file: " + utils::Cli::get_instance().get_input_path());
   if (config_->load(utils::Cli::get_instance().get_input_path())) {
+    const auto generator = config_->get_model_settings().get_random_generator();
+    if (generator != random_->get_generator()) {
+      random_ = std::make_unique<utils::Random>(generator);
+    }
     if (config_->get_model_settings().get_initial_seed_number() <= 0) {
       random_->set_seed(std::chrono::system_clock::now().time_since_epoch().count());
     } else {
@@ -87,8 +96,14 @@ bool Model::initialize() {
     mdc_->initialize();
     spdlog::info("Model initialized data collector.");
 
+    // a restored population replaces the generated one, start from an empty population
+    const auto restore_path = utils::Cli::get_instance().get_restore_path();
     spdlog::info("Model initializing population...");
-    population_->initialize();
+    if (restore_path.empty()) {
+      population_->initialize();
+    } else {
+      population_->initialize_empty();
+    }
     spdlog::info("Model initialized population.");
 
     config_->get_movement_settings().get_spatial_model()->prepare();
@@ -97,8 +112,10 @@ bool Model::initialize() {
     mosquito_->initialize(config_.get());
     spdlog::info("Model initialized mosquito.");
 
-    population_->introduce_initial_cases();
-    spdlog::info("Model initialized initial cases.");
+    if (restore_path.empty()) {
+      population_->introduce_initial_cases();
+      spdlog::info("Model initialized initial cases.");
+    }
 
     // Take ownership of the events from the config
     auto population_events = config_->get_population_events().release_events();
@@ -111,6 +128,27 @@ bool Model::initialize() {
       }
     }
 
+    if (!restore_path.empty()) {
+      spdlog::info("Restoring checkpoint: {}", restore_path);
+      Checkpoint::restore(restore_path);
+      spdlog::info("Model restored at {}", scheduler_->get_current_date_seperated_string());
+    }
+
+    if (!utils::Cli::get_instance().get_checkpoint_path().empty()) {
+      const auto checkpoint_date =
+          YAML::Node(utils::Cli::get_instance().get_checkpoint_date()).as<date::year_month_day>();
+      const auto checkpoint_time = TimeHelpers::days_between(
+          config_->get_simulation_timeframe().get_starting_date(), checkpoint_date);
+      if (checkpoint_time <= scheduler_->current_time()
+          || checkpoint_time > config_->get_simulation_timeframe().get_total_time()) {
+        spdlog::error("Checkpoint date {} is not within the days left to simulate",
+                      utils::Cli::get_instance().get_checkpoint_date());
+        return false;
+      }
+      scheduler_->schedule_checkpoint(checkpoint_time,
+                                      utils::Cli::get_instance().get_checkpoint_path());
+    }
+
     if (utils::Cli::get_instance().get_record_movement()) {
       // Generate a movement reporter
       auto reporter = Reporter::MakeReport(Reporter::ReportType::MOVEMENT_REPORTER);
@@ -284,3 +322,53 @@ std::vector<std::unique_ptr<Reporter>>& Model::get_reporters() {
   return reporters_;
 }
 
+
+void Model::checkpoint(utils::CheckpointArchive &archive) {
+  scheduler_->checkpoint(archive);
+  random_->checkpoint(archive);
+  // the pre-shuffled chunk the moving levels of newborns are drawn from
+  archive & config_->get_movement_settings().get_moving_level_generator().data;
+  config_->checkpoint(archive);
+  genotype_db_->checkpoint(archive);
+
+  // strategies may append new strategies to the database while running
+  auto number_of_strategies = archive.size(strategy_db_.size());
+  if (number_of_strategies < strategy_db_.size()) {
+    throw std::runtime_error("Checkpoint was saved with another configuration");
+  }
+  for (std::size_t i = 0; i < strategy_db_.size(); i++) { strategy_db_[i]->checkpoint(archive); }
+  if (strategy_db_.size() != number_of_strategies) {
+    throw std::runtime_error("Checkpoint was saved with another configuration");
+  }
+  std::int64_t strategy_index = -1;
+  for (std::size_t i = 0; i < strategy_db_.size(); i++) {
+    if (strategy_db_[i].get() == treatment_strategy_) {
+      strategy_index = static_cast<std::int64_t>(i);
+    }
+  }
+  archive & strategy_index;
+  if (archive.is_loading()) {
+    treatment_strategy_ = strategy_index == -1 ? nullptr : strategy_db_.at(strategy_index).get();
+  }
+
+  // assigned as is, set_treatment_coverage would derive the rates of change again
+  auto coverage_type = treatment_coverage_->type;
+  archive & coverage_type;
+  if (archive.is_loading()) {
+    auto treatment_coverage = ITreatmentCoverageModel::create(coverage_type);
+    treatment_coverage->checkpoint(archive);
+    treatment_coverage_ = std::move(treatment_coverage);
+  } else {
+    treatment_coverage_->checkpoint(archive);
+  }
+
+  mosquito_->checkpoint(archive);
+  population_->checkpoint(archive);
+  mdc_->checkpoint(archive);
+
+  if (archive.is_loading()) {
+    // built from the configuration values replaced above
+    genotype_db_->clear_transition_tables();
+    population_->invalidate_destination_distributions();
+  }
+}
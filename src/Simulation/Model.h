@@ -22,6 +22,10 @@ namespace Spatial {
 class Location;
 }
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class Cli;
 class Model {
 public:
@@ -69,6 +73,8 @@ private:
 
   IStrategy* treatment_strategy_{nullptr};
 
+  inline static thread_local utils::Random* thread_random_{nullptr};
+
 public:
   void before_run();
   void run();
@@ -80,6 +86,9 @@ public:
   void yearly_update();
   void release();
 
+  // Save or restore the state of the simulation, see Checkpoint
+  void checkpoint(utils::CheckpointArchive &archive);
+
   static Config* get_config() { return get_instance()->config_.get(); }
   static void set_config(std::unique_ptr<Config> config) {
     get_instance()->config_ = std::move(config);
@@ -91,7 +100,15 @@ public:
     get_instance()->scheduler_ = std::move(scheduler);
   }
 
-  static utils::Random* get_random() { return get_instance()->random_.get(); }
+  // Returns the random stream bound to the calling thread if any (see set_thread_random),
+  // otherwise the model-wide generator
+  static utils::Random* get_random() {
+    if (thread_random_ != nullptr) { return thread_random_; }
+    return get_instance()->random_.get();
+  }
+
+  // Bind a non-owning random stream to the calling thread, nullptr restores the model-wide one
+  static void set_thread_random(utils::Random* random) { thread_random_ = random; }
 
   static void set_random(std::unique_ptr<utils::Random> random) {
     get_instance()->random_ = std::move(random);
@@ -5,13 +5,45 @@
  */
 #include "AscFile.h"
 
+#include <fcntl.h>
 #include <spdlog/spdlog.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 
+namespace {
+// Layout of a binary raster: this header, then the cells as row-major floats
+constexpr std::array<char, 8> BINARY_SIGNATURE{'M', 'S', 'R', 'A', 'S', 'T', 'E', 'R'};
+constexpr std::uint32_t BINARY_VERSION = 1;
+
+struct BinaryRasterHeader {
+  std::array<char, 8> signature;
+  std::uint32_t version;
+  std::uint32_t header_size;
+  std::int32_t nrows;
+  std::int32_t ncols;
+  double xllcenter;
+  double yllcenter;
+  double xllcorner;
+  double yllcorner;
+  double cellsize;
+  double nodata_value;
+  AscSourceKey source;
+};
+static_assert(sizeof(BinaryRasterHeader) % alignof(float) == 0);
+
+// Number of leading bytes of an ASC file covered by the hash of its source key
+constexpr std::size_t SOURCE_HASH_BYTES = 64 * 1024;
+}  // namespace
+
 // Check that the contents fo the ASC file are correct. Returns TRUE if any
 // errors are found, which are enumerated in the string provided.
 std::string AscFileManager::check_asc_file(const AscFile* file) {
@@ -39,6 +71,36 @@ std::string AscFileManager::check_asc_file(const AscFile* file) {
 // Read the indicated file from disk, caller is responsible for checking if
 // data is integer or floating point.
 std::unique_ptr<AscFile> AscFileManager::read(const std::string &file_name) {
+  if (is_binary(file_name)) {
+    auto results = map_binary(file_name, nullptr);
+    if (results == nullptr) { throw std::runtime_error("Invalid binary raster: " + file_name); }
+    return results;
+  }
+
+  std::error_code error;
+  if (!binary_cache_enabled_ || !std::filesystem::is_regular_file(file_name, error)) {
+    return read_text(file_name);
+  }
+
+  // Map the cache if it was converted from this version of the file
+  const auto source = source_key(file_name);
+  const auto cache_path = binary_cache_path(file_name);
+  if (auto results = map_binary(cache_path, &source)) {
+    spdlog::debug("Mapped raster cache {}", cache_path);
+    return results;
+  }
+
+  auto results = read_text(file_name);
+  try {
+    write_binary(results.get(), cache_path, source);
+    spdlog::debug("Wrote raster cache {}", cache_path);
+  } catch (const std::exception &ex) {
+    spdlog::warn("Unable to write raster cache {}: {}", cache_path, ex.what());
+  }
+  return results;
+}
+
+std::unique_ptr<AscFile> AscFileManager::read_text(const std::string &file_name) {
   // Treat the struct as POD
   auto results = std::make_unique<AscFile>();
 
@@ -83,9 +145,7 @@ std::unique_ptr<AscFile> AscFileManager::read(const std::string &file_name) {
   if (!errors.empty()) { throw std::runtime_error(errors); }
 
   // Allocate the memory and read the remainder of the actual raster data
-  // Allocate the memory using vectors
-  results->data.resize(results->nrows);
-  for (auto &row : results->data) { row.resize(results->ncols); }
+  results->data = RasterData(results->nrows, results->ncols);
 
   // Remainder of the file is the actual raster data
   for (auto ndx = 0; ndx < results->nrows; ndx++) {
@@ -126,3 +186,110 @@ void AscFileManager::write(AscFile* file, const std::string &file_name) {
   // Clean-up
   out.close();
 }
+
+bool AscFileManager::is_binary(const std::string &file_name) {
+  std::ifstream in(file_name, std::ios::binary);
+  std::array<char, 8> signature{};
+  in.read(signature.data(), signature.size());
+  return in.good() && signature == BINARY_SIGNATURE;
+}
+
+AscSourceKey AscFileManager::source_key(const std::string &file_name) {
+  AscSourceKey key;
+  key.size = std::filesystem::file_size(file_name);
+  key.modified = std::filesystem::last_write_time(file_name).time_since_epoch().count();
+
+  // FNV-1a over the first block, catches rewrites within the timestamp resolution
+  std::ifstream in(file_name, std::ios::binary);
+  std::vector<char> block(std::min<std::uint64_t>(key.size, SOURCE_HASH_BYTES));
+  in.read(block.data(), static_cast<std::streamsize>(block.size()));
+  key.hash = 14695981039346656037ULL;
+  for (const auto byte : block) {
+    key.hash = (key.hash ^ static_cast<unsigned char>(byte)) * 1099511628211ULL;
+  }
+  return key;
+}
+
+std::unique_ptr<AscFile> AscFileManager::map_binary(const std::string &file_name,
+                                                    const AscSourceKey* expected_source) {
+  const auto fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) { return nullptr; }
+  struct stat status{};
+  if (::fstat(fd, &status) != 0
+      || static_cast<std::size_t>(status.st_size) < sizeof(BinaryRasterHeader)) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  // Private mapping, pages are shared with the page cache until written to
+  const auto length = static_cast<std::size_t>(status.st_size);
+  auto* address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) { return nullptr; }
+  std::shared_ptr<void> mapping(address, [length](void* mapped) { ::munmap(mapped, length); });
+
+  BinaryRasterHeader header{};
+  std::memcpy(&header, address, sizeof(header));
+  if (header.signature != BINARY_SIGNATURE || header.version != BINARY_VERSION
+      || header.header_size != sizeof(BinaryRasterHeader) || header.nrows < 0
+      || header.ncols < 0
+      || length != header.header_size
+                       + (static_cast<std::size_t>(header.nrows) * header.ncols * sizeof(float))) {
+    return nullptr;
+  }
+  if (expected_source != nullptr && header.source != *expected_source) { return nullptr; }
+
+  auto results = std::make_unique<AscFile>();
+  results->nrows = header.nrows;
+  results->ncols = header.ncols;
+  results->xllcenter = header.xllcenter;
+  results->yllcenter = header.yllcenter;
+  results->xllcorner = header.xllcorner;
+  results->yllcorner = header.yllcorner;
+  results->cellsize = header.cellsize;
+  results->nodata_value = header.nodata_value;
+  auto* values = reinterpret_cast<float*>(static_cast<char*>(address) + header.header_size);
+  results->data = RasterData(header.nrows, header.ncols, std::move(mapping), values);
+  return results;
+}
+
+void AscFileManager::write_binary(const AscFile* file, const std::string &file_name,
+                                  const AscSourceKey &source) {
+  if (file->data.rows() != file->nrows || file->data.cols() != file->ncols) {
+    throw std::runtime_error("Raster data does not match its header: " + file_name);
+  }
+
+  BinaryRasterHeader header{};
+  header.signature = BINARY_SIGNATURE;
+  header.version = BINARY_VERSION;
+  header.header_size = sizeof(BinaryRasterHeader);
+  header.nrows = file->nrows;
+  header.ncols = file->ncols;
+  header.xllcenter = file->xllcenter;
+  header.yllcenter = file->yllcenter;
+  header.xllcorner = file->xllcorner;
+  header.yllcorner = file->yllcorner;
+  header.cellsize = file->cellsize;
+  header.nodata_value = file->nodata_value;
+  header.source = source;
+
+  // Write to a temporary file and rename it, replicates starting together may
+  // be writing the same cache
+  const auto temporary = file_name + ".tmp" + std::to_string(::getpid());
+  std::ofstream out(temporary, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(file->data.data()),
+            static_cast<std::streamsize>(file->data.size() * sizeof(float)));
+  out.close();
+
+  std::error_code error;
+  if (!out) {
+    std::filesystem::remove(temporary, error);
+    throw std::runtime_error("Error writing binary raster: " + file_name);
+  }
+  std::filesystem::rename(temporary, file_name, error);
+  if (error) {
+    std::filesystem::remove(temporary, error);
+    throw std::runtime_error("Error writing binary raster: " + file_name);
+  }
+}
@@ -9,9 +9,12 @@
 #ifndef ASCFILE_H
 #define ASCFILE_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
-#include <vector>
+
+#include "RasterData.h"
+
 // The ASC file either as read, or to be written. Note that since the
 // specification does not provide a header indicating if the data is floating
 // point or integer, the data is presumed to be floating point.
@@ -47,23 +50,67 @@ struct AscFile {
   // initialization
   double nodata_value = 0;
 
-  // The data stored in the file
-  std::vector<std::vector<float>> data;
+  // The data stored in the file, row-major
+  RasterData data;
+};
+
+// Version of an ASC file that a binary cache was converted from, all zero for
+// a standalone binary raster
+struct AscSourceKey {
+  std::uint64_t size = 0;
+  std::int64_t modified = 0;
+  std::uint64_t hash = 0;
+
+  bool operator==(const AscSourceKey &) const = default;
 };
 
 class AscFileManager {
 private:
   static const int HEADER_WIDTH = 14;
 
+  inline static bool binary_cache_enabled_ = true;
+
   // Static class, no need to instantiate.
   AscFileManager() = default;
 
+  static std::unique_ptr<AscFile> read_text(const std::string &file_name);
+  // Maps a binary raster, returns nullptr if it is not a binary raster or its
+  // source key differs from the one expected
+  static std::unique_ptr<AscFile> map_binary(const std::string &file_name,
+                                             const AscSourceKey* expected_source);
+
 public:
+  // Extension appended to the name of an ASC file for its binary cache
+  inline static const std::string BINARY_CACHE_EXTENSION = ".bin";
+
   // Returns an empty string if the file is valid, otherwise returns a string
   // describing the errors.
   static std::string check_asc_file(const AscFile* file);
+
+  // Reads an ASC file, or a binary raster written by write_binary. When the
+  // binary cache is enabled, the binary sidecar of an ASC file is mapped if it
+  // is up to date, and generated otherwise.
   static std::unique_ptr<AscFile> read(const std::string &file_name);
   static void write(AscFile* file, const std::string &file_name);
+
+  // Writes the raster in the binary format, through a temporary file so that
+  // concurrent readers never see a partial file.
+  static void write_binary(const AscFile* file, const std::string &file_name,
+                           const AscSourceKey &source = {});
+
+  // Returns true if the file starts with the binary raster signature
+  static bool is_binary(const std::string &file_name);
+
+  // Key of the current version of a file: its size, modification time, and a
+  // hash of its first block
+  static AscSourceKey source_key(const std::string &file_name);
+
+  static std::string binary_cache_path(const std::string &file_name) {
+    return file_name + BINARY_CACHE_EXTENSION;
+  }
+
+  static void set_binary_cache_enabled(bool enabled) { binary_cache_enabled_ = enabled; }
+  static bool is_binary_cache_enabled() { return binary_cache_enabled_; }
 };
 
 #endif
@@ -0,0 +1,83 @@
+/*
+ * RasterData.h
+ *
+ * Cell values of a raster in a single row-major buffer, either owned or backed
+ * by a memory-mapped binary raster file.
+ */
+#ifndef RASTERDATA_H
+#define RASTERDATA_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+class RasterData {
+public:
+  RasterData() = default;
+
+  RasterData(int nrows, int ncols)
+      : nrows_(nrows), ncols_(ncols), owned_(static_cast<std::size_t>(nrows) * ncols, 0.0f),
+        values_(owned_.data()) {}
+
+  // Adopts values inside a mapping, the mapping is released with the last copy of the pointer
+  RasterData(int nrows, int ncols, std::shared_ptr<void> mapping, float* values)
+      : nrows_(nrows), ncols_(ncols), mapping_(std::move(mapping)), values_(values) {}
+
+  // Copies always own their values so that they can be modified independently
+  RasterData(const RasterData &other)
+      : nrows_(other.nrows_), ncols_(other.ncols_),
+        owned_(other.values_, other.values_ + other.size()), values_(owned_.data()) {}
+
+  RasterData &operator=(const RasterData &other) {
+    if (this != &other) { *this = RasterData(other); }
+    return *this;
+  }
+
+  RasterData(RasterData &&other) noexcept { swap(other); }
+
+  RasterData &operator=(RasterData &&other) noexcept {
+    RasterData moved(std::move(other));
+    swap(moved);
+    return *this;
+  }
+
+  ~RasterData() = default;
+
+  // Row access, so that cells are read as data[row][col]
+  [[nodiscard]] float* operator[](int row) {
+    return values_ + static_cast<std::size_t>(row) * ncols_;
+  }
+  [[nodiscard]] const float* operator[](int row) const {
+    return values_ + static_cast<std::size_t>(row) * ncols_;
+  }
+
+  [[nodiscard]] int rows() const { return nrows_; }
+  [[nodiscard]] int cols() const { return ncols_; }
+  [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(nrows_) * ncols_; }
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] bool is_mapped() const { return mapping_ != nullptr; }
+
+  [[nodiscard]] float* data() { return values_; }
+  [[nodiscard]] const float* data() const { return values_; }
+  [[nodiscard]] std::span<const float> values() const { return {values_, size()}; }
+
+private:
+  void swap(RasterData &other) noexcept {
+    std::swap(nrows_, other.nrows_);
+    std::swap(ncols_, other.ncols_);
+    // moving a vector keeps its buffer, so values_ stays valid
+    std::swap(owned_, other.owned_);
+    std::swap(mapping_, other.mapping_);
+    std::swap(values_, other.values_);
+  }
+
+  int nrows_{0};
+  int ncols_{0};
+  std::vector<float> owned_;
+  std::shared_ptr<void> mapping_;
+  float* values_{nullptr};
+};
+
+#endif  // RASTERDATA_H
@@ -0,0 +1,87 @@
+#include "SparseDistanceMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Spatial {
+
+SparseDistanceMatrix SparseDistanceMatrix::from_grid(const std::vector<Location> &locations,
+                                                     double cell_size, double cutoff) {
+  if (cutoff <= 0 || cell_size <= 0) {
+    throw std::invalid_argument("Sparse distances need a positive cutoff and cell size");
+  }
+
+  SparseDistanceMatrix matrix;
+  matrix.row_offsets_.reserve(locations.size() + 1);
+  matrix.row_offsets_.push_back(0);
+  if (locations.empty()) { return matrix; }
+
+  // index the locations by cell so the neighbors of a cell are found by scanning a window
+  auto cell_row = [&](std::size_t index) {
+    return static_cast<int>(std::lround(locations[index].coordinate.latitude));
+  };
+  auto cell_column = [&](std::size_t index) {
+    return static_cast<int>(std::lround(locations[index].coordinate.longitude));
+  };
+  int min_row = cell_row(0), max_row = cell_row(0);
+  int min_column = cell_column(0), max_column = cell_column(0);
+  for (std::size_t index = 1; index < locations.size(); index++) {
+    min_row = std::min(min_row, cell_row(index));
+    max_row = std::max(max_row, cell_row(index));
+    min_column = std::min(min_column, cell_column(index));
+    max_column = std::max(max_column, cell_column(index));
+  }
+  const auto number_of_rows = static_cast<std::size_t>(max_row - min_row + 1);
+  const auto number_of_columns = static_cast<std::size_t>(max_column - min_column + 1);
+  std::vector<int> location_by_cell(number_of_rows * number_of_columns, -1);
+  for (std::size_t index = 0; index < locations.size(); index++) {
+    location_by_cell[(cell_row(index) - min_row) * number_of_columns
+                     + (cell_column(index) - min_column)] = static_cast<int>(index);
+  }
+
+  const auto radius = static_cast<int>(std::floor(cutoff / cell_size));
+  std::vector<std::pair<int, double>> row;
+  for (std::size_t from = 0; from < locations.size(); from++) {
+    row.clear();
+    const auto from_row = cell_row(from);
+    const auto from_column = cell_column(from);
+    for (auto to_row = std::max(from_row - radius, min_row);
+         to_row <= std::min(from_row + radius, max_row); to_row++) {
+      for (auto to_column = std::max(from_column - radius, min_column);
+           to_column <= std::min(from_column + radius, max_column); to_column++) {
+        const auto to = location_by_cell[(to_row - min_row) * number_of_columns
+                                         + (to_column - min_column)];
+        if (to < 0 || to == static_cast<int>(from)) { continue; }
+        const auto distance = std::sqrt(
+            std::pow(cell_size * (locations[from].coordinate.latitude
+                                  - locations[to].coordinate.latitude),
+                     2)
+            + std::pow(cell_size * (locations[from].coordinate.longitude
+                                    - locations[to].coordinate.longitude),
+                       2));
+        if (distance <= cutoff) { row.emplace_back(to, distance); }
+      }
+    }
+    std::ranges::sort(row);
+    for (const auto &[to, distance] : row) {
+      matrix.neighbors_.push_back(to);
+      matrix.distances_.push_back(distance);
+    }
+    matrix.row_offsets_.push_back(matrix.neighbors_.size());
+  }
+  matrix.neighbors_.shrink_to_fit();
+  matrix.distances_.shrink_to_fit();
+  return matrix;
+}
+
+void SparseDistanceMatrix::fill_row(int from_location, DoubleVector &row) const {
+  row.assign(number_of_locations(), 0.0);
+  const auto row_neighbors = neighbors(from_location);
+  const auto row_distances = distances(from_location);
+  for (std::size_t entry = 0; entry < row_neighbors.size(); entry++) {
+    row[row_neighbors[entry]] = row_distances[entry];
+  }
+}
+
+}  // namespace Spatial
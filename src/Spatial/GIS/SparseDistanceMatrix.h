@@ -0,0 +1,74 @@
+/*
+ * SparseDistanceMatrix.h
+ *
+ * Distances between grid locations that are within a cutoff radius of each
+ * other, stored in compressed sparse row (CSR) form.
+ */
+#ifndef SPARSEDISTANCEMATRIX_H
+#define SPARSEDISTANCEMATRIX_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Spatial/Location/Location.h"
+#include "Utils/TypeDef.h"
+
+namespace Spatial {
+
+/**
+ * @class SparseDistanceMatrix
+ * @brief Neighbor lists used in place of the dense N x N distance matrix.
+ *
+ * Row i lists the locations j != i with distance(i, j) <= cutoff, sorted by
+ * location id, together with their distances. Memory is O(N k) for k
+ * neighbors per location, and the lists are built in O(N k) by scanning the
+ * cells around each location instead of all pairs.
+ */
+class SparseDistanceMatrix {
+public:
+  SparseDistanceMatrix() = default;
+
+  /**
+   * @brief Builds the neighbor lists of grid based locations.
+   * @param locations Locations whose coordinates are (row, column) raster indices
+   * @param cell_size Distance between two adjacent cells
+   * @param cutoff Largest distance kept, in the units of cell_size, must be positive
+   * @throws std::invalid_argument if cutoff or cell_size is not positive
+   */
+  [[nodiscard]] static SparseDistanceMatrix from_grid(const std::vector<Location> &locations,
+                                                      double cell_size, double cutoff);
+
+  [[nodiscard]] bool empty() const { return row_offsets_.empty(); }
+
+  [[nodiscard]] std::size_t number_of_locations() const {
+    return row_offsets_.empty() ? 0 : row_offsets_.size() - 1;
+  }
+
+  [[nodiscard]] std::size_t number_of_entries() const { return neighbors_.size(); }
+
+  [[nodiscard]] std::span<const int> neighbors(int from_location) const {
+    return {neighbors_.data() + row_offsets_[from_location],
+            neighbors_.data() + row_offsets_[from_location + 1]};
+  }
+
+  [[nodiscard]] std::span<const double> distances(int from_location) const {
+    return {distances_.data() + row_offsets_[from_location],
+            distances_.data() + row_offsets_[from_location + 1]};
+  }
+
+  /**
+   * Writes the dense distance row of from_location into row. Locations beyond
+   * the cutoff, and from_location itself, get 0, which the spatial models skip.
+   */
+  void fill_row(int from_location, DoubleVector &row) const;
+
+private:
+  std::vector<std::size_t> row_offsets_;
+  std::vector<int> neighbors_;
+  std::vector<double> distances_;
+};
+
+}  // namespace Spatial
+
+#endif  // SPARSEDISTANCEMATRIX_H
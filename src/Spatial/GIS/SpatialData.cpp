@@ -25,6 +25,13 @@ bool SpatialData::process_config(const YAML::Node &node) {
     throw std::runtime_error("Missing required 'cell_size' configuration");
   }
   cell_size_ = node["cell_size"].as<float>();
+  // distance_cutoff is optional, defaults to 0 (dense distance matrix)
+  if (node["distance_cutoff"]) {
+    distance_cutoff_ = node["distance_cutoff"].as<double>();
+    if (distance_cutoff_ < 0) {
+      throw std::runtime_error("'distance_cutoff' must be greater than or equal to 0");
+    }
+  }
 
   // Load and validate raster files
   load_files(node);
@@ -156,6 +163,17 @@ void SpatialData::generate_distances() const {
   auto &db = spatial_settings_->location_db();
   auto &distances = spatial_settings_->get_spatial_distance_matrix();
 
+  if (distance_cutoff_ > 0) {
+    // neighbor lists only, the N x N matrix does not fit in memory for national grids
+    distances.clear();
+    spatial_settings_->set_sparse_distance_matrix(
+        Spatial::SparseDistanceMatrix::from_grid(db, cell_size_, distance_cutoff_));
+    spdlog::info("Generated sparse distances within {} for {} locations, {} neighbor entries",
+                 distance_cutoff_, db.size(),
+                 spatial_settings_->get_sparse_distance_matrix().number_of_entries());
+    return;
+  }
+
   auto locations = db.size();
   distances.resize(static_cast<uint64_t>(locations));
   for (std::size_t from = 0; from < locations; from++) {
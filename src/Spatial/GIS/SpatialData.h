@@ -188,7 +188,8 @@ public:
   // Return the raster header or the default structure if no raster are loaded
   [[nodiscard]] RasterInformation get_raster_header() const;
 
-  // Generate the Euclidean distances for the location_db
+  // Generate the Euclidean distances for the location_db, as neighbor lists when distance_cutoff
+  // is set
   void generate_distances() const;
 
   [[nodiscard]] AdminLevelManager* get_admin_level_manager() const { return admin_manager_.get(); }
@@ -360,6 +361,9 @@ public:
   [[nodiscard]] float get_cell_size() const { return cell_size_; }
   void set_cell_size(float cell_size) { cell_size_ = cell_size; }
 
+  [[nodiscard]] double get_distance_cutoff() const { return distance_cutoff_; }
+  void set_distance_cutoff(double distance_cutoff) { distance_cutoff_ = distance_cutoff; }
+
   [[nodiscard]] bool get_using_raster() const { return using_raster_; }
   void set_using_raster(bool using_raster) { using_raster_ = using_raster; }
 
@@ -382,6 +386,9 @@ private:
   // was written when we were using 5x5 km cells
   float cell_size_{0};
 
+  // Locations further apart than this do not exchange movement, 0 keeps the dense matrix
+  double distance_cutoff_{0};
+
   // Add raster_info as a data member
   RasterInformation raster_info_;
 
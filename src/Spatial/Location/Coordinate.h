@@ -1,6 +1,7 @@
 #ifndef SPATIAL_COORDINATE_H
 #define SPATIAL_COORDINATE_H
 
+#include <cmath>
 #include <ostream>
 
 namespace Spatial {
@@ -5,7 +5,12 @@
 void Spatial::BurkinaFasoSM::prepare() {
   // Allow the work to be done
   prepare_kernel();
-  spdlog::info("Kernel prepared for BurkinaFasoSM, kernel size x,y: {} - {}", kernel_.size(), kernel_[0].size());
+  if (kernel_.empty()) {
+    spdlog::info("Kernel for BurkinaFasoSM is computed on demand from sparse distances");
+  } else {
+    spdlog::info("Kernel prepared for BurkinaFasoSM, kernel size x,y: {} - {}", kernel_.size(),
+                 kernel_[0].size());
+  }
   travel_.clear();
   if (Model::get_spatial_data() != nullptr) {
     AscFile* travel_raster =
@@ -26,6 +31,9 @@ void Spatial::BurkinaFasoSM::prepare() {
 void Spatial::BurkinaFasoSM::prepare_kernel() {
   // Prepare the kernel object
   spdlog::info("Preparing kernel for BurkinaFasoSM, number of locations: {}", number_of_locations_);
+  kernel_.clear();
+  // Sparse distances, the N x N kernel is not stored
+  if (spatial_distance_matrix_.empty()) { return; }
   kernel_.resize(number_of_locations_);
 
   // Iterate through all the locations and calculate the kernel
@@ -48,7 +56,7 @@ DoubleVector Spatial::BurkinaFasoSM::get_v_relative_out_movement_to_destination(
     const IntVector &v_number_of_residents_by_location) const {
   // Dependent objects should have been created already, so throw an exception
   // if they are not
-  if (kernel_.empty()) {
+  if (kernel_.empty() && !spatial_distance_matrix_.empty()) {
     throw std::runtime_error(
         fmt::format("{} called without kernel prepared", __FUNCTION__));
   }
@@ -65,7 +73,11 @@ DoubleVector Spatial::BurkinaFasoSM::get_v_relative_out_movement_to_destination(
     if (NumberHelpers::is_zero(relative_distance_vector[destination])) { continue; }
 
     // Calculate the proportional probability
-    double probability = std::pow(population, tau_) * kernel_[from_location][destination];
+    const double kernel_value =
+        kernel_.empty()
+            ? std::pow(1 + (relative_distance_vector[destination] / rho_), (-alpha_))
+            : kernel_[from_location][destination];
+    double probability = std::pow(population, tau_) * kernel_value;
 
     // Adjust the probability by the friction surface
     if (travel_.size() == number_of_locations) {
@@ -47,7 +47,8 @@ private:
   uint64_t number_of_locations_;
   std::vector<std::vector<double>> spatial_distance_matrix_;
 
-  // These variables will be computed when the prepare method is called
+  // These variables will be computed when the prepare method is called,
+  // kernel_ stays empty when the distances are sparse
   std::vector<double> travel_;
   std::vector<std::vector<double>> kernel_;
 
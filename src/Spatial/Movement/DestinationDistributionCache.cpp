@@ -0,0 +1,70 @@
+#include "DestinationDistributionCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Spatial/SpatialModel.hxx"
+#include "Utils/Random.h"
+
+namespace Spatial {
+
+DestinationDistributionCache::DestinationDistributionCache(double tolerance)
+    : tolerance_(tolerance) {
+  if (tolerance <= 0) {
+    throw std::invalid_argument("DestinationDistributionCache tolerance must be positive");
+  }
+}
+
+bool DestinationDistributionCache::is_stale(const IntVector &residents_by_location) const {
+  if (!is_valid_ || residents_by_location.size() != cached_residents_.size()) { return true; }
+  for (std::size_t location = 0; location < residents_by_location.size(); location++) {
+    const auto cached = static_cast<double>(cached_residents_[location]);
+    const auto drift = std::abs(static_cast<double>(residents_by_location[location]) - cached);
+    if (drift > tolerance_ * std::max(cached, 1.0)) { return true; }
+  }
+  return false;
+}
+
+bool DestinationDistributionCache::refresh(const SpatialModel &model,
+                                           const IntVector &residents_by_location,
+                                           const DistanceRow &distance_row) {
+  if (!is_stale(residents_by_location)) { return false; }
+
+  const auto number_of_locations = static_cast<int>(residents_by_location.size());
+  destinations_.resize(number_of_locations);
+  tables_.resize(number_of_locations);
+  for (auto from_location = 0; from_location < number_of_locations; from_location++) {
+    const auto relative_out_movement = model.get_v_relative_out_movement_to_destination(
+        from_location, number_of_locations, distance_row(from_location), residents_by_location);
+
+    auto &destinations = destinations_[from_location];
+    destinations.clear();
+    weights_.clear();
+    for (auto destination = 0; destination < number_of_locations; destination++) {
+      if (relative_out_movement[destination] > 0) {
+        destinations.push_back(destination);
+        weights_.push_back(relative_out_movement[destination]);
+      }
+    }
+    destinations.shrink_to_fit();
+    tables_[from_location].assign(weights_);
+  }
+
+  cached_residents_ = residents_by_location;
+  is_valid_ = true;
+  number_of_rebuilds_++;
+  return true;
+}
+
+void DestinationDistributionCache::sample(utils::Random* random, int from_location,
+                                          int number_of_travelers,
+                                          IntVector &destinations) const {
+  const auto &table = tables_[from_location];
+  if (table.empty()) { return; }
+  for (auto traveler = 0; traveler < number_of_travelers; traveler++) {
+    destinations.push_back(destinations_[from_location][table.sample(random)]);
+  }
+}
+
+}  // namespace Spatial
@@ -0,0 +1,80 @@
+/*
+ * DestinationDistributionCache.h
+ *
+ * Outbound destination distributions of the spatial model, kept between days
+ * so that a traveler's destination is a single alias table draw.
+ */
+#ifndef DESTINATIONDISTRIBUTIONCACHE_H
+#define DESTINATIONDISTRIBUTIONCACHE_H
+
+#include <functional>
+#include <vector>
+
+#include "Utils/AliasTable.h"
+#include "Utils/TypeDef.h"
+
+namespace utils {
+class Random;
+}
+
+namespace Spatial {
+class SpatialModel;
+
+/**
+ * @class DestinationDistributionCache
+ * @brief Per-source alias tables over get_v_relative_out_movement_to_destination.
+ *
+ * The tables only hold the destinations with a positive weight, so they take
+ * O(N k) memory when the distances are sparse. They are rebuilt when the
+ * number of residents of any location has moved by more than the relative
+ * tolerance since the last build, or after invalidate().
+ */
+class DestinationDistributionCache {
+public:
+  // Distance row of a source location as passed to the spatial model
+  using DistanceRow = std::function<const DoubleVector &(int from_location)>;
+
+  explicit DestinationDistributionCache(double tolerance);
+
+  [[nodiscard]] double get_tolerance() const { return tolerance_; }
+
+  // Forces a rebuild on the next refresh
+  void invalidate() { is_valid_ = false; }
+
+  [[nodiscard]] bool is_stale(const IntVector &residents_by_location) const;
+
+  /**
+   * @brief Rebuilds every table if the cache is stale.
+   * @return true if the tables were rebuilt
+   */
+  bool refresh(const SpatialModel &model, const IntVector &residents_by_location,
+               const DistanceRow &distance_row);
+
+  /**
+   * Appends one destination per traveler leaving from_location, nothing when the
+   * location has no reachable destination.
+   */
+  void sample(utils::Random* random, int from_location, int number_of_travelers,
+              IntVector &destinations) const;
+
+  [[nodiscard]] int get_number_of_rebuilds() const { return number_of_rebuilds_; }
+
+  // Residents the tables were built for, empty when the cache is invalid
+  [[nodiscard]] IntVector get_cached_residents() const {
+    return is_valid_ ? cached_residents_ : IntVector{};
+  }
+
+private:
+  double tolerance_;
+  bool is_valid_{false};
+  int number_of_rebuilds_{0};
+  IntVector cached_residents_;
+
+  // destinations with a positive weight and the alias table over their weights, per source
+  std::vector<IntVector> destinations_;
+  std::vector<utils::AliasTable> tables_;
+  DoubleVector weights_;
+};
+}  // namespace Spatial
+
+#endif  // DESTINATIONDISTRIBUTIONCACHE_H
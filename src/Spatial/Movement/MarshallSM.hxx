@@ -43,6 +43,9 @@ public:
 
   // Precompute the kernel function for the movement model
   void prepare_kernel() {
+    // Sparse distances, the kernel is computed on demand from the distance row
+    if (spatial_distance_matrix_.empty()) { return; }
+
     // Allocate the memory
     kernel = new double*[number_of_locations_];
 
@@ -96,8 +99,11 @@ public:
       }
 
       // Calculate the proportional probability
-      double probability =
-          std::pow(population, tau_) * kernel[from_location][destination];
+      const double kernel_value =
+          kernel != nullptr
+              ? kernel[from_location][destination]
+              : std::pow(1 + (relative_distance_vector[destination] / log_rho_), (-alpha_));
+      double probability = std::pow(population, tau_) * kernel_value;
       results[destination] = probability;
     }
 
@@ -6,6 +6,7 @@
 #include "InflatedTCM.h"
 #include "LinearTCM.h"
 #include "SteadyTCM.h"
+#include "Utils/CheckpointArchive.h"
 #include "spdlog/spdlog.h"
 
 double ITreatmentCoverageModel::get_probability_to_be_treated(const int &location, const int &age) {
@@ -17,6 +18,16 @@ double ITreatmentCoverageModel::get_probability_to_be_treated(const int &locatio
   return age <= 5 ? p_treatment_under_5[location] : p_treatment_over_5[location];
 }
 
+void ITreatmentCoverageModel::checkpoint(utils::CheckpointArchive &archive) {
+  archive & type & starting_time & p_treatment_under_5 & p_treatment_over_5;
+}
+
+std::unique_ptr<ITreatmentCoverageModel> ITreatmentCoverageModel::create(const std::string &type) {
+  if (type == "InflatedTCM") { return std::make_unique<InflatedTCM>(); }
+  if (type == "LinearTCM") { return std::make_unique<LinearTCM>(); }
+  return std::make_unique<SteadyTCM>();
+}
+
 std::unique_ptr<ITreatmentCoverageModel> ITreatmentCoverageModel::build_steady_tcm(
     const YAML::Node &node, Config* config) {
   auto result = std::make_unique<SteadyTCM>();
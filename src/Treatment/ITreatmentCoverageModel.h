@@ -7,6 +7,10 @@
 
 #include "Configuration/Config.h"
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class ITreatmentCoverageModel {
 public:
   // disallow copy and move constructors and assign operators
@@ -28,6 +32,12 @@ public:
 
   virtual void monthly_update() = 0;
 
+  // Save or restore every field, the subclasses add their own
+  virtual void checkpoint(utils::CheckpointArchive &archive);
+
+  // Empty model of the given type, a SteadyTCM for an unknown type
+  static std::unique_ptr<ITreatmentCoverageModel> create(const std::string &type);
+
   static std::unique_ptr<ITreatmentCoverageModel> build_steady_tcm(const YAML::Node &node,
                                                                    Config* config);
 
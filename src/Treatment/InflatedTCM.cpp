@@ -1,5 +1,7 @@
 #include "InflatedTCM.h"
 
+#include "Utils/CheckpointArchive.h"
+
 InflatedTCM::InflatedTCM() = default;
 
 void InflatedTCM::monthly_update() {
@@ -12,3 +14,8 @@ void InflatedTCM::monthly_update() {
 
   }
 }
+
+void InflatedTCM::checkpoint(utils::CheckpointArchive &archive) {
+  ITreatmentCoverageModel::checkpoint(archive);
+  archive & monthly_inflation_rate;
+}
@@ -10,6 +10,8 @@ class InflatedTCM : public ITreatmentCoverageModel {
   InflatedTCM();
 
   void monthly_update() override;
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif // INFLATEDICM_H
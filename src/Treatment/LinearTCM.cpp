@@ -2,6 +2,7 @@
 
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
+#include "Utils/CheckpointArchive.h"
 
 void LinearTCM::monthly_update() {
   if (Model::get_scheduler()->current_time() <= end_time) {
@@ -20,3 +21,9 @@ void LinearTCM::update_rate_of_change() {
                                     / (end_time - starting_time));
   }
 }
+
+void LinearTCM::checkpoint(utils::CheckpointArchive &archive) {
+  ITreatmentCoverageModel::checkpoint(archive);
+  archive & p_treatment_under_5_to & p_treatment_over_5_to & end_time & rate_of_change_under_5
+      & rate_of_change_over_5;
+}
@@ -14,6 +14,8 @@ public:
   void monthly_update() override;
 
   void update_rate_of_change();
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif  // LINEARTCM_H
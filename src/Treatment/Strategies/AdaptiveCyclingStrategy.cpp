@@ -16,6 +16,7 @@
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/Therapy.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 AdaptiveCyclingStrategy::AdaptiveCyclingStrategy()
     : IStrategy("AdaptiveCyclingStrategy", AdaptiveCycling) {}
@@ -69,3 +70,7 @@ void AdaptiveCyclingStrategy::adjust_started_time_point(const int &current_time)
 }
 
 void AdaptiveCyclingStrategy::monthly_update() {}
+
+void AdaptiveCyclingStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  archive & index & latest_switch_time;
+}
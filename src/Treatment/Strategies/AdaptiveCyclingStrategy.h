@@ -36,6 +36,8 @@ class AdaptiveCyclingStrategy : public IStrategy {
   void adjust_started_time_point(const int &current_time) override;
 
   void monthly_update() override;
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif /* ADAPTIVECYCLINGSTRATEGY_H */
@@ -16,6 +16,7 @@
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/Therapy.h"
 #include "Utils/Helpers/StringHelpers.h"
+#include "Utils/CheckpointArchive.h"
 
 CyclingStrategy::CyclingStrategy() : IStrategy("CyclingStrategy", Cycling) {}
 
@@ -66,3 +67,7 @@ void CyclingStrategy::adjust_started_time_point(const int &current_time) {
 }
 
 void CyclingStrategy::monthly_update() {}
+
+void CyclingStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  archive & index & next_switching_day;
+}
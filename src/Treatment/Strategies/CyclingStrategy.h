@@ -37,6 +37,8 @@ class CyclingStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
  private:
 
 };
@@ -10,6 +10,10 @@ class Therapy;
 
 class Person;
 
+namespace utils {
+class CheckpointArchive;
+}
+
 class IStrategy {
  public:
 
@@ -66,6 +70,9 @@ class IStrategy {
 
   virtual void monthly_update() = 0;
 
+  // Save or restore the state changed while the simulation runs, nothing by default
+  virtual void checkpoint(utils::CheckpointArchive &archive) {}
+
 };
 
 #endif /* ISTRATEGY_H */
@@ -10,6 +10,7 @@
 #include "Population/Person/Person.h"
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
+#include "Utils/CheckpointArchive.h"
 
 MFTMultiLocationStrategy::MFTMultiLocationStrategy() : IStrategy(
     "MFTMultiLocationStrategy", MFTMultiLocation) {}
@@ -91,3 +92,7 @@ void MFTMultiLocationStrategy::monthly_update() {
     }
   }
 }
+
+void MFTMultiLocationStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  archive & distribution & starting_time;
+}
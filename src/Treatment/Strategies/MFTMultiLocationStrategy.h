@@ -37,6 +37,8 @@ class MFTMultiLocationStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 };
 
 #endif //POMS_MFTDIFFERENTDISTRIBUTIONBYLOCATIONSTRATEGY_H
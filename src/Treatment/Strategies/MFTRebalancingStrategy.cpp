@@ -9,6 +9,7 @@
 #include <string>
 
 #include "Core/Scheduler/Scheduler.h"
+#include "Utils/CheckpointArchive.h"
 
 MFTRebalancingStrategy::MFTRebalancingStrategy() {
   name = "MFTRebalancingStrategy";
@@ -76,3 +77,8 @@ void MFTRebalancingStrategy::adjust_started_time_point(const int &current_time)
   next_update_time = Model::get_scheduler()->current_time() + update_duration_after_rebalancing;
   latest_adjust_distribution_time = -1;
 }
+
+void MFTRebalancingStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  MFTStrategy::checkpoint(archive);
+  archive & latest_adjust_distribution_time & next_update_time & next_distribution;
+}
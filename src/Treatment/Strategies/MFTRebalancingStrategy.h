@@ -27,6 +27,8 @@ class MFTRebalancingStrategy : public MFTStrategy {
   void update_end_of_time_step() override;
 
   void adjust_started_time_point(const int &current_time) override;
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif /* SMARTMFTSTRATEGY_H */
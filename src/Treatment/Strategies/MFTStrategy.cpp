@@ -4,6 +4,7 @@
 #include <sstream>
 #include "IStrategy.h"
 #include "Treatment/Therapies/Therapy.h"
+#include "Utils/CheckpointArchive.h"
 
 MFTStrategy::MFTStrategy() : IStrategy("MFTStrategy", MFT) {}
 
@@ -55,3 +56,5 @@ void MFTStrategy::monthly_update() {
 void MFTStrategy::update_end_of_time_step() {
   //do nothing here
 }
+
+void MFTStrategy::checkpoint(utils::CheckpointArchive &archive) { archive & distribution; }
@@ -37,6 +37,8 @@ class MFTStrategy : public IStrategy {
   void adjust_started_time_point(const int &current_time) override;
 
   void monthly_update() override;
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
 };
 
 #endif /* MFTSTRATEGY_H */
@@ -7,6 +7,8 @@
 #include "Population/Person/Person.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Treatment/Therapies/Therapy.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
 
 NestedMFTMultiLocationStrategy::NestedMFTMultiLocationStrategy() : IStrategy(
@@ -119,3 +121,9 @@ void NestedMFTMultiLocationStrategy::monthly_update() {
   // }
 
 }
+
+void NestedMFTMultiLocationStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  archive & distribution & starting_time;
+  // ModifyNestedMFTEvent replaces the first strategy of the list
+  for (auto &strategy : strategy_list) { Checkpoint::strategy(archive, strategy); }
+}
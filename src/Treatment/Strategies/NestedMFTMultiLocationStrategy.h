@@ -45,6 +45,8 @@ class NestedMFTMultiLocationStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
 };
 
 #endif //POMS_NESTEDSWITCHINGDIFFERENTDISTRIBUTIONBYLOCATION_H
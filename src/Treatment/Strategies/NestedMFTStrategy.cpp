@@ -4,6 +4,8 @@
 #include "Core/Scheduler/Scheduler.h"
 #include "Utils/Random.h"
 #include "Treatment/Therapies/Therapy.h"
+#include "Simulation/Checkpoint.h"
+#include "Utils/CheckpointArchive.h"
 
 void NestedMFTStrategy::add_strategy(IStrategy* strategy) {
   strategy_list.push_back(strategy);
@@ -73,3 +75,9 @@ void NestedMFTStrategy::adjust_distribution(const int& time) {
     }
   }
 }
+
+void NestedMFTStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  archive & distribution & starting_time;
+  // ModifyNestedMFTEvent replaces the first strategy of the list
+  for (auto &strategy : strategy_list) { Checkpoint::strategy(archive, strategy); }
+}
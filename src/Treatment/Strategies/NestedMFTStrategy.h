@@ -37,6 +37,8 @@ class NestedMFTStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
   void adjust_distribution(const int &time);
 };
 
@@ -11,6 +11,7 @@
 #include "Core/Scheduler/Scheduler.h"
 #include "SFTStrategy.h"
 #include "MFTStrategy.h"
+#include "Utils/CheckpointArchive.h"
 
 NovelDrugIntroductionStrategy::NovelDrugIntroductionStrategy() {
   name = "NovelDrugIntroductionStrategy";
@@ -25,6 +26,32 @@ std::string NovelDrugIntroductionStrategy::to_string() const {
   return sstm.str();
 }
 
+void NovelDrugIntroductionStrategy::switch_to_novel_drug() {
+  auto public_sector_strategy = strategy_list[0];
+  auto novel_SFT_strategy = Model::get_strategy_db()[newly_introduced_strategy_id].get();
+
+  auto new_public_stategy = std::make_unique<NestedMFTStrategy>();
+
+  new_public_stategy->strategy_list.push_back(public_sector_strategy);
+  new_public_stategy->strategy_list.push_back(novel_SFT_strategy);
+  new_public_stategy->distribution.push_back(1 - replacement_fraction);
+  new_public_stategy->distribution.push_back(replacement_fraction);
+
+  new_public_stategy->start_distribution.push_back(1);
+  new_public_stategy->start_distribution.push_back(0);
+
+  new_public_stategy->peak_distribution.push_back(1 - replacement_fraction);
+  new_public_stategy->peak_distribution.push_back(replacement_fraction);
+
+  new_public_stategy->peak_after = replacement_duration;
+  new_public_stategy->starting_time = Model::get_scheduler()->current_time();
+
+  strategy_list[0] = new_public_stategy.get();
+  new_public_stategy->id = static_cast<int>(Model::get_strategy_db().size());
+
+  Model::get_strategy_db().push_back(std::move(new_public_stategy));
+}
+
 void NovelDrugIntroductionStrategy::monthly_update() {
   NestedMFTStrategy::monthly_update();
 
@@ -38,29 +65,7 @@ void NovelDrugIntroductionStrategy::monthly_update() {
     if (Model::get_scheduler()->current_time() > 3000 && Model::get_mdc()->current_tf_by_therapy()[current_public_therapy_id] >= tf_threshold) {
 
       // switch to novel drugs
-
-      auto novel_SFT_strategy = Model::get_strategy_db()[newly_introduced_strategy_id].get();
-
-      auto new_public_stategy = std::make_unique<NestedMFTStrategy>();
-
-      new_public_stategy->strategy_list.push_back(public_sector_strategy);
-      new_public_stategy->strategy_list.push_back(novel_SFT_strategy);
-      new_public_stategy->distribution.push_back(1 - replacement_fraction);
-      new_public_stategy->distribution.push_back(replacement_fraction);
-
-      new_public_stategy->start_distribution.push_back(1);
-      new_public_stategy->start_distribution.push_back(0);
-
-      new_public_stategy->peak_distribution.push_back(1 - replacement_fraction);
-      new_public_stategy->peak_distribution.push_back(replacement_fraction);
-
-      new_public_stategy->peak_after = replacement_duration;
-      new_public_stategy->starting_time = Model::get_scheduler()->current_time();
-
-      strategy_list[0] = new_public_stategy.get();
-      new_public_stategy->id = static_cast<int>(Model::get_strategy_db().size());
-
-      Model::get_strategy_db().push_back(std::move(new_public_stategy));
+      switch_to_novel_drug();
 
       //reset the time point to collect ntf
       // Model::get_config()->get_simulation_timeframe().set_start_of_comparison_period(Model::get_scheduler()->current_time());
@@ -92,3 +97,11 @@ void NovelDrugIntroductionStrategy::monthly_update() {
     }
   }
 }
+
+void NovelDrugIntroductionStrategy::checkpoint(utils::CheckpointArchive &archive) {
+  NestedMFTStrategy::checkpoint(archive);
+  const auto was_switched = is_switched;
+  archive & is_switched;
+  // the nested strategy added by the switch is restored right after this one
+  if (archive.is_loading() && is_switched && !was_switched) { switch_to_novel_drug(); }
+}
@@ -26,6 +26,12 @@ public:
   std::string to_string() const override;
 
   void monthly_update() override;
+
+  void checkpoint(utils::CheckpointArchive &archive) override;
+
+private:
+  // Give a share of the public sector to the novel drug strategy through a new nested strategy
+  void switch_to_novel_drug();
 };
 
 #endif // NOVELDRUGSWITCHINGSTRATEGY_H
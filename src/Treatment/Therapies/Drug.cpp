@@ -63,8 +63,7 @@ double Drug::get_current_drug_concentration(int current_time) {
 
 double Drug::get_mutation_probability(double currentDrugConcentration) const {
   double P = 0;
-  double mutation_prob_by_locus =
-      Model::get_config()->get_genotype_parameters().get_mutation_probability_per_locus();
+  double mutation_prob_by_locus = Model::get_config()->hot_parameters().mutation_probability_per_locus;
   if (currentDrugConcentration <= 0) return 0;
   if (currentDrugConcentration < (0.5))
     P = 2 * mutation_prob_by_locus * drug_type_->k() * currentDrugConcentration;
@@ -94,6 +93,15 @@ void Drug::set_number_of_dosing_days(int dosingDays) {
 }
 
 double Drug::get_parasite_killing_rate(const int &genotype_id) const {
-  return drug_type_->get_parasite_killing_rate_by_concentration(
-      last_update_value_, Model::get_genotype_db()->at(genotype_id)->get_EC50_power_n(drug_type_));
+  return get_parasite_killing_rate(Model::get_genotype_db()->at(genotype_id));
+}
+
+double Drug::get_parasite_killing_rate(Genotype* genotype) const {
+  if (power_n_concentration_ != last_update_value_) {
+    concentration_power_n_ = std::pow(last_update_value_, drug_type_->n());
+    power_n_concentration_ = last_update_value_;
+  }
+  // EC50^n is precomputed per genotype and drug when the genotype is created
+  return drug_type_->get_parasite_killing_rate_by_concentration_power_n(
+      concentration_power_n_, genotype->EC50_power_n[drug_type_->id()]);
 }
@@ -1,18 +1,22 @@
 #ifndef DRUG_H
 #define    DRUG_H
 
-#include "Population/DrugsInBlood.h"
+#include <limits>
+
+class DrugsInBlood;
+class DrugType;
+class Genotype;
 
 class Drug {
-    // OBJECTPOOL(Drug)
 
     // Disallow copy
     Drug(const Drug&) = delete;
     Drug& operator=(const Drug&) = delete;
 
-    // Disallow move
-    Drug(Drug&&) = delete;
-    Drug& operator=(Drug&&) = delete;
+public:
+    // Held by value in DrugsInBlood
+    Drug(Drug&&) noexcept = default;
+    Drug& operator=(Drug&&) noexcept = default;
 
 private:
     int dosing_days_;
@@ -23,6 +27,10 @@ private:
     double starting_value_;
     DrugType *drug_type_;
     DrugsInBlood *person_drugs_;
+    // pow(concentration, n) for the killing rates of all clones, evaluated again when the
+    // concentration changes
+    mutable double power_n_concentration_ = std::numeric_limits<double>::quiet_NaN();
+    mutable double concentration_power_n_ = 1.0;
 
 public:
     [[nodiscard]] int dosing_days() const {
@@ -66,6 +74,7 @@ public:
     }
     void set_drug_type(DrugType *value) {
         drug_type_ = value;
+        power_n_concentration_ = std::numeric_limits<double>::quiet_NaN();
     }
     DrugsInBlood *person_drugs() const {
         return person_drugs_;
@@ -77,7 +86,7 @@ public:
   explicit Drug(DrugType *drug_type = nullptr);
 
   //    Drug(const Drug& orig);
-  virtual ~Drug();
+  ~Drug();
 
   void update();
 
@@ -90,6 +99,9 @@ public:
   void set_number_of_dosing_days(int dosingDays);
 
   double get_parasite_killing_rate(const int &genotype_id) const;
+
+  // Same as above without the genotype database lookup, also valid for genotypes not yet given an id
+  double get_parasite_killing_rate(Genotype* genotype) const;
 };
 
 #endif    /* DRUG_H */
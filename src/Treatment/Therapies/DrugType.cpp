@@ -25,8 +25,8 @@ double DrugType::get_parasite_killing_rate_by_concentration(
   // std::cout << "c: " << concentration << " n: " << n_ << " p_max: " <<
   // maximum_parasite_killing_rate_ << " EC50_power_n: " << EC50_power_n << "
   // con_power_n: " << con_power_n << std::endl;
-  const auto killing_perday = maximum_parasite_killing_rate_
-                              * (con_power_n / (con_power_n + EC50_power_n));
+  const auto killing_perday =
+      get_parasite_killing_rate_by_concentration_power_n(con_power_n, EC50_power_n);
   // std::cout<< "c: " << concentration << " n: " << n_ << " ppr: "<<
   // killing_perday << std::endl;
   return killing_perday;
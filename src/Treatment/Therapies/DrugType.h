@@ -69,6 +69,13 @@ public:
 
   virtual double get_parasite_killing_rate_by_concentration(const double &concentration, const double &EC50_power_n);
 
+  // Same as above with pow(concentration, n) already evaluated, which does not depend on the clone
+  [[nodiscard]] double get_parasite_killing_rate_by_concentration_power_n(
+      double concentration_power_n, double EC50_power_n) const {
+    return maximum_parasite_killing_rate_
+           * (concentration_power_n / (concentration_power_n + EC50_power_n));
+  }
+
   virtual double n();
 
   virtual void set_n(const double &n);
@@ -0,0 +1,84 @@
+#include "AliasTable.h"
+
+#include "Random.h"
+
+namespace utils {
+
+void AliasTable::assign(const std::vector<double> &weights) {
+  const auto n = weights.size();
+  total_ = 0.0;
+  for (const auto weight : weights) { total_ += weight; }
+  if (n == 0 || total_ <= 0.0) {
+    clear();
+    return;
+  }
+
+  probabilities_.resize(n);
+  aliases_.resize(n);
+  small_.resize(n);
+  large_.resize(n);
+
+  // scale so the average column holds exactly 1, the partition is written branch free since
+  // the weights are in no particular order
+  const auto scale = static_cast<double>(n) / total_;
+  std::uint32_t heaviest = 0;
+  std::size_t number_of_small = 0;
+  std::size_t number_of_large = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    if (weights[i] > weights[heaviest]) { heaviest = static_cast<std::uint32_t>(i); }
+    probabilities_[i] = weights[i] * scale;
+    aliases_[i] = static_cast<std::uint32_t>(i);
+    const bool is_small = probabilities_[i] < 1.0;
+    small_[number_of_small] = static_cast<std::uint32_t>(i);
+    large_[number_of_large] = static_cast<std::uint32_t>(i);
+    number_of_small += is_small ? 1 : 0;
+    number_of_large += is_small ? 0 : 1;
+  }
+
+  while (number_of_small > 0 && number_of_large > 0) {
+    const auto less = small_[--number_of_small];
+    const auto more = large_[number_of_large - 1];
+
+    // the small column is topped up by the large one
+    aliases_[less] = more;
+    probabilities_[more] -= 1.0 - probabilities_[less];
+    if (probabilities_[more] < 1.0) {
+      number_of_large--;
+      small_[number_of_small++] = more;
+    }
+  }
+
+  // whatever is left is 1 up to rounding
+  for (std::size_t k = 0; k < number_of_large; k++) { probabilities_[large_[k]] = 1.0; }
+  for (std::size_t k = 0; k < number_of_small; k++) {
+    const auto i = small_[k];
+    probabilities_[i] = 1.0;
+    if (weights[i] <= 0.0) {
+      // a zero weight must never be drawn through its own column
+      probabilities_[i] = 0.0;
+      aliases_[i] = heaviest;
+    }
+  }
+}
+
+void AliasTable::clear() {
+  probabilities_.clear();
+  aliases_.clear();
+  total_ = 0.0;
+}
+
+std::size_t AliasTable::index_of(double uniform) const {
+  // the integer part picks the column, the fraction decides between it and its alias
+  const auto scaled = uniform * static_cast<double>(probabilities_.size());
+  auto column = static_cast<std::size_t>(scaled);
+  if (column >= probabilities_.size()) { column = probabilities_.size() - 1; }
+  return scaled - static_cast<double>(column) < probabilities_[column] ? column : aliases_[column];
+}
+
+std::size_t AliasTable::sample(Random* random) const { return index_of(random->random_uniform()); }
+
+void AliasTable::sample(Random* random, std::span<std::size_t> indices) const {
+  for (auto &index : indices) { index = index_of(random->random_uniform()); }
+}
+
+}  // namespace utils
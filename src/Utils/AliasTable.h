@@ -0,0 +1,63 @@
+#ifndef ALIASTABLE_H
+#define ALIASTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace utils {
+class Random;
+
+/**
+ * @class AliasTable
+ * @brief Walker/Vose alias table for drawing indices from a fixed discrete distribution.
+ *
+ * Building the table is O(n), every draw afterwards is O(1) and consumes a
+ * single uniform number. Use it when the same weights are sampled many times;
+ * for weights that change between draws see FenwickTree. The table keeps its
+ * buffers between rebuilds, so a long-lived instance does not allocate once it
+ * has reached its largest size.
+ */
+class AliasTable {
+public:
+  AliasTable() = default;
+
+  explicit AliasTable(const std::vector<double> &weights) { assign(weights); }
+
+  /**
+   * @brief Rebuilds the table from non-negative weights.
+   *
+   * Zero weights are never drawn. When all weights are zero the table is empty.
+   */
+  void assign(const std::vector<double> &weights);
+
+  void clear();
+
+  // Number of weights the table was built from, zero when nothing can be drawn
+  [[nodiscard]] std::size_t size() const { return probabilities_.size(); }
+
+  [[nodiscard]] bool empty() const { return probabilities_.empty(); }
+
+  [[nodiscard]] double total() const { return total_; }
+
+  // Draws one index, the table must not be empty
+  [[nodiscard]] std::size_t sample(Random* random) const;
+
+  // Fills every element of @indices with an independent draw
+  void sample(Random* random, std::span<std::size_t> indices) const;
+
+private:
+  [[nodiscard]] std::size_t index_of(double uniform) const;
+
+  std::vector<double> probabilities_;
+  std::vector<std::uint32_t> aliases_;
+  double total_{0.0};
+
+  // work lists reused by assign()
+  std::vector<std::uint32_t> small_;
+  std::vector<std::uint32_t> large_;
+};
+}  // namespace utils
+
+#endif  // ALIASTABLE_H
@@ -0,0 +1,40 @@
+#include "CheckpointArchive.h"
+
+#include <stdexcept>
+
+namespace utils {
+
+CheckpointWriter::CheckpointWriter(const std::string &path)
+    : path_(path), file_(path, std::ios::binary | std::ios::trunc) {
+  if (!file_) { throw std::runtime_error("Cannot open checkpoint file for writing: " + path); }
+}
+
+void CheckpointWriter::bytes(void* data, std::size_t size) {
+  if (size == 0) { return; }
+  file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+  if (!file_) { throw std::runtime_error("Failed to write checkpoint file: " + path_); }
+}
+
+void CheckpointWriter::close() {
+  file_.close();
+  if (!file_) { throw std::runtime_error("Failed to write checkpoint file: " + path_); }
+}
+
+CheckpointReader::CheckpointReader(const std::string &path)
+    : path_(path), file_(path, std::ios::binary) {
+  if (!file_) { throw std::runtime_error("Cannot open checkpoint file: " + path); }
+}
+
+void CheckpointReader::bytes(void* data, std::size_t size) {
+  if (size == 0) { return; }
+  file_.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+  if (file_.gcount() != static_cast<std::streamsize>(size)) {
+    throw std::runtime_error("Checkpoint file is truncated: " + path_);
+  }
+}
+
+bool CheckpointReader::is_at_end() {
+  return file_.peek() == std::ifstream::traits_type::eof();
+}
+
+}  // namespace utils
@@ -0,0 +1,146 @@
+#ifndef CHECKPOINTARCHIVE_H
+#define CHECKPOINTARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class CheckpointArchive
+ * @brief Binary archive of the simulation checkpoints.
+ *
+ * Objects go through the same checkpoint(archive) function to be saved and
+ * restored: on saving archive & value writes the value, on loading it
+ * overwrites the value with the one read back. Values are stored in native
+ * byte order, a checkpoint is only meant to be restored by the build that
+ * wrote it.
+ */
+class CheckpointArchive {
+public:
+  CheckpointArchive() = default;
+  CheckpointArchive(const CheckpointArchive &) = delete;
+  CheckpointArchive &operator=(const CheckpointArchive &) = delete;
+  CheckpointArchive(CheckpointArchive &&) = delete;
+  CheckpointArchive &operator=(CheckpointArchive &&) = delete;
+  virtual ~CheckpointArchive() = default;
+
+  [[nodiscard]] virtual bool is_loading() const = 0;
+
+  // Write or read back @size bytes at @data
+  virtual void bytes(void* data, std::size_t size) = 0;
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  CheckpointArchive &operator&(T &value) {
+    bytes(&value, sizeof(T));
+    return *this;
+  }
+
+  CheckpointArchive &operator&(std::string &value) {
+    value.resize(size(value.size()));
+    bytes(value.data(), value.size());
+    return *this;
+  }
+
+  template <typename T>
+  CheckpointArchive &operator&(std::vector<T> &values) {
+    values.resize(size(values.size()));
+    if constexpr (std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>) {
+      bytes(values.data(), values.size() * sizeof(T));
+    } else {
+      for (auto &&value : values) { element(value); }
+    }
+    return *this;
+  }
+
+  template <typename K, typename V>
+  CheckpointArchive &operator&(std::map<K, V> &values) {
+    const auto count = size(values.size());
+    if (is_loading()) {
+      values.clear();
+      for (std::size_t i = 0; i < count; i++) {
+        std::pair<K, V> entry;
+        *this & entry.first & entry.second;
+        values.insert(values.end(), std::move(entry));
+      }
+    } else {
+      for (auto &[key, value] : values) {
+        auto saved_key = key;
+        *this & saved_key & value;
+      }
+    }
+    return *this;
+  }
+
+  template <typename... Ts>
+  CheckpointArchive &operator&(std::tuple<Ts...> &value) {
+    std::apply([this](auto &...members) { (*this & ... & members); }, value);
+    return *this;
+  }
+
+  // Save a container size, returns the size read back when loading
+  std::size_t size(std::size_t value) {
+    auto stored = static_cast<std::uint64_t>(value);
+    *this & stored;
+    return static_cast<std::size_t>(stored);
+  }
+
+private:
+  template <typename T>
+  void element(T &value) {
+    *this & value;
+  }
+
+  // elements of std::vector<bool> are proxies
+  void element(std::vector<bool>::reference value) {
+    bool stored = value;
+    *this & stored;
+    value = stored;
+  }
+};
+
+// Writes a checkpoint file, throws std::runtime_error when the file can not be written
+class CheckpointWriter : public CheckpointArchive {
+public:
+  explicit CheckpointWriter(const std::string &path);
+
+  [[nodiscard]] bool is_loading() const override { return false; }
+
+  void bytes(void* data, std::size_t size) override;
+
+  // Flush the file, reports write errors that happened since the last check
+  void close();
+
+private:
+  std::string path_;
+  std::ofstream file_;
+};
+
+// Reads a checkpoint file, throws std::runtime_error on a missing or truncated file
+class CheckpointReader : public CheckpointArchive {
+public:
+  explicit CheckpointReader(const std::string &path);
+
+  [[nodiscard]] bool is_loading() const override { return true; }
+
+  void bytes(void* data, std::size_t size) override;
+
+  // True once every byte of the file has been read
+  [[nodiscard]] bool is_at_end();
+
+private:
+  std::string path_;
+  std::ifstream file_;
+};
+
+}  // namespace utils
+
+#endif  // CHECKPOINTARCHIVE_H
@@ -20,6 +20,9 @@ public:
     bool record_cell_movement{false};
     bool record_district_movement{false};
     bool record_movement{false};
+    std::string checkpoint_path;
+    std::string checkpoint_date;
+    std::string restore_path;
   };
   struct DxGAppInput {
     std::string input_file{ "input.yml" };
@@ -110,6 +113,12 @@ public:
     return cli_input_.record_district_movement;
   }
   [[nodiscard]] bool get_record_movement() const { return cli_input_.record_movement; }
+  [[nodiscard]] std::string get_checkpoint_path() const { return cli_input_.checkpoint_path; }
+  void set_checkpoint_path(const std::string &path) { cli_input_.checkpoint_path = path; }
+  [[nodiscard]] std::string get_checkpoint_date() const { return cli_input_.checkpoint_date; }
+  void set_checkpoint_date(const std::string &date) { cli_input_.checkpoint_date = date; }
+  [[nodiscard]] std::string get_restore_path() const { return cli_input_.restore_path; }
+  void set_restore_path(const std::string &path) { cli_input_.restore_path = path; }
   [[nodiscard]] DxGAppInput get_dxg_app_input() {
     return dxg_input_;
   }
@@ -141,6 +150,15 @@ public:
                    "Record the movement between districts.");
 
     app.add_option("--replicate", input.replicate, "Replicate number. Default: 1");
+
+    app.add_option("--checkpoint", input.checkpoint_path,
+                   "Save the simulation state to this file at the start of --checkpoint-date.");
+
+    app.add_option("--checkpoint-date", input.checkpoint_date,
+                   "Date of the checkpoint (YYYY/MM/DD), the simulation keeps running after it.");
+
+    app.add_option("--restore", input.restore_path,
+                   "Resume from a checkpoint saved with the same build and input file.");
   }
 
   static void create_dxg_cli_options(CLI::App &app, DxGAppInput &input) {
@@ -191,6 +209,11 @@ public:
 
     if (input.record_movement) { spdlog::info("Movement data will be recorded."); }
 
+    if (input.checkpoint_path.empty() != input.checkpoint_date.empty()) {
+      spdlog::error("--checkpoint and --checkpoint-date must be given together.");
+      return false;
+    }
+
     switch (input.verbosity) {
       case 0: {
         spdlog::set_level(spdlog::level::info);
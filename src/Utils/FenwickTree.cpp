@@ -0,0 +1,139 @@
+#include "FenwickTree.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "CheckpointArchive.h"
+#include "Random.h"
+
+namespace {
+std::size_t lowbit(std::size_t value) { return value & (~value + 1); }
+}  // namespace
+
+namespace utils {
+
+void FenwickTree::assign(const std::vector<double> &weights) {
+  weights_ = weights;
+  tree_.assign(weights_.size() + 1, 0.0);
+  for (std::size_t i = 1; i < tree_.size(); i++) {
+    tree_[i] += weights_[i - 1];
+    const auto parent = i + lowbit(i);
+    if (parent < tree_.size()) { tree_[parent] += tree_[i]; }
+  }
+  rebuild_counts();
+}
+
+void FenwickTree::rebuild_counts() {
+  counts_.assign(weights_.size() + 1, 0);
+  for (std::size_t i = 1; i < counts_.size(); i++) {
+    counts_[i] += weights_[i - 1] > 0.0 ? 1 : 0;
+    const auto parent = i + lowbit(i);
+    if (parent < counts_.size()) { counts_[parent] += counts_[i]; }
+  }
+}
+
+void FenwickTree::clear() {
+  weights_.clear();
+  tree_.assign(1, 0.0);
+  counts_.assign(1, 0);
+}
+
+void FenwickTree::checkpoint(CheckpointArchive &archive) {
+  archive & tree_ & weights_;
+  // exact, derived from the weights
+  if (archive.is_loading()) { rebuild_counts(); }
+}
+
+void FenwickTree::push_back(double weight) {
+  weights_.push_back(weight);
+  const auto node = weights_.size();
+  // the new node covers its own weight plus the nodes node - 1, node - 2, node - 4, ...
+  auto sum = weight;
+  std::uint32_t count = weight > 0.0 ? 1 : 0;
+  for (std::size_t step = 1; step < lowbit(node); step <<= 1) {
+    sum += tree_[node - step];
+    count += counts_[node - step];
+  }
+  tree_.push_back(sum);
+  counts_.push_back(count);
+}
+
+void FenwickTree::pop_back() {
+  // no remaining node covers the last one
+  weights_.pop_back();
+  tree_.pop_back();
+  counts_.pop_back();
+}
+
+void FenwickTree::set(std::size_t index, double weight) {
+  const auto delta = weight - weights_[index];
+  const auto was_positive = weights_[index] > 0.0;
+  weights_[index] = weight;
+  if (delta == 0.0) { return; }
+  for (auto node = index + 1; node < tree_.size(); node += lowbit(node)) { tree_[node] += delta; }
+
+  if (const auto is_positive = weight > 0.0; is_positive != was_positive) {
+    for (auto node = index + 1; node < counts_.size(); node += lowbit(node)) {
+      if (is_positive) {
+        counts_[node]++;
+      } else {
+        counts_[node]--;
+      }
+    }
+  }
+}
+
+double FenwickTree::prefix_sum(std::size_t count) const {
+  double sum = 0.0;
+  for (auto node = count; node > 0; node -= lowbit(node)) { sum += tree_[node]; }
+  return sum;
+}
+
+std::size_t FenwickTree::positive_count(std::size_t count) const {
+  std::size_t sum = 0;
+  for (auto node = count; node > 0; node -= lowbit(node)) { sum += counts_[node]; }
+  return sum;
+}
+
+std::size_t FenwickTree::select_positive(std::size_t rank) const {
+  const auto n = weights_.size();
+  std::size_t position = 0;
+  for (auto step = std::bit_floor(n); step > 0; step >>= 1) {
+    if (position + step <= n && counts_[position + step] <= rank) {
+      position += step;
+      rank -= counts_[position];
+    }
+  }
+  return position;
+}
+
+std::size_t FenwickTree::find(double target) const {
+  const auto n = weights_.size();
+  const auto number_of_positives = number_of_positive_weights();
+  if (number_of_positives == 0) { return n; }
+
+  std::size_t position = 0;
+  for (auto step = std::bit_floor(n); step > 0; step >>= 1) {
+    if (position + step <= n && tree_[position + step] <= target) {
+      position += step;
+      target -= tree_[position];
+    }
+  }
+  if (position < n && weights_[position] > 0.0) { return position; }
+
+  // landed on a zero weight through rounding, or target at or above the total: the next positive
+  // weight, else the last one
+  const auto rank = position < n ? positive_count(position) : number_of_positives;
+  return select_positive(std::min(rank, number_of_positives - 1));
+}
+
+std::size_t FenwickTree::sample(Random* random) const {
+  return find(random->random_uniform() * total());
+}
+
+void FenwickTree::sample(Random* random, std::span<std::size_t> indices) const {
+  const auto sum = total();
+  for (auto &index : indices) { index = find(random->random_uniform() * sum); }
+}
+
+}  // namespace utils
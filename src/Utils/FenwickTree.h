@@ -0,0 +1,100 @@
+#ifndef FENWICKTREE_H
+#define FENWICKTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace utils {
+class CheckpointArchive;
+class Random;
+
+/**
+ * @class FenwickTree
+ * @brief Binary indexed tree of non-negative weights for dynamic weighted sampling.
+ *
+ * Changing one weight, appending or removing the last weight and locating the
+ * index of a cumulative weight are all O(log n), so a distribution whose
+ * weights change a few at a time never needs a full rebuild. The weights are
+ * also kept as given, set() overwrites a weight without accumulating deltas on
+ * the caller side.
+ *
+ * Next to the partial sums the tree counts the positive weights exactly, so
+ * the rounding left in the sums once every weight went back to zero neither
+ * shows in total() nor lets find() land on a zero weight.
+ */
+class FenwickTree {
+public:
+  FenwickTree() = default;
+
+  explicit FenwickTree(const std::vector<double> &weights) { assign(weights); }
+
+  // Rebuild from the given weights in O(n), also clears accumulated rounding errors
+  void assign(const std::vector<double> &weights);
+
+  void clear();
+
+  void push_back(double weight);
+
+  void pop_back();
+
+  void set(std::size_t index, double weight);
+
+  [[nodiscard]] double weight(std::size_t index) const { return weights_[index]; }
+
+  [[nodiscard]] std::size_t size() const { return weights_.size(); }
+
+  [[nodiscard]] bool empty() const { return weights_.empty(); }
+
+  // Sum of the weights in [0, count)
+  [[nodiscard]] double prefix_sum(std::size_t count) const;
+
+  // 0.0 exactly when no weight is positive, whatever rounding the partial sums carry
+  [[nodiscard]] double total() const {
+    return number_of_positive_weights() == 0 ? 0.0 : prefix_sum(weights_.size());
+  }
+
+  [[nodiscard]] std::size_t number_of_positive_weights() const {
+    return positive_count(weights_.size());
+  }
+
+  /**
+   * @brief Finds the index whose cumulative range [prefix_sum(i), prefix_sum(i + 1)) contains
+   * the target.
+   *
+   * Zero weights are never returned, a target falling on one by rounding moves to the next
+   * positive weight. A target at or above total() returns the last index with a positive
+   * weight, which absorbs rounding at the upper end.
+   *
+   * @return The index, or size() when all weights are zero.
+   */
+  [[nodiscard]] std::size_t find(double target) const;
+
+  // Draws one index proportionally to the weights, the total must be positive
+  [[nodiscard]] std::size_t sample(Random* random) const;
+
+  // Fills every element of @indices with an independent draw, the total must be positive
+  void sample(Random* random, std::span<std::size_t> indices) const;
+
+  // Save or restore the weights and the partial sums as they are, rounding errors included
+  void checkpoint(CheckpointArchive &archive);
+
+private:
+  // Number of positive weights in [0, count)
+  [[nodiscard]] std::size_t positive_count(std::size_t count) const;
+
+  // Index of the positive weight of the given rank, counting from 0
+  [[nodiscard]] std::size_t select_positive(std::size_t rank) const;
+
+  void rebuild_counts();
+
+  // 1-based, tree_[i] holds the sum of the weights in (i - lowbit(i), i]
+  std::vector<double> tree_{0.0};
+  // same layout, number of positive weights in (i - lowbit(i), i]
+  std::vector<std::uint32_t> counts_{0};
+  std::vector<double> weights_;
+};
+}  // namespace utils
+
+#endif  // FENWICKTREE_H
@@ -0,0 +1,151 @@
+#include "SQLiteBulkWriter.h"
+
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+
+SQLiteBulkWriter::SQLiteBulkWriter(sqlite3* db, std::size_t queue_capacity)
+    : db_(db), queue_capacity_(queue_capacity) {
+  if (db_ == nullptr) { throw std::invalid_argument("SQLiteBulkWriter requires an open database."); }
+  if (queue_capacity_ == 0) {
+    throw std::invalid_argument("SQLiteBulkWriter requires a queue capacity of at least one.");
+  }
+  thread_ = std::thread([this] { writer_loop(); });
+}
+
+SQLiteBulkWriter::~SQLiteBulkWriter() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  buffer_ready_.notify_all();
+  if (thread_.joinable()) { thread_.join(); }
+
+  for (auto &[key, stmt] : statements_) { sqlite3_finalize(stmt); }
+}
+
+std::size_t SQLiteBulkWriter::register_statement(const std::string &insert_prefix) {
+  std::lock_guard lock(mutex_);
+  insert_prefixes_.push_back(insert_prefix);
+  return insert_prefixes_.size() - 1;
+}
+
+SQLiteRowBuffer SQLiteBulkWriter::acquire_buffer() {
+  std::lock_guard lock(mutex_);
+  if (spare_buffers_.empty()) { return {}; }
+  auto buffer = std::move(spare_buffers_.back());
+  spare_buffers_.pop_back();
+  return buffer;
+}
+
+void SQLiteBulkWriter::submit(SQLiteRowBuffer buffer) {
+  if (buffer.empty()) { return; }
+  {
+    std::unique_lock lock(mutex_);
+    buffer_taken_.wait(lock, [this] { return queue_.size() < queue_capacity_; });
+    queue_.push_back(std::move(buffer));
+  }
+  buffer_ready_.notify_one();
+}
+
+void SQLiteBulkWriter::flush() {
+  std::unique_lock lock(mutex_);
+  drained_.wait(lock, [this] { return queue_.empty() && !writing_; });
+}
+
+void SQLiteBulkWriter::writer_loop() {
+  while (true) {
+    SQLiteRowBuffer buffer;
+    {
+      std::unique_lock lock(mutex_);
+      buffer_ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      // the pending buffers are still written when stopping
+      if (queue_.empty()) { return; }
+      buffer = std::move(queue_.front());
+      queue_.pop_front();
+      writing_ = true;
+    }
+    buffer_taken_.notify_one();
+
+    write(buffer);
+
+    buffer.clear();
+    {
+      std::lock_guard lock(mutex_);
+      writing_ = false;
+      if (spare_buffers_.size() < queue_capacity_) { spare_buffers_.push_back(std::move(buffer)); }
+    }
+    drained_.notify_all();
+  }
+}
+
+void SQLiteBulkWriter::write(const SQLiteRowBuffer &buffer) {
+  if (!execute("BEGIN TRANSACTION;")) { return; }
+
+  const auto &values = buffer.values_;
+  for (std::size_t row = 0; row < buffer.rows_.size(); row++) {
+    const auto begin = buffer.rows_[row].begin;
+    const auto end = row + 1 < buffer.rows_.size() ? buffer.rows_[row + 1].begin : values.size();
+    auto* stmt = statement(buffer.rows_[row].statement_id, end - begin);
+    if (stmt == nullptr) {
+      execute("ROLLBACK TRANSACTION;");
+      return;
+    }
+
+    for (auto i = begin; i < end; i++) {
+      const auto index = static_cast<int>(i - begin) + 1;
+      if (values[i].is_real) {
+        sqlite3_bind_double(stmt, index, values[i].real);
+      } else {
+        sqlite3_bind_int64(stmt, index, values[i].integer);
+      }
+    }
+    const auto result = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    if (result != SQLITE_DONE) {
+      spdlog::error("Error inserting row: {}", sqlite3_errmsg(db_));
+      execute("ROLLBACK TRANSACTION;");
+      return;
+    }
+  }
+
+  execute("COMMIT TRANSACTION;");
+}
+
+sqlite3_stmt* SQLiteBulkWriter::statement(std::size_t statement_id,
+                                          std::size_t number_of_values) {
+  const auto key = std::make_pair(statement_id, number_of_values);
+  if (auto it = statements_.find(key); it != statements_.end()) { return it->second; }
+
+  std::string sql;
+  {
+    std::lock_guard lock(mutex_);
+    if (statement_id >= insert_prefixes_.size()) {
+      spdlog::error("Unknown insert statement id: {}", statement_id);
+      return nullptr;
+    }
+    sql = insert_prefixes_[statement_id];
+  }
+  sql += " (";
+  for (std::size_t i = 0; i < number_of_values; i++) { sql += i == 0 ? "?" : ", ?"; }
+  sql += ");";
+
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    spdlog::error("Error preparing statement: {}", sqlite3_errmsg(db_));
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+  statements_.emplace(key, stmt);
+  return stmt;
+}
+
+bool SQLiteBulkWriter::execute(const char* sql) {
+  char* err_msg = nullptr;
+  if (sqlite3_exec(db_, sql, nullptr, nullptr, &err_msg) != SQLITE_OK) {
+    spdlog::error("SQL error: {} {}", sql, err_msg == nullptr ? "" : err_msg);
+    sqlite3_free(err_msg);
+    return false;
+  }
+  return true;
+}
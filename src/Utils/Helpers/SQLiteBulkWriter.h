@@ -0,0 +1,132 @@
+#ifndef SQLITEBULKWRITER_H
+#define SQLITEBULKWRITER_H
+
+#include <sqlite3.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// SQLiteRowBuffer holds the rows of one unit of work, e.g. the reports of a month, as typed
+// values that SQLiteBulkWriter binds to prepared statements, without going through SQL text.
+class SQLiteRowBuffer {
+public:
+  // Starts a new row, inserted with the statement registered as @statement_id
+  void begin_row(std::size_t statement_id) { rows_.push_back({statement_id, values_.size()}); }
+
+  // Appends the next column value of the current row
+  template <typename T>
+  void add(T value) {
+    static_assert(std::is_arithmetic_v<T>, "only integral and floating point values are bound");
+    Value column{};
+    if constexpr (std::is_floating_point_v<T>) {
+      column.is_real = true;
+      column.real = static_cast<double>(value);
+    } else {
+      column.integer = static_cast<sqlite3_int64>(value);
+    }
+    values_.push_back(column);
+  }
+
+  // Appends every value of @values to the current row
+  template <typename Range>
+  void add_all(const Range &values) {
+    for (const auto &value : values) { add(value); }
+  }
+
+  [[nodiscard]] std::size_t number_of_rows() const { return rows_.size(); }
+  [[nodiscard]] bool empty() const { return rows_.empty(); }
+
+  // Drops the rows but keeps the storage
+  void clear() {
+    rows_.clear();
+    values_.clear();
+  }
+
+private:
+  friend class SQLiteBulkWriter;
+
+  struct Row {
+    std::size_t statement_id;
+    std::size_t begin;
+  };
+
+  struct Value {
+    bool is_real{false};
+    union {
+      sqlite3_int64 integer;
+      double real;
+    };
+  };
+
+  std::vector<Row> rows_;
+  std::vector<Value> values_;
+};
+
+// SQLiteBulkWriter inserts SQLiteRowBuffers on a dedicated thread. Each buffer is written in its
+// own transaction, every row binding its values to a prepared statement cached by statement and
+// row width. Submitted buffers wait in a bounded queue, so the caller only blocks when the writer
+// falls that many buffers behind.
+//
+// The writer uses the connection while buffers are pending: other users of the connection must
+// call flush() first. Errors are logged and roll back the buffer they occur in.
+class SQLiteBulkWriter {
+public:
+  static constexpr std::size_t DEFAULT_QUEUE_CAPACITY = 4;
+
+  explicit SQLiteBulkWriter(sqlite3* db, std::size_t queue_capacity = DEFAULT_QUEUE_CAPACITY);
+  // Writes the pending buffers before returning
+  ~SQLiteBulkWriter();
+
+  SQLiteBulkWriter(const SQLiteBulkWriter &) = delete;
+  SQLiteBulkWriter &operator=(const SQLiteBulkWriter &) = delete;
+  SQLiteBulkWriter(SQLiteBulkWriter &&) = delete;
+  SQLiteBulkWriter &operator=(SQLiteBulkWriter &&) = delete;
+
+  // Registers an insert statement given up to its values, e.g.
+  // "INSERT INTO genotype (id, name) VALUES", and returns its id for SQLiteRowBuffer::begin_row
+  std::size_t register_statement(const std::string &insert_prefix);
+
+  // Returns an empty buffer, reusing the storage of a written one when available
+  SQLiteRowBuffer acquire_buffer();
+
+  // Queues @buffer for writing, blocks while the queue is full
+  void submit(SQLiteRowBuffer buffer);
+
+  // Blocks until every submitted buffer is written
+  void flush();
+
+private:
+  void writer_loop();
+  void write(const SQLiteRowBuffer &buffer);
+  sqlite3_stmt* statement(std::size_t statement_id, std::size_t number_of_values);
+  bool execute(const char* sql);
+
+  sqlite3* db_;
+  std::size_t queue_capacity_;
+
+  // prepared statements by statement id and row width, only used by the writer thread
+  std::map<std::pair<std::size_t, std::size_t>, sqlite3_stmt*> statements_;
+
+  std::mutex mutex_;
+  std::condition_variable buffer_ready_;
+  std::condition_variable buffer_taken_;
+  std::condition_variable drained_;
+  std::vector<std::string> insert_prefixes_;
+  std::deque<SQLiteRowBuffer> queue_;
+  std::vector<SQLiteRowBuffer> spare_buffers_;
+  bool writing_{false};
+  bool stopping_{false};
+
+  // started last, once the members it reads are constructed
+  std::thread thread_;
+};
+
+#endif  // SQLITEBULKWRITER_H
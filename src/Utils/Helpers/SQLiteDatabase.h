@@ -104,6 +104,9 @@ public:
     }
   }
 
+  // Returns the underlying connection, e.g. for SQLiteBulkWriter
+  [[nodiscard]] sqlite3* handle() const { return db_; }
+
   // Executes a given SQL statement without expecting a return value.
   // Throws a runtime_error if the execution fails.
   void execute(const std::string &sql) {
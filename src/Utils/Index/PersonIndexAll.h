@@ -24,6 +24,8 @@ public:
 
   void add(PersonUniquePtr person);
 
+  void reserve(std::size_t capacity) { v_person_.reserve(capacity); }
+
   void remove(Person* person);
 
   void clear();
@@ -0,0 +1,215 @@
+#include "PersonStore.h"
+
+#include <cassert>
+#include <stdexcept>
+
+#include "Population/ClonalParasitePopulation.h"
+#include "Utils/CheckpointArchive.h"
+#include "Utils/Random.h"
+
+PersonStore::PersonStore(int number_of_locations) : columns_by_location_(number_of_locations) {}
+
+PersonStore::~PersonStore() { columns_by_location_.clear(); }
+
+void PersonStore::add(Person* person) {
+  assert(person->get_location() >= 0
+         && person->get_location() < static_cast<int>(columns_by_location_.size()));
+  add(person, person->get_location());
+}
+
+void PersonStore::remove(Person* person) { remove(person, person->get_location()); }
+
+std::size_t PersonStore::size() const {
+  std::size_t total = 0;
+  for (const auto &columns : columns_by_location_) { total += columns.size(); }
+  return total;
+}
+
+void PersonStore::update() {
+  for (auto &columns : columns_by_location_) {
+    columns.persons.shrink_to_fit();
+    columns.host_states.shrink_to_fit();
+    columns.age_classes.shrink_to_fit();
+    columns.moving_levels.shrink_to_fit();
+    columns.relative_biting_rates.shrink_to_fit();
+    columns.log10_infectious_densities.shrink_to_fit();
+  }
+  if (tracking_weights_) { rebuild_weights(); }
+}
+
+void PersonStore::track_weights(const std::vector<double> &moving_level_values) {
+  moving_level_values_ = moving_level_values;
+  tracking_weights_ = true;
+  rebuild_weights();
+}
+
+void PersonStore::rebuild_weights() {
+  std::array<std::vector<double>, NUMBER_OF_WEIGHTS> values;
+  for (auto &columns : columns_by_location_) {
+    for (auto &weight_values : values) { weight_values.resize(columns.size()); }
+    for (std::size_t slot = 0; slot < columns.size(); slot++) {
+      const auto weights = weights_of(columns, slot);
+      for (int weight = 0; weight < NUMBER_OF_WEIGHTS; weight++) {
+        values[weight][slot] = weights[weight];
+      }
+    }
+    for (int weight = 0; weight < NUMBER_OF_WEIGHTS; weight++) {
+      columns.weights[weight].assign(values[weight]);
+    }
+  }
+}
+
+void PersonStore::assign(int location, const std::vector<Person*> &persons) {
+  auto &columns = columns_by_location_[location];
+  columns.persons.clear();
+  columns.host_states.clear();
+  columns.age_classes.clear();
+  columns.moving_levels.clear();
+  columns.relative_biting_rates.clear();
+  columns.log10_infectious_densities.clear();
+  columns.number_of_alive_persons = 0;
+  for (auto &tree : columns.weights) { tree.clear(); }
+  for (auto* person : persons) { add(person, location); }
+}
+
+void PersonStore::checkpoint_weights(utils::CheckpointArchive &archive) {
+  auto is_tracking_weights = tracking_weights_;
+  archive & is_tracking_weights;
+  if (is_tracking_weights != tracking_weights_) {
+    throw std::runtime_error("Checkpoint was saved with another force of infection mode");
+  }
+  if (!tracking_weights_) { return; }
+  for (auto &columns : columns_by_location_) {
+    for (auto &tree : columns.weights) { tree.checkpoint(archive); }
+  }
+}
+
+void PersonStore::sample(Weight weight, int location, int number_of_samples,
+                         utils::Random* random, std::vector<Person*> &samples) const {
+  assert(tracking_weights_);
+  const auto &columns = columns_by_location_[location];
+  const auto &tree = columns.weights[weight];
+  if (tree.total() <= 0.0) { return; }
+
+  slots_.resize(number_of_samples);
+  tree.sample(random, slots_);
+  for (const auto slot : slots_) {
+    // find() returns size() only without any positive weight, guarded above
+    if (slot >= columns.persons.size()) {
+      throw std::logic_error("PersonStore::sample drew a slot past the end of the location");
+    }
+    samples.push_back(columns.persons[slot]);
+  }
+}
+
+void PersonStore::notify_change(Person* person, const Person::Property &property,
+                                const void* old_value, const void* new_value) {
+  if (property == Person::LOCATION) {
+    // the person still holds the old location, re-read the other columns after the move
+    remove(person, *static_cast<const int*>(old_value));
+    add(person, *static_cast<const int*>(new_value));
+    return;
+  }
+
+  auto &columns = columns_by_location_[person->get_location()];
+  const auto slot = person->PersonStoreHandler::get_index();
+  switch (property) {
+    case Person::HOST_STATE: {
+      const auto host_state = *static_cast<const Person::HostStates*>(new_value);
+      if (columns.host_states[slot] == Person::DEAD) { columns.number_of_alive_persons++; }
+      if (host_state == Person::DEAD) { columns.number_of_alive_persons--; }
+      columns.host_states[slot] = static_cast<std::uint8_t>(host_state);
+      break;
+    }
+    case Person::AGE_CLASS:
+      columns.age_classes[slot] = *static_cast<const int*>(new_value);
+      return;
+    case Person::MOVING_LEVEL:
+      columns.moving_levels[slot] = *static_cast<const int*>(new_value);
+      break;
+    case Person::RELATIVE_BITING_RATE:
+      columns.relative_biting_rates[slot] = *static_cast<const double*>(new_value);
+      break;
+    case Person::INFECTIOUS_DENSITY:
+      columns.log10_infectious_densities[slot] = *static_cast<const double*>(new_value);
+      break;
+    default:
+      return;
+  }
+  refresh_weights(columns, slot);
+}
+
+void PersonStore::add(Person* person, int location) {
+  auto &columns = columns_by_location_[location];
+  person->PersonStoreHandler::set_index(columns.size());
+  columns.persons.push_back(person);
+  columns.host_states.push_back(static_cast<std::uint8_t>(person->get_host_state()));
+  columns.age_classes.push_back(person->get_age_class());
+  columns.moving_levels.push_back(person->get_moving_level());
+  columns.relative_biting_rates.push_back(person->get_current_relative_biting_rate());
+  columns.log10_infectious_densities.push_back(
+      person->get_all_clonal_parasite_populations()->log10_total_infectious_density());
+  if (person->get_host_state() != Person::DEAD) { columns.number_of_alive_persons++; }
+
+  if (tracking_weights_) {
+    const auto weights = weights_of(columns, columns.size() - 1);
+    for (int weight = 0; weight < NUMBER_OF_WEIGHTS; weight++) {
+      columns.weights[weight].push_back(weights[weight]);
+    }
+  }
+}
+
+void PersonStore::remove(Person* person, int location) {
+  auto &columns = columns_by_location_[location];
+  const auto slot = person->PersonStoreHandler::get_index();
+  const auto last = columns.size() - 1;
+  assert(slot <= last && columns.persons[slot] == person);
+
+  if (columns.host_states[slot] != Person::DEAD) { columns.number_of_alive_persons--; }
+  if (slot != last) {
+    columns.persons[last]->PersonStoreHandler::set_index(slot);
+    columns.persons[slot] = columns.persons[last];
+    columns.host_states[slot] = columns.host_states[last];
+    columns.age_classes[slot] = columns.age_classes[last];
+    columns.moving_levels[slot] = columns.moving_levels[last];
+    columns.relative_biting_rates[slot] = columns.relative_biting_rates[last];
+    columns.log10_infectious_densities[slot] = columns.log10_infectious_densities[last];
+    if (tracking_weights_) {
+      for (auto &tree : columns.weights) { tree.set(slot, tree.weight(last)); }
+    }
+  }
+  columns.persons.pop_back();
+  columns.host_states.pop_back();
+  columns.age_classes.pop_back();
+  columns.moving_levels.pop_back();
+  columns.relative_biting_rates.pop_back();
+  columns.log10_infectious_densities.pop_back();
+  if (tracking_weights_) {
+    for (auto &tree : columns.weights) { tree.pop_back(); }
+  }
+  person->PersonStoreHandler::set_index(-1);
+}
+
+std::array<double, PersonStore::NUMBER_OF_WEIGHTS> PersonStore::weights_of(
+    const LocationColumns &columns, std::size_t slot) const {
+  std::array<double, NUMBER_OF_WEIGHTS> weights{};
+  if (columns.host_states[slot] == Person::DEAD) { return weights; }
+
+  const auto relative_biting_rate = columns.relative_biting_rates[slot];
+  const auto log10_infectious_density = columns.log10_infectious_densities[slot];
+  weights[RELATIVE_BITING] = relative_biting_rate;
+  weights[RELATIVE_MOVING] = moving_level_values_[columns.moving_levels[slot]];
+  weights[FORCE_OF_INFECTION] =
+      log10_infectious_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY
+          ? 0.0
+          : relative_biting_rate * Person::relative_infectivity(log10_infectious_density);
+  return weights;
+}
+
+void PersonStore::refresh_weights(LocationColumns &columns, std::size_t slot) const {
+  if (!tracking_weights_) { return; }
+  const auto weights = weights_of(columns, slot);
+  for (int weight = 0; weight < NUMBER_OF_WEIGHTS; weight++) {
+    columns.weights[weight].set(slot, weights[weight]);
+  }
+}
@@ -0,0 +1,135 @@
+#ifndef PERSONSTORE_H
+#define PERSONSTORE_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "PersonIndex.h"
+#include "Population/Person/Person.h"
+#include "Utils/FenwickTree.h"
+
+namespace utils {
+class CheckpointArchive;
+class Random;
+}
+
+/**
+ * Structure-of-arrays copy of the fields read by the daily force of infection and sampling
+ * weight rebuild, grouped by location.
+ *
+ * A person occupies one dense slot (PersonStoreHandler index) in the columns of its location and
+ * every column is indexed by that slot, so a daily sweep over a location reads a few contiguous
+ * arrays instead of chasing Person pointers. The columns are kept in sync through notify_change;
+ * removing a person moves the last slot of the location into the hole.
+ *
+ * Once track_weights() is called the store also keeps, per location, a Fenwick tree of each
+ * sampling weight (relative biting, relative moving and individual force of infection, all zero
+ * for dead persons). Every change then costs O(log n) and the totals and weighted draws are
+ * available at any time without a daily rebuild.
+ */
+class PersonStore : public PersonIndex {
+public:
+  // disable copy and assign
+  PersonStore(const PersonStore &) = delete;
+  void operator=(const PersonStore &) = delete;
+
+  enum Weight : uint8_t {
+    RELATIVE_BITING = 0,
+    RELATIVE_MOVING,
+    FORCE_OF_INFECTION,
+    NUMBER_OF_WEIGHTS
+  };
+
+  struct LocationColumns {
+    std::vector<Person*> persons;
+    std::vector<std::uint8_t> host_states;
+    std::vector<int> age_classes;
+    std::vector<int> moving_levels;
+    std::vector<double> relative_biting_rates;
+    std::vector<double> log10_infectious_densities;
+    std::size_t number_of_alive_persons{0};
+    std::array<utils::FenwickTree, NUMBER_OF_WEIGHTS> weights;
+
+    [[nodiscard]] std::size_t size() const { return persons.size(); }
+  };
+
+  explicit PersonStore(int number_of_locations = 1);
+
+  ~PersonStore() override;
+
+  [[nodiscard]] const LocationColumns &columns_at(int location) const {
+    return columns_by_location_[location];
+  }
+
+  [[nodiscard]] int number_of_locations() const {
+    return static_cast<int>(columns_by_location_.size());
+  }
+
+  /**
+   * Start maintaining the sampling weights of every location.
+   *
+   * @param moving_level_values relative moving weight of each moving level
+   */
+  void track_weights(const std::vector<double> &moving_level_values);
+
+  [[nodiscard]] bool is_tracking_weights() const { return tracking_weights_; }
+
+  // Recompute all tracked weights from the columns, drops the rounding errors of the updates
+  void rebuild_weights();
+
+  /**
+   * Refill the columns of the location with @persons in this slot order, used when restoring a
+   * checkpoint since the slot order decides which person a weighted draw picks.
+   */
+  void assign(int location, const std::vector<Person*> &persons);
+
+  // Save or restore the Fenwick trees of the tracked weights, rounding errors included
+  void checkpoint_weights(utils::CheckpointArchive &archive);
+
+  [[nodiscard]] std::size_t number_of_alive_persons(int location) const {
+    return columns_by_location_[location].number_of_alive_persons;
+  }
+
+  [[nodiscard]] double total_weight(Weight weight, int location) const {
+    return columns_by_location_[location].weights[weight].total();
+  }
+
+  /**
+   * Append number_of_samples persons of the location drawn with replacement proportionally to
+   * the weight, in draw order. Requires track_weights(); nothing is drawn when the total weight
+   * is zero.
+   */
+  void sample(Weight weight, int location, int number_of_samples, utils::Random* random,
+              std::vector<Person*> &samples) const;
+
+  void add(Person* person) override;
+
+  void remove(Person* person) override;
+
+  [[nodiscard]] std::size_t size() const override;
+
+  void update() override;
+
+  void notify_change(Person* person, const Person::Property &property, const void* old_value,
+                     const void* new_value) override;
+
+private:
+  void add(Person* person, int location);
+
+  void remove(Person* person, int location);
+
+  [[nodiscard]] std::array<double, NUMBER_OF_WEIGHTS> weights_of(const LocationColumns &columns,
+                                                                 std::size_t slot) const;
+
+  void refresh_weights(LocationColumns &columns, std::size_t slot) const;
+
+  std::vector<LocationColumns> columns_by_location_;
+  bool tracking_weights_{false};
+  std::vector<double> moving_level_values_;
+
+  // drawn slots, reused between calls to sample()
+  mutable std::vector<std::size_t> slots_;
+};
+
+#endif /* PERSONSTORE_H */
@@ -0,0 +1,5 @@
+#include "PersonStoreHandler.h"
+
+PersonStoreHandler::PersonStoreHandler() = default;
+
+PersonStoreHandler::~PersonStoreHandler() = default;
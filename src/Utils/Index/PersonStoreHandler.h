@@ -0,0 +1,18 @@
+#ifndef PERSONSTOREHANDLER_H
+#define PERSONSTOREHANDLER_H
+
+#include "Indexer.h"
+
+// Slot of a person inside the columns of its location in PersonStore
+class PersonStoreHandler : public utils::Indexer {
+  // disable copy and assign
+  PersonStoreHandler(const PersonStoreHandler &) = delete;
+  void operator=(const PersonStoreHandler &) = delete;
+
+public:
+  PersonStoreHandler();
+
+  virtual ~PersonStoreHandler();
+};
+
+#endif /* PERSONSTOREHANDLER_H */
@@ -0,0 +1,66 @@
+#include "NormalCdfTable.h"
+
+#include <gsl/gsl_cdf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace {
+// where the table stops, the CDF is below 1e-300 past it so any tolerance is met
+constexpr double MAX_RANGE = 37.0;
+// interior points checked against the exact CDF in every interval
+constexpr int CHECKS_PER_INTERVAL = 8;
+
+double normal_density(double value) {
+  return std::exp(-0.5 * value * value) / std::sqrt(2.0 * std::numbers::pi);
+}
+}  // namespace
+
+namespace utils {
+
+NormalCdfTable::NormalCdfTable(double tolerance) : tolerance_(tolerance) {
+  if (!(tolerance > 0.0 && tolerance < 1.0)) {
+    throw std::invalid_argument("NormalCdfTable tolerance must be in (0, 1).");
+  }
+
+  // symmetric range outside of which the CDF is within half the tolerance of 0 or 1
+  double range = 0.5;
+  while (range < MAX_RANGE && gsl_cdf_ugaussian_P(-range) > 0.5 * tolerance) { range += 0.5; }
+  x_min_ = -range;
+
+  // Hermite error is at most h^4 / 384 * max|CDF''''|, and max|CDF''''| < 0.6; the refinement
+  // below catches the cases where this estimate is too optimistic
+  const auto step = std::pow(384.0 * tolerance / 0.6, 0.25);
+  auto number_of_intervals = static_cast<std::size_t>(std::ceil(2.0 * range / step));
+  build(number_of_intervals);
+  while (max_error_ > tolerance_) {
+    number_of_intervals *= 2;
+    build(number_of_intervals);
+  }
+}
+
+void NormalCdfTable::build(std::size_t number_of_intervals) {
+  step_ = -2.0 * x_min_ / static_cast<double>(number_of_intervals);
+  inverse_step_ = 1.0 / step_;
+  values_.resize(number_of_intervals + 1);
+  slopes_.resize(number_of_intervals + 1);
+  for (std::size_t i = 0; i <= number_of_intervals; i++) {
+    const auto x = x_min_ + (static_cast<double>(i) * step_);
+    values_[i] = gsl_cdf_ugaussian_P(x);
+    slopes_[i] = normal_density(x) * step_;
+  }
+
+  max_error_ = 0.0;
+  for (std::size_t i = 0; i < number_of_intervals; i++) {
+    for (int check = 1; check < CHECKS_PER_INTERVAL; check++) {
+      const auto x =
+          x_min_ + ((static_cast<double>(i) + static_cast<double>(check) / CHECKS_PER_INTERVAL)
+                    * step_);
+      max_error_ = std::max(max_error_, std::abs((*this)(x) - gsl_cdf_ugaussian_P(x)));
+    }
+  }
+}
+
+}  // namespace utils
@@ -0,0 +1,64 @@
+#ifndef NORMALCDFTABLE_H
+#define NORMALCDFTABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class NormalCdfTable
+ * @brief Tabulated standard normal CDF with a guaranteed absolute error bound.
+ *
+ * The CDF is stored on a uniform grid together with its derivative (the normal
+ * density) and evaluated by cubic Hermite interpolation, so the value is exact
+ * at every knot. The grid is refined at build time until the interpolation
+ * error measured between knots is below the requested tolerance; outside the
+ * grid the CDF is within the tolerance of 0 or 1 and returned as such.
+ */
+class NormalCdfTable {
+public:
+  /**
+   * @param tolerance Maximum absolute error, must be in (0, 1).
+   * @throws std::invalid_argument If tolerance is out of range.
+   */
+  explicit NormalCdfTable(double tolerance);
+
+  [[nodiscard]] double operator()(double value) const {
+    if (value <= x_min_) { return 0.0; }
+    if (value >= -x_min_) { return 1.0; }
+    const auto position = (value - x_min_) * inverse_step_;
+    // rounding can put a value just below the last knot into the last position
+    const auto index = std::min(static_cast<std::size_t>(position), values_.size() - 2);
+
+    const auto t = position - static_cast<double>(index);
+    const auto one_minus_t = 1.0 - t;
+    return (one_minus_t * one_minus_t * (((1.0 + 2.0 * t) * values_[index]) + (t * slopes_[index])))
+           + (t * t
+              * (((3.0 - 2.0 * t) * values_[index + 1]) - (one_minus_t * slopes_[index + 1])));
+  }
+
+  [[nodiscard]] double tolerance() const { return tolerance_; }
+
+  // Largest interpolation error found while checking the table against the exact CDF
+  [[nodiscard]] double max_error() const { return max_error_; }
+
+  [[nodiscard]] std::size_t size() const { return values_.size(); }
+
+private:
+  void build(std::size_t number_of_intervals);
+
+  double tolerance_;
+  double max_error_{0.0};
+  double x_min_{0.0};
+  double step_{0.0};
+  double inverse_step_{0.0};
+  std::vector<double> values_;
+  // normal density at each knot multiplied by the grid step
+  std::vector<double> slopes_;
+};
+
+}  // namespace utils
+
+#endif  // NORMALCDFTABLE_H
@@ -1,18 +1,24 @@
 #ifndef OBJECTPOOL_H
 #define OBJECTPOOL_H
-// Provides an object pool that can be used with any class.
+// Pooled allocation of the objects the simulation creates and destroys in bulk.
 //
-// acquireObject() returns an object from the list of free objects. If
-// there are no more free objects, acquireObject() creates a new chunk
-// of objects.
-// The pool only grows: objects are never removed from the pool, until
-// the pool is destroyed.
-// acquireObject() returns an std::shared_ptr with a custom deleter that
-// automatically puts the object back into the object pool when the
-// shared_ptr is destroyed and its reference count reaches 0.
+// OBJECTPOOL(class_name) / OBJECTPOOL_IMPL(class_name) route plain new and
+// delete of a class through utils::SlabAllocator: slots come from 1 MiB slabs
+// that are never released, freed slots are reused by the next object of the
+// same size, and each thread keeps a thread_local cache of free slots so the
+// shared free list is only locked once per batch of allocations. Objects of
+// another size, such as derived test mocks, fall back to the global new.
+//
+// ObjectPool<T> is an explicit pool: acquire_object() constructs an object in
+// a free slot, growing the pool by a chunk when none is left, and returns a
+// std::unique_ptr whose deleter puts the slot back into the pool.
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <mutex>    // For std::mutex and std::lock_guard
+#include <new>
 #include <utility>  // For std::pair
 #include <vector>
 
@@ -64,7 +70,7 @@ public:
 
     // Placement new happens outside the main lock
     try {
-      new (obj_ptr) T(std::forward<Args>(args)...);
+      ::new (obj_ptr) T(std::forward<Args>(args)...);
     } catch (...) {
       // Return object slot to pool if construction fails - lock if needed
       if constexpr (IsThreadSafe) {
@@ -168,4 +174,126 @@ void ObjectPool<T, IsThreadSafe, Allocator>::add_chunk() {
   new_chunk_size_ *= 2;
 }
 
+namespace utils {
+
+/**
+ * @class SlabAllocator
+ * @brief Thread safe fixed size allocator behind the OBJECTPOOL classes.
+ *
+ * Slots are carved out of 1 MiB slabs that are never returned to the system, a freed slot goes
+ * back to a free list and is handed out to the next object of the same size. Each thread keeps
+ * a small cache of free slots so that the parallel individual update only takes the lock once
+ * per CACHE_SIZE / 2 allocations. Pooled classes of the same size and alignment share a pool.
+ */
+template <std::size_t Size, std::size_t Align>
+class SlabAllocator final {
+public:
+  SlabAllocator(const SlabAllocator &) = delete;
+  SlabAllocator &operator=(const SlabAllocator &) = delete;
+  SlabAllocator(SlabAllocator &&) = delete;
+  SlabAllocator &operator=(SlabAllocator &&) = delete;
+
+  // Never destroyed: pooled objects owned by static objects may be deleted during exit
+  static SlabAllocator &instance() {
+    static auto* allocator = new SlabAllocator();
+    return *allocator;
+  }
+
+  void* allocate() {
+    auto &cache = local_cache();
+    if (cache.count == 0) { refill(cache); }
+    return cache.slots[--cache.count];
+  }
+
+  void deallocate(void* slot) noexcept {
+    auto &cache = local_cache();
+    if (cache.count == CACHE_SIZE) { flush(cache); }
+    cache.slots[cache.count++] = slot;
+  }
+
+  // Number of slots carved out of the slabs so far, in use or free
+  [[nodiscard]] std::size_t capacity() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+private:
+  static constexpr std::size_t SLOT_SIZE = (Size + Align - 1) / Align * Align;
+  static constexpr std::size_t SLAB_BYTES = 1 << 20;
+  static constexpr std::size_t SLOTS_PER_SLAB = std::max<std::size_t>(SLAB_BYTES / SLOT_SIZE, 1);
+  static constexpr std::size_t CACHE_SIZE = 64;
+
+  // Trivially destructible so it is still usable while the thread exits, the slots left in the
+  // cache of a finished thread are lost
+  struct Cache {
+    std::array<void*, CACHE_SIZE> slots;
+    std::size_t count;
+  };
+
+  SlabAllocator() = default;
+
+  static Cache &local_cache() {
+    thread_local Cache cache{};
+    return cache;
+  }
+
+  void refill(Cache &cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_slots_.empty()) { add_slab(); }
+    const auto count = std::min(CACHE_SIZE / 2, free_slots_.size());
+    std::copy(free_slots_.end() - static_cast<std::ptrdiff_t>(count), free_slots_.end(),
+              cache.slots.begin() + static_cast<std::ptrdiff_t>(cache.count));
+    free_slots_.resize(free_slots_.size() - count);
+    cache.count += count;
+  }
+
+  void flush(Cache &cache) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // free_slots_ holds capacity_ pointers at most, reserved by add_slab, so this never allocates
+    const auto count = CACHE_SIZE / 2;
+    cache.count -= count;
+    free_slots_.insert(free_slots_.end(),
+                       cache.slots.begin() + static_cast<std::ptrdiff_t>(cache.count),
+                       cache.slots.begin() + static_cast<std::ptrdiff_t>(cache.count + count));
+  }
+
+  void add_slab() {
+    auto* slab = static_cast<std::byte*>(
+        ::operator new(SLOT_SIZE * SLOTS_PER_SLAB, std::align_val_t{Align}));
+    capacity_ += SLOTS_PER_SLAB;
+    free_slots_.reserve(capacity_);
+    // hand out the slots in address order
+    for (auto i = SLOTS_PER_SLAB; i > 0; i--) { free_slots_.push_back(slab + (i - 1) * SLOT_SIZE); }
+  }
+
+  std::mutex mutex_;
+  std::vector<void*> free_slots_;
+  std::size_t capacity_{0};
+};
+
+}  // namespace utils
+
+// Routes new and delete of a class through utils::SlabAllocator. Put OBJECTPOOL(class_name) in
+// the public section of the class and OBJECTPOOL_IMPL(class_name) in its source file. Derived
+// classes of another size (test mocks) fall back to the global operator new.
+#define OBJECTPOOL(class_name)                 \
+  static void* operator new(std::size_t size); \
+  static void operator delete(void* ptr, std::size_t size) noexcept;
+
+#define OBJECTPOOL_IMPL(class_name)                                                        \
+  void* class_name::operator new(std::size_t size) {                                       \
+    if (size != sizeof(class_name)) { return ::operator new(size); }                       \
+    return utils::SlabAllocator<sizeof(class_name), alignof(class_name)>::instance()       \
+        .allocate();                                                                       \
+  }                                                                                        \
+  void class_name::operator delete(void* ptr, std::size_t size) noexcept {                 \
+    if (ptr == nullptr) { return; }                                                        \
+    if (size != sizeof(class_name)) {                                                      \
+      ::operator delete(ptr);                                                              \
+      return;                                                                              \
+    }                                                                                      \
+    utils::SlabAllocator<sizeof(class_name), alignof(class_name)>::instance().deallocate( \
+        ptr);                                                                              \
+  }
+
 #endif /* //OBJECTPOOL_H */
@@ -0,0 +1,132 @@
+#include "Philox.h"
+
+#include <stdexcept>
+
+namespace {
+constexpr uint32_t PHILOX_M0 = 0xD2511F53U;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57U;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9U;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85U;
+constexpr int PHILOX_ROUNDS = 10;
+// number of blocks generated side by side by fill_uniform, 8 x 32-bit lanes fill an AVX2 register
+constexpr int PHILOX_LANES = 8;
+constexpr double PHILOX_TO_DOUBLE = 1.0 / 4294967296.0;
+
+struct PhiloxState {
+  utils::Philox4x32::Key key;
+  utils::Philox4x32::Counter counter;
+  utils::Philox4x32::Counter block;
+  // index of the next unused output in block, 4 means the block is used up
+  int position;
+};
+
+void philox_set(void* vstate, unsigned long seed) {
+  auto* state = static_cast<PhiloxState*>(vstate);
+  const auto seed64 = static_cast<uint64_t>(seed);
+  state->key = {static_cast<uint32_t>(seed64), static_cast<uint32_t>(seed64 >> 32)};
+  state->counter = {0, 0, 0, 0};
+  state->position = 4;
+}
+
+unsigned long philox_get(void* vstate) {
+  auto* state = static_cast<PhiloxState*>(vstate);
+  if (state->position == 4) {
+    state->block = utils::Philox4x32::generate(state->counter, state->key);
+    state->position = 0;
+    // advance the 64-bit block index, the stream id in counter[2..3] stays fixed
+    if (++state->counter[0] == 0) { ++state->counter[1]; }
+  }
+  return state->block[state->position++];
+}
+
+double philox_get_double(void* vstate) {
+  return static_cast<double>(philox_get(vstate)) * PHILOX_TO_DOUBLE;
+}
+
+const gsl_rng_type PHILOX_TYPE = {"philox4x32", 0xffffffffUL, 0, sizeof(PhiloxState), &philox_set,
+                                  &philox_get, &philox_get_double};
+}  // namespace
+
+namespace utils {
+
+Philox4x32::Counter Philox4x32::generate(Counter counter, Key key) noexcept {
+  for (int round = 0; round < PHILOX_ROUNDS; round++) {
+    const auto product0 = static_cast<uint64_t>(PHILOX_M0) * counter[0];
+    const auto product1 = static_cast<uint64_t>(PHILOX_M1) * counter[2];
+    counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+               static_cast<uint32_t>(product1),
+               static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+               static_cast<uint32_t>(product0)};
+    key[0] += PHILOX_W0;
+    key[1] += PHILOX_W1;
+  }
+  return counter;
+}
+
+const gsl_rng_type* Philox4x32::gsl_type() noexcept { return &PHILOX_TYPE; }
+
+bool Philox4x32::is_philox(const gsl_rng* rng) noexcept {
+  return rng != nullptr && rng->type == &PHILOX_TYPE;
+}
+
+void Philox4x32::set_stream(gsl_rng* rng, uint64_t stream_id) {
+  if (!is_philox(rng)) { throw std::invalid_argument("Streams are only supported by Philox."); }
+  auto* state = static_cast<PhiloxState*>(rng->state);
+  state->counter = {0, 0, static_cast<uint32_t>(stream_id),
+                    static_cast<uint32_t>(stream_id >> 32)};
+  state->position = 4;
+}
+
+void Philox4x32::fill_uniform(gsl_rng* rng, std::span<double> values) {
+  if (!is_philox(rng)) { throw std::invalid_argument("fill_uniform requires a Philox generator."); }
+  auto* state = static_cast<PhiloxState*>(rng->state);
+  std::size_t index = 0;
+
+  // finish the block left over by previous draws
+  while (state->position < 4 && index < values.size()) {
+    values[index++] = static_cast<double>(state->block[state->position++]) * PHILOX_TO_DOUBLE;
+  }
+
+  // structure of arrays over PHILOX_LANES consecutive counters, each lane is one block
+  std::array<uint32_t, PHILOX_LANES> c0{}, c1{}, c2{}, c3{};
+  while (values.size() - index >= 4 * PHILOX_LANES) {
+    auto block_index = (static_cast<uint64_t>(state->counter[1]) << 32) | state->counter[0];
+    for (int lane = 0; lane < PHILOX_LANES; lane++, block_index++) {
+      c0[lane] = static_cast<uint32_t>(block_index);
+      c1[lane] = static_cast<uint32_t>(block_index >> 32);
+      c2[lane] = state->counter[2];
+      c3[lane] = state->counter[3];
+    }
+    state->counter[0] = static_cast<uint32_t>(block_index);
+    state->counter[1] = static_cast<uint32_t>(block_index >> 32);
+
+    auto key = state->key;
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+      for (int lane = 0; lane < PHILOX_LANES; lane++) {
+        const auto product0 = static_cast<uint64_t>(PHILOX_M0) * c0[lane];
+        const auto product1 = static_cast<uint64_t>(PHILOX_M1) * c2[lane];
+        c0[lane] = static_cast<uint32_t>(product1 >> 32) ^ c1[lane] ^ key[0];
+        c2[lane] = static_cast<uint32_t>(product0 >> 32) ^ c3[lane] ^ key[1];
+        c1[lane] = static_cast<uint32_t>(product1);
+        c3[lane] = static_cast<uint32_t>(product0);
+      }
+      key[0] += PHILOX_W0;
+      key[1] += PHILOX_W1;
+    }
+
+    for (int lane = 0; lane < PHILOX_LANES; lane++) {
+      values[index + 4 * lane] = static_cast<double>(c0[lane]) * PHILOX_TO_DOUBLE;
+      values[index + 4 * lane + 1] = static_cast<double>(c1[lane]) * PHILOX_TO_DOUBLE;
+      values[index + 4 * lane + 2] = static_cast<double>(c2[lane]) * PHILOX_TO_DOUBLE;
+      values[index + 4 * lane + 3] = static_cast<double>(c3[lane]) * PHILOX_TO_DOUBLE;
+    }
+    index += 4 * PHILOX_LANES;
+  }
+
+  // tail, one block at a time through the generator state
+  for (; index < values.size(); index++) {
+    values[index] = philox_get_double(state);
+  }
+}
+
+}  // namespace utils
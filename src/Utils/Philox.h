@@ -0,0 +1,51 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <gsl/gsl_rng.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace utils {
+
+/**
+ * @class Philox4x32
+ * @brief Counter-based Philox4x32-10 generator (Salmon et al., SC'11).
+ *
+ * A block of four 32-bit outputs is a pure function of a 64-bit key and a
+ * 128-bit counter, so any position of any stream can be produced without
+ * stepping through the ones before it. The low half of the counter is the
+ * block index inside a stream and the high half is the stream id; streams
+ * sharing a key never overlap.
+ *
+ * The generator is exposed to GSL as a gsl_rng_type so that every gsl_ran_*
+ * distribution works on it unchanged.
+ */
+class Philox4x32 {
+public:
+  using Counter = std::array<uint32_t, 4>;
+  using Key = std::array<uint32_t, 2>;
+
+  // One block of 10 Philox rounds
+  [[nodiscard]] static Counter generate(Counter counter, Key key) noexcept;
+
+  // GSL generator type, the seed passed to gsl_rng_set becomes the key and resets the stream to 0
+  [[nodiscard]] static const gsl_rng_type* gsl_type() noexcept;
+
+  // Moves a Philox gsl_rng to the first draw of the given stream, keeping its key
+  static void set_stream(gsl_rng* rng, uint64_t stream_id);
+
+  [[nodiscard]] static bool is_philox(const gsl_rng* rng) noexcept;
+
+  /**
+   * Fills values with uniform doubles in [0, 1), exactly the numbers repeated
+   * gsl_rng_uniform calls on rng would return. Whole blocks are generated
+   * several counters at a time in a loop the compiler vectorizes.
+   */
+  static void fill_uniform(gsl_rng* rng, std::span<double> values);
+};
+
+}  // namespace utils
+
+#endif  // PHILOX_H
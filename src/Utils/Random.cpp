@@ -5,6 +5,9 @@
  */
 #include "Random.h"
 
+#include "CheckpointArchive.h"
+#include "Philox.h"
+
 #include <fmt/format.h>
 #include <gsl/gsl_cdf.h>
 #include <gsl/gsl_randist.h>
@@ -12,6 +15,7 @@
 #include <cmath>  // Ensure cmath is included for std::round
 #include <cstddef>
 #include <cstdint>
+#include <numbers>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -23,15 +27,22 @@ Random::Random(gsl_rng* rng, uint64_t seed) : seed_(seed) {
   if (rng != nullptr) {
     // If an external RNG is provided, take ownership using the unique_ptr
     rng_.reset(rng);
+    if (Philox4x32::is_philox(rng)) { generator_ = Generator::PHILOX4X32; }
   } else {
     // Initialize with default seed
     initialize(seed);
   }
 }
 
+Random::Random(Generator generator, uint64_t seed, uint64_t stream_id)
+    : seed_(seed), generator_(generator), stream_id_(stream_id) {
+  initialize(seed);
+}
+
 void Random::initialize(uint64_t initial_seed) {
-  // Select the Mersenne Twister 19937 generator
-  const gsl_rng_type* rng_type = gsl_rng_mt19937;
+  // Mersenne Twister 19937 unless the counter-based generator is requested
+  const gsl_rng_type* rng_type =
+      generator_ == Generator::PHILOX4X32 ? Philox4x32::gsl_type() : gsl_rng_mt19937;
 
   // Allocate the GSL RNG and assign it to the unique_ptr
   rng_.reset(gsl_rng_alloc(rng_type));
@@ -43,6 +54,7 @@ void Random::initialize(uint64_t initial_seed) {
 
   // Set the seed for the GSL RNG
   gsl_rng_set(rng_.get(), seed_);
+  if (generator_ == Generator::PHILOX4X32) { Philox4x32::set_stream(rng_.get(), stream_id_); }
 }
 
 // Getter for seed
@@ -60,6 +72,58 @@ void Random::set_seed(uint64_t new_seed) {
 
   // Otherwise, just reseed the existing generator
   gsl_rng_set(rng_.get(), seed_);
+  // reseeding a Philox generator restarts its own stream rather than stream 0
+  if (generator_ == Generator::PHILOX4X32) { Philox4x32::set_stream(rng_.get(), stream_id_); }
+}
+
+void Random::checkpoint(CheckpointArchive &archive) {
+  if (!rng_) { throw std::runtime_error("Random number generator not initialized."); }
+  auto generator = generator_;
+  auto state_size = static_cast<uint64_t>(gsl_rng_size(rng_.get()));
+  archive & generator & state_size;
+  if (generator != generator_ || state_size != gsl_rng_size(rng_.get())) {
+    throw std::runtime_error("Checkpoint holds the state of another random number generator.");
+  }
+  archive & seed_ & stream_id_;
+  archive.bytes(gsl_rng_state(rng_.get()), state_size);
+}
+
+uint64_t Random::derive_seed(uint64_t master_seed, uint64_t stream_id) noexcept {
+  // splitmix64 over the master seed offset by the stream id
+  uint64_t z = master_seed + (stream_id + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+std::unique_ptr<Random> Random::split(uint64_t stream_id) const {
+  return std::make_unique<Random>(Generator::PHILOX4X32, derive_seed(seed_, stream_id_),
+                                  stream_id);
+}
+
+namespace {
+uint64_t substream_id(int location, int day) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(location)) << 32)
+         | static_cast<uint32_t>(day);
+}
+}  // namespace
+
+std::unique_ptr<Random> Random::substream(int location, int day) const {
+  return split(substream_id(location, day));
+}
+
+void Random::reset_split(Random &target, uint64_t stream_id) const {
+  if (target.generator_ != Generator::PHILOX4X32) {
+    throw std::invalid_argument("Only a Philox generator can be reset to a split stream.");
+  }
+  const auto seed = derive_seed(seed_, stream_id_);
+  // the stream must be in place before set_seed restarts it
+  target.stream_id_ = stream_id;
+  target.set_seed(seed);
+}
+
+void Random::reset_substream(Random &target, int location, int day) const {
+  reset_split(target, substream_id(location, day));
 }
 
 // Generates a Poisson-distributed random number
@@ -80,6 +144,44 @@ double Random::random_uniform() {
   return gsl_rng_uniform(rng_.get());
 }
 
+void Random::fill_uniform(std::span<double> values) {
+  if (!rng_) { throw std::runtime_error("Random number generator not initialized."); }
+  if (generator_ == Generator::PHILOX4X32) {
+    Philox4x32::fill_uniform(rng_.get(), values);
+    return;
+  }
+  for (auto &value : values) { value = gsl_rng_uniform(rng_.get()); }
+}
+
+void Random::fill_normal(std::span<double> values, double mean, double standard_deviation) {
+  if (standard_deviation <= 0) {
+    throw std::invalid_argument("Parameters 'standard_deviation' must be greater than 0.");
+  }
+  fill_uniform(values);
+
+  // Box-Muller on pairs (u1, u2) stored in place, 1 - u1 keeps the log argument in (0, 1]
+  const auto pairs = values.size() / 2;
+  for (std::size_t i = 0; i < pairs; i++) {
+    const auto radius = standard_deviation * std::sqrt(-2.0 * std::log(1.0 - values[2 * i]));
+    const auto angle = 2.0 * std::numbers::pi * values[(2 * i) + 1];
+    values[2 * i] = mean + (radius * std::cos(angle));
+    values[(2 * i) + 1] = mean + (radius * std::sin(angle));
+  }
+  if (values.size() % 2 == 1) {
+    values.back() = mean + gsl_ran_gaussian(rng_.get(), standard_deviation);
+  }
+}
+
+void Random::fill_poisson(std::span<const double> means, std::span<int> results) {
+  if (!rng_) { throw std::runtime_error("Random number generator not initialized."); }
+  if (means.size() != results.size()) {
+    throw std::invalid_argument("Size of 'means' and 'results' must match.");
+  }
+  for (std::size_t i = 0; i < means.size(); i++) {
+    results[i] = means[i] > 0 ? static_cast<int>(gsl_ran_poisson(rng_.get(), means[i])) : 0;
+  }
+}
+
 // Generates a Beta-distributed random double
 double Random::random_beta(double alpha, double beta) {
   if (!rng_) { throw std::runtime_error("Random number generator not initialized."); }
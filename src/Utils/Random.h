@@ -11,9 +11,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace utils {
+class CheckpointArchive;
+
 /**
  * @class Random
  * @brief Encapsulates random number generation functionalities using GSL.
@@ -22,9 +25,15 @@ namespace utils {
  * following different distributions. It manages a GSL random number generator
  * (RNG) instance, ensuring proper resource management and offering a clean
  * interface for simulations.
+ *
+ * Besides the default Mersenne Twister, a Random can run on the counter-based
+ * Philox4x32-10 generator. Philox streams are cheap to create and are fully
+ * determined by (seed, stream id), see split() and substream().
  */
 class Random {
 public:
+  enum class Generator { MT19937, PHILOX4X32 };
+
   // Delete copy constructor and copy assignment operator
   Random(const Random &) = delete;
   Random &operator=(const Random &) = delete;
@@ -43,6 +52,15 @@ public:
    */
   explicit Random(gsl_rng* external_rng = nullptr, uint64_t seed = static_cast<uint64_t>(-1));
 
+  /**
+   * @brief Constructs a Random number generator on the given generator type.
+   *
+   * @param generator Underlying GSL generator.
+   * @param seed Seed value, UINT64_MAX (cast from -1) draws one from std::random_device.
+   * @param stream_id Stream of a Philox generator, ignored by MT19937.
+   */
+  explicit Random(Generator generator, uint64_t seed = static_cast<uint64_t>(-1),
+                  uint64_t stream_id = 0);
 
   /**
    * @brief Destructor.
@@ -65,6 +83,67 @@ public:
    */
   void set_seed(uint64_t new_seed);
 
+  /**
+   * @brief Derives a well-mixed seed for an independent stream from a master seed.
+   *
+   * Uses the splitmix64 finalizer so that consecutive stream ids (e.g. location
+   * indices) give statistically unrelated seeds. The result depends only on the
+   * inputs, which keeps per-stream draws reproducible for a given master seed.
+   *
+   * @param master_seed Seed of the parent generator.
+   * @param stream_id Identifier of the derived stream.
+   * @return uint64_t Seed for the derived stream.
+   */
+  [[nodiscard]] static uint64_t derive_seed(uint64_t master_seed, uint64_t stream_id) noexcept;
+
+  [[nodiscard]] Generator get_generator() const noexcept { return generator_; }
+
+  [[nodiscard]] uint64_t get_stream_id() const noexcept { return stream_id_; }
+
+  /**
+   * @brief Creates an independent Philox stream from this generator.
+   *
+   * The child is keyed by derive_seed(get_seed(), get_stream_id()) and uses
+   * stream_id as its counter stream, so it depends only on this generator's
+   * seed and stream, not on how many numbers were drawn from it. Splitting
+   * never advances this generator and is safe to call from several threads.
+   *
+   * @param stream_id Identifier of the child stream.
+   * @return std::unique_ptr<Random> A new Philox generator.
+   */
+  [[nodiscard]] std::unique_ptr<Random> split(uint64_t stream_id) const;
+
+  /**
+   * @brief Creates the stream of one location on one simulation day.
+   *
+   * Same as split() with the location in the high and the day in the low
+   * 32 bits of the stream id.
+   */
+  [[nodiscard]] std::unique_ptr<Random> substream(int location, int day) const;
+
+  /**
+   * @brief Reseeds @target in place to the stream split() would create.
+   *
+   * Draws the same numbers as a fresh split(stream_id) without allocating a
+   * generator, so long-lived per-location generators can be reused every day.
+   *
+   * @throws std::invalid_argument If @target is not a Philox generator.
+   */
+  void reset_split(Random &target, uint64_t stream_id) const;
+
+  // reset_split() on the stream substream(location, day) would create
+  void reset_substream(Random &target, int location, int day) const;
+
+  /**
+   * @brief Saves or restores the seed, the stream and the raw generator state.
+   *
+   * A restored generator continues with the exact numbers the saved one would
+   * have drawn next.
+   *
+   * @throws std::runtime_error If the archive holds the state of another generator type.
+   */
+  void checkpoint(CheckpointArchive &archive);
+
   // Random number generation methods
 
   /**
@@ -96,6 +175,46 @@ public:
    */
   virtual double random_uniform();
 
+  /**
+   * @brief Fills a buffer with uniform random doubles in [0, 1).
+   *
+   * One call replaces values.size() calls to random_uniform() and yields the
+   * same numbers. On the Philox generator whole blocks are produced by a
+   * vectorized kernel, otherwise the generator is called in a tight loop.
+   *
+   * @param values Buffer to fill.
+   *
+   * @throws std::runtime_error If RNG is not initialized.
+   */
+  void fill_uniform(std::span<double> values);
+
+  /**
+   * @brief Fills a buffer with normally distributed random doubles.
+   *
+   * Uses the Box-Muller transform over a batch of uniforms, so the numbers
+   * differ from successive random_normal() calls but follow the same
+   * distribution.
+   *
+   * @param values Buffer to fill.
+   * @param mean The mean of the normal distribution.
+   * @param standard_deviation The standard deviation of the normal distribution.
+   *
+   * @throws std::runtime_error If RNG is not initialized.
+   * @throws std::invalid_argument If standard_deviation <= 0.
+   */
+  void fill_normal(std::span<double> values, double mean, double standard_deviation);
+
+  /**
+   * @brief Draws one Poisson-distributed number per mean.
+   *
+   * @param means Poisson means, non-positive means give 0.
+   * @param results Output buffer, must have the same size as means.
+   *
+   * @throws std::runtime_error If RNG is not initialized.
+   * @throws std::invalid_argument If the sizes of means and results differ.
+   */
+  void fill_poisson(std::span<const double> means, std::span<int> results);
+
   /**
    * @brief Generates a uniformly distributed random number within a specified
    * range.
@@ -318,6 +437,8 @@ public:
 
 private:
   uint64_t seed_;
+  Generator generator_{Generator::MT19937};
+  uint64_t stream_id_{0};
 
   // Custom deleter for gsl_rng
   struct GslRngDeleter {
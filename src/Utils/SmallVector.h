@@ -0,0 +1,134 @@
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace utils {
+
+/**
+ * @class SmallVector
+ * @brief Vector that keeps its first N elements inline and only allocates past them.
+ *
+ * Meant for the handful of objects a person owns (drugs in the blood, parasite clones), where a
+ * std::vector or a node container would allocate for every person and scatter the elements
+ * across the heap. Elements are contiguous either way, iterators are plain pointers and are
+ * invalidated by any insertion or removal. The container owns its elements in place, so it is
+ * neither copyable nor movable; elements must be nothrow move constructible.
+ */
+template <typename T, std::size_t N>
+class SmallVector final {
+  static_assert(N > 0, "SmallVector needs an inline capacity");
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "SmallVector elements must be nothrow move constructible");
+
+public:
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  SmallVector() = default;
+  SmallVector(const SmallVector &) = delete;
+  SmallVector &operator=(const SmallVector &) = delete;
+  SmallVector(SmallVector &&) = delete;
+  SmallVector &operator=(SmallVector &&) = delete;
+
+  ~SmallVector() {
+    clear();
+    if (!is_inline()) { std::allocator<T>().deallocate(data_, capacity_); }
+  }
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+  const_iterator cbegin() const { return data_; }
+  const_iterator cend() const { return data_ + size_; }
+
+  T &operator[](std::size_t index) { return data_[index]; }
+  const T &operator[](std::size_t index) const { return data_[index]; }
+  T &back() { return data_[size_ - 1]; }
+  const T &back() const { return data_[size_ - 1]; }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+  // True while the elements still live in the inline buffer
+  [[nodiscard]] bool is_inline() const { return data_ == inline_data(); }
+
+  void reserve(std::size_t capacity) {
+    if (capacity > capacity_) { grow(capacity); }
+  }
+
+  template <typename... Args>
+  T &emplace_back(Args &&... args) {
+    if (size_ == capacity_) { grow(capacity_ * 2); }
+    auto* element = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *element;
+  }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  // Insert before @position, returns the inserted element
+  iterator insert(const_iterator position, T &&value) {
+    const auto index = static_cast<std::size_t>(position - data_);
+    if (index == size_) { return &emplace_back(std::move(value)); }
+    if (size_ == capacity_) { grow(capacity_ * 2); }
+    std::construct_at(data_ + size_, std::move(data_[size_ - 1]));
+    std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+    ++size_;
+    data_[index] = std::move(value);
+    return data_ + index;
+  }
+
+  // Remove [first, last) keeping the order of the remaining elements, returns the element that
+  // follows the removed ones
+  iterator erase(const_iterator first, const_iterator last) {
+    auto* begin_removed = data_ + (first - data_);
+    auto* end_removed = data_ + (last - data_);
+    if (begin_removed == end_removed) { return begin_removed; }
+    auto* new_end = std::move(end_removed, end(), begin_removed);
+    std::destroy(new_end, end());
+    size_ = static_cast<std::size_t>(new_end - data_);
+    return begin_removed;
+  }
+
+  iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+  void pop_back() {
+    --size_;
+    std::destroy_at(data_ + size_);
+  }
+
+  // Destroy the elements, the allocated capacity is kept
+  void clear() {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+private:
+  T* inline_data() { return reinterpret_cast<T*>(inline_buffer_); }
+  const T* inline_data() const { return reinterpret_cast<const T*>(inline_buffer_); }
+
+  void grow(std::size_t capacity) {
+    auto* data = std::allocator<T>().allocate(capacity);
+    std::uninitialized_move(begin(), end(), data);
+    std::destroy(begin(), end());
+    if (!is_inline()) { std::allocator<T>().deallocate(data_, capacity_); }
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  alignas(T) std::byte inline_buffer_[N * sizeof(T)];
+  T* data_{inline_data()};
+  std::size_t size_{0};
+  std::size_t capacity_{N};
+};
+
+}  // namespace utils
+
+#endif  // SMALLVECTOR_H
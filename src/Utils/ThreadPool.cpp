@@ -0,0 +1,93 @@
+#include "ThreadPool.h"
+
+#include <stdexcept>
+
+using utils::ThreadPool;
+
+ThreadPool::ThreadPool(std::size_t number_of_threads) {
+  if (number_of_threads == 0) {
+    throw std::invalid_argument("ThreadPool requires at least one thread.");
+  }
+  workers_.reserve(number_of_threads - 1);
+  for (std::size_t i = 1; i < number_of_threads; ++i) {
+    workers_.emplace_back([this] { worker_loop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  job_ready_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) { worker.join(); }
+  }
+}
+
+void ThreadPool::parallel_for(int begin, int end, const std::function<void(int)> &task) {
+  if (begin >= end) { return; }
+
+  if (workers_.empty()) {
+    for (auto i = begin; i < end; ++i) { task(i); }
+    return;
+  }
+
+  {
+    std::lock_guard lock(mutex_);
+    task_ = &task;
+    next_index_.store(begin);
+    end_index_ = end;
+    first_exception_ = nullptr;
+    failed_.store(false);
+    busy_workers_ = workers_.size();
+    ++job_generation_;
+  }
+  job_ready_.notify_all();
+
+  run_current_job();
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock lock(mutex_);
+    job_done_.wait(lock, [this] { return busy_workers_ == 0; });
+    task_ = nullptr;
+    exception = first_exception_;
+    first_exception_ = nullptr;
+  }
+  if (exception) { std::rethrow_exception(exception); }
+}
+
+void ThreadPool::worker_loop() {
+  std::size_t seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock lock(mutex_);
+      job_ready_.wait(lock, [&] { return stopping_ || job_generation_ != seen_generation; });
+      if (stopping_) { return; }
+      seen_generation = job_generation_;
+    }
+
+    run_current_job();
+
+    {
+      std::lock_guard lock(mutex_);
+      --busy_workers_;
+    }
+    job_done_.notify_one();
+  }
+}
+
+void ThreadPool::run_current_job() {
+  while (!failed_.load(std::memory_order_relaxed)) {
+    const auto index = next_index_.fetch_add(1);
+    if (index >= end_index_) { return; }
+    try {
+      (*task_)(index);
+    } catch (...) {
+      std::lock_guard lock(mutex_);
+      if (!first_exception_) { first_exception_ = std::current_exception(); }
+      failed_.store(true);
+    }
+  }
+}
@@ -0,0 +1,82 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils {
+/**
+ * @class ThreadPool
+ * @brief A small fixed-size pool of worker threads for data-parallel loops.
+ *
+ * The workers are created once and sleep between jobs, so the pool can be
+ * reused every simulation day without paying the thread start-up cost. The
+ * calling thread takes part in the work, i.e. a pool of size N runs N - 1
+ * background workers.
+ */
+class ThreadPool {
+public:
+  // Disallow copy
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Disallow move
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  /**
+   * @brief Constructs a pool with the given number of threads.
+   *
+   * @param number_of_threads Total number of threads including the caller, must be positive.
+   */
+  explicit ThreadPool(std::size_t number_of_threads);
+
+  ~ThreadPool();
+
+  /**
+   * @brief Returns the number of threads taking part in a parallel_for.
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return workers_.size() + 1; }
+
+  /**
+   * @brief Runs task(i) for every i in [begin, end) and blocks until all of them are done.
+   *
+   * Indices are handed out one at a time, which balances uneven work (e.g. locations of
+   * very different population sizes). If any task throws, the remaining indices are
+   * skipped and the first exception is rethrown on the calling thread.
+   *
+   * @param begin First index.
+   * @param end One past the last index.
+   * @param task Callable invoked once per index.
+   */
+  void parallel_for(int begin, int end, const std::function<void(int)> &task);
+
+private:
+  void worker_loop();
+  void run_current_job();
+
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+
+  const std::function<void(int)>* task_{nullptr};
+  std::atomic<int> next_index_{0};
+  int end_index_{0};
+  std::size_t job_generation_{0};
+  std::size_t busy_workers_{0};
+  bool stopping_{false};
+
+  std::exception_ptr first_exception_{nullptr};
+  std::atomic<bool> failed_{false};
+};
+}  // namespace utils
+
+#endif  // THREADPOOL_H
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "Configuration/Config.h"
+
+TEST(HotParametersTest, SettersRebuildTheSnapshot) {
+  Config config;
+
+  ImmuneSystemParameters immune_system_parameters;
+  immune_system_parameters.c_max = 0.9;
+  immune_system_parameters.decay_rate = 0.0025;
+  immune_system_parameters.acquire_rate_by_age = {0.1, 0.2, 0.3};
+  config.set_immune_system_parameters(immune_system_parameters);
+
+  ParasiteParameters parasite_parameters;
+  auto density_levels = parasite_parameters.get_parasite_density_levels();
+  density_levels.set_log_parasite_density_asymptomatic(3.0);
+  parasite_parameters.set_parasite_density_levels(density_levels);
+  config.set_parasite_parameters(parasite_parameters);
+
+  EpidemiologicalParameters epidemiological_parameters;
+  epidemiological_parameters.set_p_relapse(0.01);
+  config.set_epidemiological_parameters(epidemiological_parameters);
+
+  const auto &hot = config.hot_parameters();
+  EXPECT_DOUBLE_EQ(hot.c_max, 0.9);
+  EXPECT_DOUBLE_EQ(hot.decay_rate, 0.0025);
+  EXPECT_DOUBLE_EQ(hot.acquire_rate_by_age[2], 0.3);
+  EXPECT_DOUBLE_EQ(hot.acquire_rate_by_age[3], 0.0);
+  EXPECT_DOUBLE_EQ(hot.log_parasite_density_asymptomatic, 3.0);
+  EXPECT_DOUBLE_EQ(hot.p_relapse, 0.01);
+}
+
+TEST(HotParametersTest, RebuildPicksUpChangesThroughNonConstGetters) {
+  Config config;
+  EXPECT_DOUBLE_EQ(config.hot_parameters().mutation_probability_per_locus, 0.001);
+
+  config.get_genotype_parameters().set_mutation_probability_per_locus(0.0);
+  EXPECT_DOUBLE_EQ(config.hot_parameters().mutation_probability_per_locus, 0.001);
+
+  config.rebuild_hot_parameters();
+  EXPECT_DOUBLE_EQ(config.hot_parameters().mutation_probability_per_locus, 0.0);
+}
@@ -118,6 +118,13 @@ TEST_F(EpidemiologicalParametersYAMLTest, DecodeEpidemiologicalParameters) {
     EXPECT_EQ(decoded_parameters.get_p_compliance(), 0.9);
     EXPECT_EQ(decoded_parameters.get_relative_biting_info().get_max_relative_biting_value(), 10);
     EXPECT_EQ(decoded_parameters.get_relative_infectivity().get_sigma(), 1.2);
+    // cdf_table_tolerance is optional and defaults to the exact CDF
+    EXPECT_EQ(decoded_parameters.get_relative_infectivity().get_cdf_table(), nullptr);
+
+    node["relative_infectivity"]["cdf_table_tolerance"] = 1.0e-6;
+    EXPECT_NO_THROW(YAML::convert<EpidemiologicalParameters>::decode(node, decoded_parameters));
+    ASSERT_NE(decoded_parameters.get_relative_infectivity().get_cdf_table(), nullptr);
+    EXPECT_EQ(decoded_parameters.get_relative_infectivity().get_cdf_table()->tolerance(), 1.0e-6);
 }
 
 // Test for decoding with missing fields
@@ -29,6 +29,9 @@ TEST_F(ModelSettingsTest, EncodeModelSettings) {
   default_settings.get_record_genome_db());
   EXPECT_EQ(node["cell_level_reporting"].as<bool>(),
             default_settings.get_cell_level_reporting());
+  EXPECT_EQ(node["number_of_threads"].as<int>(), default_settings.get_number_of_threads());
+  EXPECT_EQ(node["incremental_force_of_infection"].as<bool>(),
+            default_settings.get_incremental_force_of_infection());
 }
 
 // Test decoding functionality
@@ -46,6 +49,62 @@ TEST_F(ModelSettingsTest, DecodeModelSettings) {
   EXPECT_EQ(decoded_settings.get_initial_seed_number(), 123);
   EXPECT_EQ(decoded_settings.get_record_genome_db(), true);
   EXPECT_EQ(decoded_settings.get_cell_level_reporting(), true);
+  // number_of_threads is optional and defaults to serial
+  EXPECT_EQ(decoded_settings.get_number_of_threads(), 1);
+  EXPECT_FALSE(decoded_settings.get_incremental_force_of_infection());
+}
+
+// Test decoding of the optional number_of_threads field
+TEST_F(ModelSettingsTest, DecodeModelSettingsNumberOfThreads) {
+  YAML::Node node;
+  node["days_between_stdout_output"] = 10;
+  node["initial_seed_number"] = 123;
+  node["record_genome_db"] = true;
+  node["cell_level_reporting"] = true;
+  node["number_of_threads"] = 4;
+
+  ModelSettings decoded_settings;
+  EXPECT_NO_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings));
+  EXPECT_EQ(decoded_settings.get_number_of_threads(), 4);
+
+  node["number_of_threads"] = 0;
+  EXPECT_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings),
+               std::invalid_argument);
+}
+
+// Test decoding of the optional incremental_force_of_infection field
+TEST_F(ModelSettingsTest, DecodeModelSettingsIncrementalForceOfInfection) {
+  YAML::Node node;
+  node["days_between_stdout_output"] = 10;
+  node["initial_seed_number"] = 123;
+  node["record_genome_db"] = true;
+  node["cell_level_reporting"] = true;
+  node["incremental_force_of_infection"] = true;
+
+  ModelSettings decoded_settings;
+  EXPECT_NO_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings));
+  EXPECT_TRUE(decoded_settings.get_incremental_force_of_infection());
+}
+
+// Test decoding of the optional random_generator field
+TEST_F(ModelSettingsTest, DecodeModelSettingsRandomGenerator) {
+  YAML::Node node;
+  node["days_between_stdout_output"] = 10;
+  node["initial_seed_number"] = 123;
+  node["record_genome_db"] = true;
+  node["cell_level_reporting"] = true;
+
+  ModelSettings decoded_settings;
+  EXPECT_NO_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings));
+  EXPECT_EQ(decoded_settings.get_random_generator(), utils::Random::Generator::MT19937);
+
+  node["random_generator"] = "philox";
+  EXPECT_NO_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings));
+  EXPECT_EQ(decoded_settings.get_random_generator(), utils::Random::Generator::PHILOX4X32);
+
+  node["random_generator"] = "lcg";
+  EXPECT_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings),
+               std::invalid_argument);
 }
 
 // Test missing fields during decoding
@@ -102,6 +102,7 @@ TEST_F(MovementSettingsTest, DecodeMovementSettings) {
     node["circulation_info"]["circulation_percent"] = 50.0;
     node["circulation_info"]["length_of_stay"]["mean"] = 5.0;
     node["circulation_info"]["length_of_stay"]["sd"] = 2.0;
+    node["circulation_info"]["destination_cache_tolerance"] = 0.05;
 
     MovementSettings decoded_settings;
     EXPECT_NO_THROW(YAML::convert<MovementSettings>::decode(node, decoded_settings));
@@ -126,6 +127,7 @@ TEST_F(MovementSettingsTest, DecodeMovementSettings) {
     EXPECT_EQ(decoded_settings.get_circulation_info().get_moving_level_distribution().get_exponential().get_scale(), 0.17);
     EXPECT_EQ(decoded_settings.get_circulation_info().get_length_of_stay().get_mean(), 5.0);
     EXPECT_EQ(decoded_settings.get_circulation_info().get_length_of_stay().get_sd(), 2.0);
+    EXPECT_EQ(decoded_settings.get_circulation_info().get_destination_cache_tolerance(), 0.05);
 }
 
 // Test for decoding with missing fields
@@ -117,6 +117,12 @@ TEST(SpatialSettingsDecodeTest, DecodeGridBasedSettings) {
   EXPECT_EQ(grid_settings.beta_raster, "test_beta.asc");
   EXPECT_EQ(grid_settings.ecoclimatic_raster, "test_eco.asc");
   EXPECT_EQ(grid_settings.cell_size, 5.0);
+  // distance_cutoff is optional
+  EXPECT_EQ(grid_settings.distance_cutoff, 0.0);
+
+  node["distance_cutoff"] = 25.0;
+  EXPECT_TRUE(YAML::convert<SpatialSettings::GridBased>::decode(node, grid_settings));
+  EXPECT_EQ(grid_settings.distance_cutoff, 25.0);
 
   ASSERT_EQ(grid_settings.administrative_boundaries.size(), 2);
   EXPECT_EQ(grid_settings.administrative_boundaries[0].name, "district");
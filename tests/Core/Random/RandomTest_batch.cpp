@@ -0,0 +1,70 @@
+// RandomTest_batch.cpp
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "RandomTestBase.h"
+
+using utils::Random;
+
+// The batch draws continue the same sequence as one-at-a-time draws, including partial blocks
+TEST_F(RandomTest, fill_uniform_MatchesSequentialDrawsOnPhilox) {
+  Random batch(Random::Generator::PHILOX4X32, 99, 5);
+  Random sequential(Random::Generator::PHILOX4X32, 99, 5);
+
+  for (const auto size : {3, 0, 70, 1, 33}) {
+    std::vector<double> values(size);
+    batch.fill_uniform(values);
+    for (const auto value : values) { EXPECT_EQ(value, sequential.random_uniform()); }
+  }
+  EXPECT_EQ(batch.random_uniform(), sequential.random_uniform());
+}
+
+TEST_F(RandomTest, fill_uniform_MatchesSequentialDrawsOnMt19937) {
+  Random batch(nullptr, 99);
+  Random sequential(nullptr, 99);
+
+  std::vector<double> values(50);
+  batch.fill_uniform(values);
+  for (const auto value : values) {
+    EXPECT_GE(value, 0.0);
+    EXPECT_LT(value, 1.0);
+    EXPECT_EQ(value, sequential.random_uniform());
+  }
+}
+
+TEST_F(RandomTest, fill_normal_SampleMoments) {
+  Random random(Random::Generator::PHILOX4X32, 7);
+  std::vector<double> values(100001);
+  random.fill_normal(values, 5.0, 2.0);
+
+  double sum = 0.0;
+  for (const auto value : values) { sum += value; }
+  const auto mean = sum / values.size();
+  double squares = 0.0;
+  for (const auto value : values) { squares += (value - mean) * (value - mean); }
+
+  EXPECT_NEAR(mean, 5.0, 0.05);
+  EXPECT_NEAR(std::sqrt(squares / values.size()), 2.0, 0.05);
+  EXPECT_THROW(random.fill_normal(values, 0.0, 0.0), std::invalid_argument);
+}
+
+TEST_F(RandomTest, fill_poisson_SampleMeanPerEntry) {
+  const std::vector<double> means{0.0, 1.5, 20.0};
+  std::vector<int> results(means.size());
+  std::vector<double> sums(means.size(), 0.0);
+  const int sample_size = 20000;
+  for (int i = 0; i < sample_size; ++i) {
+    rng.fill_poisson(means, results);
+    for (std::size_t j = 0; j < means.size(); ++j) { sums[j] += results[j]; }
+  }
+
+  EXPECT_EQ(sums[0], 0.0);
+  EXPECT_NEAR(sums[1] / sample_size, 1.5, 0.05);
+  EXPECT_NEAR(sums[2] / sample_size, 20.0, 0.2);
+
+  std::vector<int> wrong_size(2);
+  EXPECT_THROW(rng.fill_poisson(means, wrong_size), std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+// RandomTest_philox.cpp
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "RandomTestBase.h"
+#include "Utils/Philox.h"
+
+using utils::Philox4x32;
+using utils::Random;
+
+// Known answer vectors published with Random123
+TEST_F(RandomTest, philox_KnownAnswers) {
+  EXPECT_EQ(Philox4x32::generate({0, 0, 0, 0}, {0, 0}),
+            (Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox4x32::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                 {0xffffffff, 0xffffffff}),
+            (Philox4x32::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                 {0xa4093822, 0x299f31d0}),
+            (Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST_F(RandomTest, philox_SameSeedAndStreamGiveSameSequence) {
+  Random first(Random::Generator::PHILOX4X32, 42, 7);
+  Random second(Random::Generator::PHILOX4X32, 42, 7);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(first.random_uniform(1000000), second.random_uniform(1000000));
+  }
+}
+
+TEST_F(RandomTest, philox_SetSeedRestartsOwnStream) {
+  Random random(Random::Generator::PHILOX4X32, 42, 7);
+  const auto first = random.random_uniform();
+  random.random_uniform();
+  random.set_seed(42);
+  EXPECT_EQ(random.random_uniform(), first);
+}
+
+TEST_F(RandomTest, split_DoesNotDependOnParentDraws) {
+  Random parent(nullptr, 12345);
+  const auto child = parent.split(3);
+  for (int i = 0; i < 10; ++i) { parent.random_uniform(); }
+  const auto child_after_draws = parent.split(3);
+
+  EXPECT_EQ(child->get_generator(), Random::Generator::PHILOX4X32);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(child->random_poisson(3.0), child_after_draws->random_poisson(3.0));
+  }
+}
+
+TEST_F(RandomTest, split_StreamsDiffer) {
+  Random parent(nullptr, 12345);
+  const auto first = parent.split(0);
+  const auto second = parent.split(1);
+  const auto grandchild = first->split(1);
+
+  std::vector<double> first_draws, second_draws, grandchild_draws;
+  for (int i = 0; i < 10; ++i) {
+    first_draws.push_back(first->random_uniform());
+    second_draws.push_back(second->random_uniform());
+    grandchild_draws.push_back(grandchild->random_uniform());
+  }
+  EXPECT_NE(first_draws, second_draws);
+  EXPECT_NE(second_draws, grandchild_draws);
+}
+
+TEST_F(RandomTest, substream_IsSplitOfLocationAndDay) {
+  Random parent(nullptr, 12345);
+  const auto substream = parent.substream(2, 30);
+  const auto split = parent.split((2ULL << 32) | 30ULL);
+  const auto next_day = parent.substream(2, 31);
+
+  EXPECT_EQ(substream->get_stream_id(), split->get_stream_id());
+  const auto value = substream->random_uniform();
+  EXPECT_EQ(value, split->random_uniform());
+  EXPECT_NE(value, next_day->random_uniform());
+}
+
+TEST_F(RandomTest, resetSubstream_MatchesNewSubstream) {
+  Random parent(nullptr, 12345);
+  Random reused(Random::Generator::PHILOX4X32, 1);
+  for (int day = 0; day < 3; ++day) {
+    parent.reset_substream(reused, 2, day);
+    const auto substream = parent.substream(2, day);
+    EXPECT_EQ(reused.get_stream_id(), substream->get_stream_id());
+    for (int i = 0; i < 10; ++i) { EXPECT_EQ(reused.random_uniform(), substream->random_uniform()); }
+  }
+
+  Random mt(nullptr, 1);
+  EXPECT_THROW(parent.reset_substream(mt, 2, 0), std::invalid_argument);
+}
+
+// The distributions run unchanged on top of the Philox generator
+TEST_F(RandomTest, philox_DistributionMoments) {
+  Random random(Random::Generator::PHILOX4X32, 2024);
+  const int sample_size = 100000;
+
+  double poisson_sum = 0.0;
+  double binomial_sum = 0.0;
+  double beta_sum = 0.0;
+  double flat_sum = 0.0;
+  for (int i = 0; i < sample_size; ++i) {
+    poisson_sum += random.random_poisson(4.0);
+    binomial_sum += random.random_binomial(0.3, 10);
+    beta_sum += random.random_beta(2.0, 5.0);
+    flat_sum += random.random_flat(1.0, 3.0);
+  }
+  EXPECT_NEAR(poisson_sum / sample_size, 4.0, 0.05);
+  EXPECT_NEAR(binomial_sum / sample_size, 3.0, 0.05);
+  EXPECT_NEAR(beta_sum / sample_size, 2.0 / 7.0, 0.01);
+  EXPECT_NEAR(flat_sum / sample_size, 2.0, 0.01);
+
+  std::vector<unsigned> results(3);
+  random.random_multinomial(3, 1000, {1.0, 2.0, 1.0}, results);
+  EXPECT_EQ(results[0] + results[1] + results[2], 1000U);
+}
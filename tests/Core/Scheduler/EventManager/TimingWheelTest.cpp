@@ -0,0 +1,89 @@
+#include "Core/Scheduler/TimingWheel.h"
+#include "EventManagerTestCommon.h"
+
+namespace {
+// Event bound to a fake person address, never dereferenced by the wheel
+class WheelEvent : public PersonEvent {
+public:
+  WheelEvent(Person* person, int time) : PersonEvent(person) { set_time(time); }
+  [[nodiscard]] const std::string name() const override { return "WheelEvent"; }
+
+protected:
+  void do_execute() override {}
+};
+
+Person* fake_person(std::uintptr_t id) { return reinterpret_cast<Person*>(id * 64); }
+}  // namespace
+
+TEST(TimingWheelTest, SlotsAreRoundedUpToPowerOfTwo) {
+  EXPECT_EQ(TimingWheel(300).number_of_slots(), 512);
+  EXPECT_EQ(TimingWheel(8).number_of_slots(), 8);
+  EXPECT_EQ(TimingWheel(0).number_of_slots(), 1);
+}
+
+TEST(TimingWheelTest, CollectsOnlyPersonsDueThatDay) {
+  TimingWheel wheel(16);
+  WheelEvent today_a(fake_person(1), 5);
+  WheelEvent today_b(fake_person(2), 5);
+  WheelEvent tomorrow(fake_person(3), 6);
+  WheelEvent next_revolution(fake_person(4), 5 + 16);
+  for (auto* event : {&today_a, &today_b, &tomorrow, &next_revolution}) { wheel.schedule(event); }
+  EXPECT_EQ(wheel.size(), 4);
+
+  std::vector<Person*> due;
+  wheel.collect_due_persons(5, due);
+  std::ranges::sort(due);
+  EXPECT_EQ(due, (std::vector<Person*>{fake_person(1), fake_person(2)}));
+
+  due.clear();
+  wheel.collect_due_persons(21, due);
+  // events of the previous revolution are still linked until executed
+  EXPECT_EQ(due.size(), 3);
+}
+
+TEST(TimingWheelTest, DestroyedEventLeavesTheWheel) {
+  TimingWheel wheel(16);
+  WheelEvent kept(fake_person(1), 3);
+  wheel.schedule(&kept);
+  {
+    WheelEvent dropped(fake_person(2), 3);
+    wheel.schedule(&dropped);
+    EXPECT_TRUE(dropped.is_in_timing_wheel());
+    EXPECT_EQ(wheel.size(), 2);
+  }
+  EXPECT_EQ(wheel.size(), 1);
+
+  std::vector<Person*> due;
+  wheel.collect_due_persons(3, due);
+  EXPECT_EQ(due, (std::vector<Person*>{fake_person(1)}));
+}
+
+TEST(TimingWheelTest, EventManagerEraseUnlinksEvents) {
+  TimingWheel wheel(16);
+  EventManager<PersonEvent> event_manager;
+  for (int time : {4, 2, 4, 9}) {
+    auto event = std::make_unique<WheelEvent>(fake_person(1), time);
+    wheel.schedule(event.get());
+    event_manager.schedule_event(std::move(event));
+  }
+  EXPECT_EQ(wheel.size(), 4);
+
+  event_manager.execute_events(4);
+  EXPECT_EQ(event_manager.get_events().size(), 1);
+  EXPECT_EQ(wheel.size(), 1);
+
+  event_manager.clear_all_events();
+  EXPECT_EQ(wheel.size(), 0);
+}
+
+TEST(TimingWheelTest, RescheduleAndClear) {
+  TimingWheel wheel(16);
+  WheelEvent event(fake_person(1), 3);
+  wheel.schedule(&event);
+  wheel.schedule(&event);
+  EXPECT_EQ(wheel.size(), 1);
+
+  wheel.clear();
+  EXPECT_EQ(wheel.size(), 0);
+  EXPECT_FALSE(event.is_in_timing_wheel());
+}
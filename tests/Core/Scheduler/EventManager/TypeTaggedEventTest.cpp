@@ -0,0 +1,71 @@
+#include "EventManagerTestCommon.h"
+#include "Events/BirthdayEvent.h"
+#include "Events/ProgressToClinicalEvent.h"
+#include "Events/ReturnToResidenceEvent.h"
+
+class TypeTaggedEventTest : public EventManagerTestBase {
+protected:
+  template <typename T>
+  T* schedule(int time) {
+    auto event = std::make_unique<T>(nullptr);
+    event->set_time(time);
+    auto* raw = event.get();
+    event_manager.schedule_event(std::move(event));
+    return raw;
+  }
+};
+
+TEST_F(TypeTaggedEventTest, TagsAreDistinct) {
+  EXPECT_NE(BirthdayEvent::TYPE_ID, ProgressToClinicalEvent::TYPE_ID);
+  EXPECT_NE(BirthdayEvent::TYPE_ID, EventTypeId::UNTAGGED);
+  BirthdayEvent event(nullptr);
+  const Event &as_base = event;
+  EXPECT_EQ(as_base.type_id(), BirthdayEvent::TYPE_ID);
+  EXPECT_EQ(MockEvent(0).type_id(), EventTypeId::UNTAGGED);
+}
+
+TEST_F(TypeTaggedEventTest, CountsFollowScheduleExecuteAndClear) {
+  schedule<ProgressToClinicalEvent>(5);
+  schedule<ProgressToClinicalEvent>(10);
+  schedule<ReturnToResidenceEvent>(7);
+
+  EXPECT_TRUE(event_manager.has_event<ProgressToClinicalEvent>());
+  EXPECT_TRUE(event_manager.has_event<ReturnToResidenceEvent>());
+  EXPECT_FALSE(event_manager.has_event<BirthdayEvent>());
+  EXPECT_EQ(event_manager.count_events<ProgressToClinicalEvent>(), 2);
+
+  // cancelled events are still pending until their time
+  event_manager.cancel_all_events<ProgressToClinicalEvent>();
+  EXPECT_EQ(event_manager.count_events<ProgressToClinicalEvent>(), 2);
+
+  event_manager.execute_events(7);
+  EXPECT_EQ(event_manager.count_events<ProgressToClinicalEvent>(), 1);
+  EXPECT_FALSE(event_manager.has_event<ReturnToResidenceEvent>());
+
+  event_manager.clear_all_events();
+  EXPECT_FALSE(event_manager.has_event<ProgressToClinicalEvent>());
+  EXPECT_EQ(event_manager.count_events<ProgressToClinicalEvent>(), 0);
+}
+
+TEST_F(TypeTaggedEventTest, CancelByTypeExceptKeepsOtherTypes) {
+  auto* keep = schedule<ProgressToClinicalEvent>(5);
+  auto* cancelled = schedule<ProgressToClinicalEvent>(6);
+  auto* other_type = schedule<BirthdayEvent>(6);
+
+  event_manager.cancel_all_events_except<ProgressToClinicalEvent>(keep);
+
+  EXPECT_TRUE(keep->is_executable());
+  EXPECT_FALSE(cancelled->is_executable());
+  EXPECT_TRUE(other_type->is_executable());
+}
+
+TEST_F(TypeTaggedEventTest, UntaggedTypesFallBackToScan) {
+  auto event = std::make_unique<NiceMock<MockEvent>>(3);
+  event_manager.schedule_event(std::move(event));
+  schedule<BirthdayEvent>(4);
+
+  EXPECT_TRUE(event_manager.has_event<MockEvent>());
+  EXPECT_EQ(event_manager.count_events<MockEvent>(), 1);
+  // base class query matches every event
+  EXPECT_EQ(event_manager.count_events<PersonEvent>(), 2);
+}
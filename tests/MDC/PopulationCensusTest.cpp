@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "MDC/ModelDataCollector.h"
+#include "MDC/PopulationCensus.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "fixtures/TestFileGenerators.h"
+
+class PopulationCensusTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    test_fixtures::setup_test_environment("test_input.yml", [](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+
+    // give the persons 0 to 3 clones so every multiplicity of infection is present
+    auto* genotype = Model::get_genotype_db()->at(0);
+    auto i = 0;
+    for (const auto &person : Model::get_population()->all_persons()->v_person()) {
+      for (auto clone = 0; clone < i % 4; clone++) { person->add_new_parasite_to_blood(genotype); }
+      i++;
+    }
+  }
+
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+
+  static PersonIndexByLocationStateAgeClass* index() {
+    return Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+  }
+};
+
+TEST_F(PopulationCensusTest, CollectMatchesTheIndex) {
+  PopulationCensus census;
+  census.collect(index(), Model::get_genotype_db()->size());
+
+  ASSERT_EQ(census.number_of_locations(), Model::get_config()->number_of_locations());
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
+    auto population = 0;
+    auto infected = 0;
+    auto clones = 0;
+    std::vector<int> moi_histogram(4, 0);
+    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
+      for (auto ac = 0; ac < census.number_of_age_classes(); ac++) {
+        const auto &persons = index()->vPerson()[loc][hs][ac];
+        EXPECT_EQ(census.population(loc, hs, ac), static_cast<int>(persons.size()));
+        population += static_cast<int>(persons.size());
+        for (auto* person : persons) {
+          const auto moi = static_cast<int>(person->get_all_clonal_parasite_populations()->size());
+          moi_histogram[moi]++;
+          infected += moi > 0 ? 1 : 0;
+          clones += moi;
+        }
+      }
+    }
+    EXPECT_EQ(census.population(loc), population);
+    EXPECT_EQ(census.population(loc), static_cast<int>(Model::get_population()->size(loc)));
+    EXPECT_EQ(census.infected(loc), infected);
+    EXPECT_EQ(census.number_of_clones(loc), clones);
+    for (auto moi = 0; moi < 4; moi++) {
+      EXPECT_EQ(census.multiple_of_infection(loc, moi), moi_histogram[moi]);
+    }
+
+    // every infected person only carries genotype 0
+    if (infected == 0) { continue; }
+    ASSERT_EQ(census.genotype_end(loc) - census.genotype_begin(loc), 1U);
+    const auto entry = census.genotype_begin(loc);
+    EXPECT_EQ(census.genotype_id(entry), 0);
+    EXPECT_EQ(census.carriers(entry), infected);
+    EXPECT_EQ(census.clones(entry), clones);
+    EXPECT_DOUBLE_EQ(census.weighted_carriers(entry), infected);
+  }
+}
+
+TEST_F(PopulationCensusTest, PopulationStatisticReadsTheCensus) {
+  auto* mdc = Model::get_mdc();
+  mdc->perform_population_statistic();
+  const auto &census = mdc->census();
+
+  for (auto loc = 0; loc < census.number_of_locations(); loc++) {
+    for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
+      EXPECT_EQ(mdc->popsize_by_location_hoststate()[loc][hs],
+                census.population_by_host_state(loc, hs));
+    }
+    EXPECT_EQ(mdc->total_parasite_population_by_location()[loc], census.number_of_clones(loc));
+    for (auto moi = 1; moi <= ModelDataCollector::NUMBER_OF_REPORTED_MOI; moi++) {
+      EXPECT_EQ(mdc->multiple_of_infection_by_location()[loc][moi - 1],
+                census.multiple_of_infection(loc, moi));
+    }
+  }
+}
@@ -1,7 +1,10 @@
 #include "gtest/gtest.h"
 #include "Parasites/GenotypeDatabase.h"
 #include "Parasites/Genotype.h"
+#include "Parasites/GenotypeEncoding.h"
+#include "fixtures/TestFileGenerators.h"
 #include <memory>
+#include <yaml-cpp/yaml.h>
 
 class GenotypeDatabaseTest : public ::testing::Test {
 protected:
@@ -49,4 +52,24 @@ TEST_F(GenotypeDatabaseTest, GetWeightSetWeight) {
     EXPECT_EQ(w, weights);
 }
 
+TEST_F(GenotypeDatabaseTest, GetGenotypeByCode) {
+    test_fixtures::setup_test_environment();
+    auto pf_genotype_info = YAML::LoadFile("test_input.yml")["genotype_parameters"]["pf_genotype_info"]
+                                .as<GenotypeParameters::PfGenotypeInfo>();
+    test_fixtures::cleanup_test_files();
+
+    std::string aa_seq = "||||NY1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
+    auto genotype = std::make_unique<Genotype>(aa_seq);
+    genotype->set_genotype_id(0);
+    auto* raw_genotype = genotype.get();
+    db->add(std::move(genotype));
+    EXPECT_FALSE(raw_genotype->genotype_code.has_value());
+
+    // genotypes added before the encoding is set are encoded by set_encoding
+    db->set_encoding(std::make_unique<GenotypeEncoding>(pf_genotype_info));
+    ASSERT_TRUE(raw_genotype->genotype_code.has_value());
+    EXPECT_EQ(*raw_genotype->genotype_code, *db->get_encoding()->encode(aa_seq));
+    EXPECT_EQ(db->get_genotype(raw_genotype->get_genotype_code()), raw_genotype);
+}
+
 // Add more tests for get_min_ec50, at, etc. as needed
@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "Parasites/GenotypeEncoding.h"
+#include "fixtures/TestFileGenerators.h"
+#include <yaml-cpp/yaml.h>
+
+class GenotypeEncodingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_fixtures::setup_test_environment();
+        YAML::Node config = YAML::LoadFile("test_input.yml");
+        pf_genotype_info = config["genotype_parameters"]["pf_genotype_info"]
+                               .as<GenotypeParameters::PfGenotypeInfo>();
+    }
+
+    void TearDown() override {
+        test_fixtures::cleanup_test_files();
+    }
+
+    GenotypeParameters::PfGenotypeInfo pf_genotype_info;
+    const std::string wild_type = "||||NY1||KTHFIMG,x||||||FNCMYRIPRPCRA|1";
+};
+
+TEST_F(GenotypeEncodingTest, EncodeDecodeRoundTrip) {
+    GenotypeEncoding encoding(pf_genotype_info);
+    for (const std::string aa_seq : {wild_type, std::string("||||YF2||TTHFIMG,X||||||FNCMYRIPRPYRA|2")}) {
+        auto code = encoding.encode(aa_seq);
+        ASSERT_TRUE(code.has_value());
+        EXPECT_EQ(encoding.decode(*code), aa_seq);
+    }
+    EXPECT_NE(*encoding.encode(wild_type),
+              *encoding.encode("||||NY1||KTHFIMG,x||||||FNCMYRIPRPYRA|1"));
+}
+
+TEST_F(GenotypeEncodingTest, RejectsSequenceOutsideLayout) {
+    GenotypeEncoding encoding(pf_genotype_info);
+    // unknown amino acid, copy number above max_copies, missing gene separator
+    EXPECT_FALSE(encoding.encode("||||NZ1||KTHFIMG,x||||||FNCMYRIPRPCRA|1").has_value());
+    EXPECT_FALSE(encoding.encode("||||NY3||KTHFIMG,x||||||FNCMYRIPRPCRA|1").has_value());
+    EXPECT_FALSE(encoding.encode("||||NY1||KTHFIMGx||||||FNCMYRIPRPCRA|1").has_value());
+}
+
+TEST_F(GenotypeEncodingTest, LocusAtFollowsAaSequence) {
+    GenotypeEncoding encoding(pf_genotype_info);
+    EXPECT_EQ(encoding.locus_at(0), nullptr);  // separator of chromosome 1
+    EXPECT_EQ(encoding.chromosome_start(4), 4);
+
+    const auto* copy_number = encoding.locus_at(6);
+    ASSERT_NE(copy_number, nullptr);
+    EXPECT_TRUE(copy_number->is_copy_number);
+    EXPECT_EQ(copy_number->chromosome_id, 4);
+    EXPECT_EQ(copy_number->alphabet, "12");
+
+    const auto* k76t = encoding.locus_at(pf_genotype_info.calculate_aa_pos(6, 0, 0));
+    ASSERT_NE(k76t, nullptr);
+    EXPECT_FALSE(k76t->is_copy_number);
+    EXPECT_EQ(k76t->alphabet, "KT");
+    EXPECT_EQ(encoding.locus_at(static_cast<int>(wild_type.size())), nullptr);
+}
+
+TEST_F(GenotypeEncodingTest, SetChangesSingleLocus) {
+    GenotypeEncoding encoding(pf_genotype_info);
+    auto code = *encoding.encode(wild_type);
+    const auto& locus = *encoding.locus_at(pf_genotype_info.calculate_aa_pos(12, 0, 10));
+    EXPECT_EQ(GenotypeEncoding::get(code, locus), 0);
+    GenotypeEncoding::set(code, locus, 1);
+    EXPECT_EQ(GenotypeEncoding::get(code, locus), 1);
+    EXPECT_EQ(encoding.decode(code), "||||NY1||KTHFIMG,x||||||FNCMYRIPRPYRA|1");
+}
+
+TEST_F(GenotypeEncodingTest, CombineTakesWholeGenes) {
+    GenotypeEncoding encoding(pf_genotype_info);
+    const auto female = *encoding.encode(wild_type);
+    const auto male = *encoding.encode("||||YF2||TTHFIMG,X||||||FNCMYRIPRPYRA|2");
+
+    // second gene of chromosome 7 and all of chromosome 13 from the male
+    GenotypeCode from_male{};
+    for (std::size_t word = 0; word < from_male.size(); word++) {
+        from_male[word] = encoding.gene_masks()[6][1][word] | encoding.gene_masks()[12][0][word];
+    }
+    EXPECT_EQ(encoding.decode(GenotypeEncoding::combine(female, male, from_male)),
+              "||||NY1||KTHFIMG,X||||||FNCMYRIPRPYRA|1");
+    EXPECT_EQ(GenotypeEncoding::combine(female, male, GenotypeCode{}), female);
+}
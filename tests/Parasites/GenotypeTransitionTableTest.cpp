@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "Configuration/Config.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Simulation/Model.h"
+#include "Treatment/Therapies/DrugDatabase.h"
+#include "Treatment/Therapies/DrugType.h"
+#include "Utils/Cli.h"
+#include "fixtures/TestFileGenerators.h"
+
+class GenotypeTransitionTableTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    test_fixtures::setup_test_environment("test_input.yml", [](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+
+  static int masked_loci(DrugType* drug) {
+    const auto &mask = Model::get_config()->get_genotype_parameters().get_mutation_mask();
+    auto count = 0;
+    for (const auto &aa_pos : drug->resistant_aa_locations) {
+      if (mask[aa_pos.aa_index_in_aa_string] == '1') { count++; }
+    }
+    return count;
+  }
+
+  static double probability_of(const GenotypeTransitionTable &table, std::size_t outcome) {
+    return table.cumulative_probabilities[outcome]
+           - (outcome == 0 ? 0.0 : table.cumulative_probabilities[outcome - 1]);
+  }
+
+  static constexpr const char* FIRST = "||||NY1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
+  static constexpr const char* SECOND = "||||YY1||KTHFIMG,x||||||FNCMYRIPRPYRA|1";
+};
+
+TEST_F(GenotypeTransitionTableTest, MutationTableStartsWithTheUnmutatedGenotype) {
+  auto* genotype = Model::get_genotype_db()->get_genotype(FIRST);
+  constexpr double P_MUTATION = 0.01;
+  auto tested_drugs = 0;
+  for (const auto &drug : *Model::get_drug_db()) {
+    const auto loci = masked_loci(drug.get());
+    if (loci == 0) { continue; }
+    tested_drugs++;
+
+    const auto table = genotype->build_mutation_table(Model::get_config(), drug.get(), P_MUTATION);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->rate, P_MUTATION);
+    EXPECT_EQ(table->codes.front(), genotype->get_genotype_code());
+    EXPECT_NEAR(probability_of(*table, 0), std::pow(1.0 - P_MUTATION, loci), 1e-12);
+    EXPECT_NEAR(table->cumulative_probabilities.back(), 1.0, 1e-12);
+
+    std::map<GenotypeCode, int> seen;
+    for (const auto &code : table->codes) { EXPECT_EQ(++seen[code], 1); }
+  }
+  EXPECT_GT(tested_drugs, 0);
+}
+
+TEST_F(GenotypeTransitionTableTest, MutationTablesAreCachedUntilCleared) {
+  auto* db = Model::get_genotype_db();
+  auto* genotype = db->get_genotype(FIRST);
+  DrugType* drug = nullptr;
+  for (const auto &candidate : *Model::get_drug_db()) {
+    if (masked_loci(candidate.get()) > 0) { drug = candidate.get(); }
+  }
+  ASSERT_NE(drug, nullptr);
+
+  EXPECT_EQ(db->find_mutation_table(*genotype, drug->id()), nullptr);
+  genotype->perform_mutation_by_drug(Model::get_config(), Model::get_random(), drug, 0.01);
+  const auto* table = db->find_mutation_table(*genotype, drug->id());
+  ASSERT_NE(table, nullptr);
+  genotype->perform_mutation_by_drug(Model::get_config(), Model::get_random(), drug, 0.01);
+  EXPECT_EQ(db->find_mutation_table(*genotype, drug->id()), table);
+
+  // another probability is served without replacing the cached table
+  genotype->perform_mutation_by_drug(Model::get_config(), Model::get_random(), drug, 0.02);
+  EXPECT_EQ(db->find_mutation_table(*genotype, drug->id())->rate, 0.01);
+
+  db->clear_transition_tables();
+  EXPECT_EQ(db->find_mutation_table(*genotype, drug->id()), nullptr);
+}
+
+TEST_F(GenotypeTransitionTableTest, NoMutationWithoutProbability) {
+  auto* genotype = Model::get_genotype_db()->get_genotype(FIRST);
+  for (const auto &drug : *Model::get_drug_db()) {
+    for (auto i = 0; i < 100; i++) {
+      EXPECT_EQ(genotype->perform_mutation_by_drug(Model::get_config(), Model::get_random(),
+                                                   drug.get(), 0.0),
+                genotype);
+    }
+  }
+}
+
+TEST_F(GenotypeTransitionTableTest, RecombinationTableDoesNotDependOnParentOrder) {
+  auto* first = Model::get_genotype_db()->get_genotype(FIRST);
+  auto* second = Model::get_genotype_db()->get_genotype(SECOND);
+
+  const auto forward = Genotype::build_recombination_table(Model::get_config(), *first, *second);
+  const auto backward = Genotype::build_recombination_table(Model::get_config(), *second, *first);
+  ASSERT_NE(forward, nullptr);
+  ASSERT_NE(backward, nullptr);
+  EXPECT_GT(forward->codes.size(), 1U);
+  EXPECT_NEAR(forward->cumulative_probabilities.back(), 1.0, 1e-12);
+
+  std::map<GenotypeCode, double> forward_probabilities;
+  for (std::size_t i = 0; i < forward->codes.size(); i++) {
+    forward_probabilities[forward->codes[i]] += probability_of(*forward, i);
+  }
+  ASSERT_EQ(backward->codes.size(), forward_probabilities.size());
+  for (std::size_t i = 0; i < backward->codes.size(); i++) {
+    ASSERT_TRUE(forward_probabilities.contains(backward->codes[i]));
+    EXPECT_NEAR(forward_probabilities[backward->codes[i]], probability_of(*backward, i), 1e-12);
+  }
+  // the parents themselves are possible children
+  EXPECT_TRUE(forward_probabilities.contains(first->get_genotype_code()));
+  EXPECT_TRUE(forward_probabilities.contains(second->get_genotype_code()));
+}
+
+TEST_F(GenotypeTransitionTableTest, RecombinedChildrenComeFromTheCachedTable) {
+  auto* db = Model::get_genotype_db();
+  auto* first = db->get_genotype(FIRST);
+  auto* second = db->get_genotype(SECOND);
+
+  EXPECT_EQ(db->find_recombination_table(*first, *second), nullptr);
+  const auto* child = Genotype::free_recombine(Model::get_config(), Model::get_random(), first, second);
+  const auto* table = db->find_recombination_table(*second, *first);
+  ASSERT_NE(table, nullptr);
+
+  for (auto i = 0; i < 100; i++) {
+    EXPECT_NE(std::find(table->codes.begin(), table->codes.end(), child->get_genotype_code()),
+              table->codes.end());
+    child = Genotype::free_recombine(Model::get_config(), Model::get_random(), second, first);
+  }
+  EXPECT_EQ(db->find_recombination_table(*first, *second), table);
+}
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
-#include <set>
+#include <stdexcept>
+#include <vector>
 
 #include "Events/Event.h"
 #include "Population/DrugsInBlood.h"
@@ -21,7 +23,6 @@ protected:
     Model::get_instance()->initialize();
     person_ = std::make_unique<Person>();
     drugs_in_blood_ = std::make_unique<DrugsInBlood>(person_.get());
-    destroyed_drugs_.clear();
   }
 
   void TearDown() override {
@@ -33,54 +34,28 @@ protected:
 
   std::unique_ptr<Person> person_;
   std::unique_ptr<DrugsInBlood> drugs_in_blood_;
-  static std::set<int> destroyed_drugs_;
   std::map<int, std::unique_ptr<DrugType>> drug_types_;
   // Helper method to create a drug with specific values
-  std::unique_ptr<Drug> create_test_drug(int type_id, double starting_value = 1.0,
-                                         int dosing_days = 1) {
+  Drug create_test_drug(int type_id, double starting_value = 1.0, int dosing_days = 1) {
     if (drug_types_.find(type_id) == drug_types_.end()) {
       drug_types_[type_id] = std::make_unique<DrugType>();
       drug_types_[type_id]->set_id(type_id);
     }
 
-    auto drug = std::make_unique<Drug>(drug_types_[type_id].get());
-    drug->set_starting_value(starting_value);
-    drug->set_dosing_days(dosing_days);
-    drug->set_last_update_value(starting_value);
+    Drug drug(drug_types_[type_id].get());
+    drug.set_starting_value(starting_value);
+    drug.set_dosing_days(dosing_days);
+    drug.set_last_update_value(starting_value);
     return drug;
   }
 
-  // Helper class to track drug destruction
-  class TrackedDrug : public Drug {
-  public:
-    TrackedDrug(DrugType* type, int tracking_id) : Drug(type), tracking_id_(tracking_id) {}
-
-    ~TrackedDrug() override { destroyed_drugs_.insert(tracking_id_); }
-
-    int tracking_id() const { return tracking_id_; }
-
-  private:
-    int tracking_id_;
-  };
-
-  // Helper method to create a trackable drug
-  std::unique_ptr<TrackedDrug> create_tracked_drug(int type_id, int tracking_id) {
-    if (drug_types_.find(type_id) == drug_types_.end()) {
-      drug_types_[type_id] = std::make_unique<DrugType>();
-      drug_types_[type_id]->set_id(type_id);
-    }
-    auto drug_type = drug_types_[type_id].get();
-    auto drug = std::make_unique<TrackedDrug>(drug_type, tracking_id);
-    return drug;
-  }
-
-  static bool is_destroyed(int tracking_id) {
-    return destroyed_drugs_.find(tracking_id) != destroyed_drugs_.end();
+  std::vector<int> drug_ids() const {
+    std::vector<int> ids;
+    for (const auto &drug : *drugs_in_blood_) { ids.push_back(drug.drug_type()->id()); }
+    return ids;
   }
 };
 
-std::set<int> DrugsInBloodTest::destroyed_drugs_;
-
 TEST_F(DrugsInBloodTest, InitialState) {
   EXPECT_EQ(drugs_in_blood_->size(), 0);
   EXPECT_EQ(drugs_in_blood_->person(), person_.get());
@@ -164,7 +139,7 @@ TEST_F(DrugsInBloodTest, IteratorAccess) {
 
   std::size_t count = 0;
   for (const auto &drug : *drugs_in_blood_) {
-    EXPECT_TRUE(drug.first == 1 || drug.first == 2);
+    EXPECT_TRUE(drug.drug_type()->id() == 1 || drug.drug_type()->id() == 2);
     count++;
   }
   EXPECT_EQ(count, 2);
@@ -177,87 +152,41 @@ TEST_F(DrugsInBloodTest, ConstIteratorAccess) {
 
   std::size_t count = 0;
   for (const auto &drug : *drugs_in_blood_) {
-    EXPECT_EQ(drug.first, 1);
+    EXPECT_EQ(drug.drug_type()->id(), 1);
     count++;
   }
   EXPECT_EQ(count, 1);
 }
 
-TEST_F(DrugsInBloodTest, MemoryManagementAddDrug) {
-  const int tracking_id = 100;
-  {
-    auto drug = create_tracked_drug(1, tracking_id);
-    drugs_in_blood_->add_drug(std::move(drug));
-    // Drug should not be destroyed yet
-    EXPECT_FALSE(is_destroyed(tracking_id));
-  }
-  // Drug should still exist in drugs_in_blood_
-  EXPECT_FALSE(is_destroyed(tracking_id));
-  EXPECT_TRUE(drugs_in_blood_->contains(1));
+TEST_F(DrugsInBloodTest, DrugsAreSortedByTypeId) {
+  drugs_in_blood_->add_drug(create_test_drug(4));
+  drugs_in_blood_->add_drug(create_test_drug(1));
+  drugs_in_blood_->add_drug(create_test_drug(3));
+  drugs_in_blood_->add_drug(create_test_drug(1, 2.0));
 
-  // Clear should destroy the drug
-  drugs_in_blood_->clear();
-  EXPECT_TRUE(is_destroyed(tracking_id));
+  EXPECT_EQ(drug_ids(), (std::vector<int>{1, 3, 4}));
+  EXPECT_EQ(drugs_in_blood_->at(1)->starting_value(), 2.0);
+  EXPECT_EQ(drugs_in_blood_->at(3)->person_drugs(), drugs_in_blood_.get());
 }
 
-TEST_F(DrugsInBloodTest, MemoryManagementReplaceDrug) {
-  const int first_tracking_id = 101;
-  const int second_tracking_id = 102;
-
-  auto drug1 = create_tracked_drug(1, first_tracking_id);
-  drugs_in_blood_->add_drug(std::move(drug1));
-
-  // Adding second drug with same ID should destroy first drug
-  auto drug2 = create_tracked_drug(1, second_tracking_id);
-  drugs_in_blood_->add_drug(std::move(drug2));
+TEST_F(DrugsInBloodTest, AtThrowsForMissingDrug) {
+  drugs_in_blood_->add_drug(create_test_drug(1));
 
-  EXPECT_TRUE(is_destroyed(first_tracking_id));
-  EXPECT_FALSE(is_destroyed(second_tracking_id));
-  EXPECT_EQ(drugs_in_blood_->size(), 1);
+  EXPECT_FALSE(drugs_in_blood_->contains(2));
+  EXPECT_THROW(drugs_in_blood_->at(2), std::out_of_range);
 }
 
-TEST_F(DrugsInBloodTest, MemoryManagementDestructor) {
-  const int first_tracking_id = 103;
-  const int second_tracking_id = 104;
-
-  {
-    auto local_drugs = std::make_unique<DrugsInBlood>(person_.get());
-
-    auto drug1 = create_tracked_drug(1, first_tracking_id);
-    auto drug2 = create_tracked_drug(2, second_tracking_id);
-
-    local_drugs->add_drug(std::move(drug1));
-    local_drugs->add_drug(std::move(drug2));
-
-    EXPECT_FALSE(is_destroyed(first_tracking_id));
-    EXPECT_FALSE(is_destroyed(second_tracking_id));
-
-    local_drugs.reset();
-
-    // Both drugs should be destroyed when DrugsInBlood is destroyed
-    EXPECT_TRUE(is_destroyed(first_tracking_id));
-    EXPECT_TRUE(is_destroyed(second_tracking_id));
+TEST_F(DrugsInBloodTest, MoreDrugsThanTheInlineCapacity) {
+  const auto number_of_drugs = static_cast<int>(DrugsInBlood::INLINE_CAPACITY) + 3;
+  for (auto id = number_of_drugs - 1; id >= 0; id--) {
+    drugs_in_blood_->add_drug(create_test_drug(id, id % 2 == 0 ? 0.05 : 0.5));
   }
-}
-
-TEST_F(DrugsInBloodTest, MemoryManagementClearCutOff) {
-  const int staying_tracking_id = 105;
-  const int cut_off_tracking_id = 106;
-
-  auto staying_drug = create_tracked_drug(1, staying_tracking_id);
-  auto cut_off_drug = create_tracked_drug(2, cut_off_tracking_id);
-
-  staying_drug->set_last_update_value(0.2);   // Above cut-off
-  cut_off_drug->set_last_update_value(0.05);  // Below cut-off
-
-  drugs_in_blood_->add_drug(std::move(staying_drug));
-  drugs_in_blood_->add_drug(std::move(cut_off_drug));
+  EXPECT_EQ(drugs_in_blood_->size(), number_of_drugs);
+  for (auto id = 0; id < number_of_drugs; id++) { EXPECT_TRUE(drugs_in_blood_->contains(id)); }
 
   drugs_in_blood_->clear_cut_off_drugs();
 
-  // Cut-off drug should be destroyed, staying drug should remain
-  EXPECT_FALSE(is_destroyed(staying_tracking_id));
-  EXPECT_TRUE(is_destroyed(cut_off_tracking_id));
-  EXPECT_EQ(drugs_in_blood_->size(), 1);
+  std::vector<int> expected;
+  for (auto id = 1; id < number_of_drugs; id += 2) { expected.push_back(id); }
+  EXPECT_EQ(drug_ids(), expected);
 }
-
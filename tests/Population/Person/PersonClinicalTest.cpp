@@ -33,8 +33,9 @@ protected:
 TEST_F(PersonClinicalTest, ScheduleEndClinicalEvent) {
     EXPECT_CALL(*mock_random_, random_normal_int(_,_)).WillOnce(Return(7));
 
-    auto test_parasite = std::make_unique<ClonalParasitePopulation>();
-    person_->schedule_end_clinical_event(test_parasite.get());
+    auto* test_parasite =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
+    person_->schedule_end_clinical_event(test_parasite);
 
     EXPECT_TRUE(person_->has_event<EndClinicalEvent>());
     EXPECT_EQ(person_->get_events().size(), 1);
@@ -42,7 +43,7 @@ TEST_F(PersonClinicalTest, ScheduleEndClinicalEvent) {
     // cast to EndClinicalEvent
     auto event = dynamic_cast<EndClinicalEvent*>(person_->get_events().begin()->second.get());
     EXPECT_EQ(event->get_time(), 12);
-    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite.get());
+    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite);
 }
 
 TEST_F(PersonClinicalTest, ScheduleProgressToClinicalEventUnderFive) {
@@ -53,15 +54,16 @@ TEST_F(PersonClinicalTest, ScheduleProgressToClinicalEventUnderFive) {
     EXPECT_CALL(*mock_population_, notify_change(Eq(person_.get()), Person::Property::AGE_CLASS, _, _));
     person_->set_age(3);
 
-    auto test_parasite = std::make_unique<ClonalParasitePopulation>();  
-    person_->schedule_progress_to_clinical_event(test_parasite.get());
+    auto* test_parasite =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
+    person_->schedule_progress_to_clinical_event(test_parasite);
     EXPECT_TRUE(person_->has_event<ProgressToClinicalEvent>());
     EXPECT_EQ(person_->get_events().size(), 1);
 
     // cast to ProgressToClinicalEvent
     auto event = dynamic_cast<ProgressToClinicalEvent*>(person_->get_events().begin()->second.get());
     EXPECT_EQ(event->get_time(), 10);
-    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite.get());
+    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite);
 }
 
 TEST_F(PersonClinicalTest, ScheduleProgressToClinicalEventOverFive) {
@@ -70,15 +72,16 @@ TEST_F(PersonClinicalTest, ScheduleProgressToClinicalEventOverFive) {
       .Times(2);
 
     person_->set_age(6);
-    auto test_parasite = std::make_unique<ClonalParasitePopulation>();
-    person_->schedule_progress_to_clinical_event(test_parasite.get());
+    auto* test_parasite =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
+    person_->schedule_progress_to_clinical_event(test_parasite);
     EXPECT_TRUE(person_->has_event<ProgressToClinicalEvent>());
     EXPECT_EQ(person_->get_events().size(), 1);
 
     // cast to ProgressToClinicalEvent
     auto event = dynamic_cast<ProgressToClinicalEvent*>(person_->get_events().begin()->second.get());
     EXPECT_EQ(event->get_time(), 12);
-    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite.get());
+    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite);
 }
 
 TEST_F(PersonClinicalTest, CancelClinicalEvents) {
@@ -87,10 +90,12 @@ TEST_F(PersonClinicalTest, CancelClinicalEvents) {
     person_->set_age(25);
     
     // Schedule two events and keep track of the first one
-    auto test_parasite1 = std::make_unique<ClonalParasitePopulation>();  
-    auto test_parasite2 = std::make_unique<ClonalParasitePopulation>();  
-    person_->schedule_progress_to_clinical_event(test_parasite1.get());
-    person_->schedule_progress_to_clinical_event(test_parasite2.get());
+    auto* test_parasite1 =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
+    auto* test_parasite2 =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
+    person_->schedule_progress_to_clinical_event(test_parasite1);
+    person_->schedule_progress_to_clinical_event(test_parasite2);
     auto test_event = person_->get_events().begin()->second.get();
     
     // Cancel all except the first event
@@ -172,16 +177,17 @@ TEST_F(PersonClinicalTest, DeathProgressionWithTreatment) {
 TEST_F(PersonClinicalTest, TestTreatmentFailureScheduling) {
     const int testing_day = 28;
     const int therapy_id = 1;
-    auto test_parasite = std::make_unique<ClonalParasitePopulation>();
+    auto* test_parasite =
+        person_->get_all_clonal_parasite_populations()->add(ClonalParasitePopulation());
     
-    person_->schedule_test_treatment_failure_event(test_parasite.get(), testing_day, therapy_id);
+    person_->schedule_test_treatment_failure_event(test_parasite, testing_day, therapy_id);
     EXPECT_FALSE(person_->get_events().empty());
 
     // cast to TestTreatmentFailureEvent
     auto event = dynamic_cast<TestTreatmentFailureEvent*>(person_->get_events().begin()->second.get());
     // current time is 5
     EXPECT_EQ(event->get_time(), testing_day + 5);
-    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite.get());
+    EXPECT_EQ(event->clinical_caused_parasite(), test_parasite);
     EXPECT_EQ(event->therapy_id(), therapy_id);
 }
 
@@ -336,7 +336,9 @@ TEST_F(PersonInternalEventTest, TestTreatmentFailureEventTest) {
   // Setup - create a detectable parasite to simulate treatment failure
   std::string test_sequence = "||||YF1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
   auto genotype = std::make_unique<Genotype>(test_sequence);
-  auto clinical_parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
+  // Add the parasite to the person
+  auto* clinical_parasite = person_->get_all_clonal_parasite_populations()->add(
+      ClonalParasitePopulation(genotype.get()));
 
   // Set parasite density to detectable level to trigger treatment failure
   double detectable_density = Model::get_config()
@@ -346,12 +348,6 @@ TEST_F(PersonInternalEventTest, TestTreatmentFailureEventTest) {
                               + 1.0;
   clinical_parasite->set_last_update_log10_parasite_density(detectable_density);
 
-  // Store a raw pointer before moving ownership
-  ClonalParasitePopulation* clinical_parasite_ptr = clinical_parasite.get();
-
-  // Add the parasite to the person
-  person_->get_all_clonal_parasite_populations()->add(std::move(clinical_parasite));
-
   // Define a therapy ID to test with
   const int test_therapy_id = 1;
 
@@ -365,7 +361,7 @@ TEST_F(PersonInternalEventTest, TestTreatmentFailureEventTest) {
   // Create the treatment failure event
   auto tf_event = std::make_unique<TestTreatmentFailureEvent>(person_.get());
   tf_event->set_time(Model::get_scheduler()->current_time());
-  tf_event->set_clinical_caused_parasite(clinical_parasite_ptr);
+  tf_event->set_clinical_caused_parasite(clinical_parasite);
   tf_event->set_therapy_id(test_therapy_id);
 
   // Schedule and execute the event
@@ -1,3 +1,5 @@
+#include <gsl/gsl_cdf.h>
+
 #include "Events/MatureGametocyteEvent.h"
 #include "Events/MoveParasiteToBloodEvent.h"
 #include "Events/UpdateWhenDrugIsPresentEvent.h"
@@ -302,6 +304,26 @@ TEST_F(PersonParasiteTest, RelativeInfectivityWithCustomSigma) {
   EXPECT_DOUBLE_EQ(infectivity, (0.95 * 0.95) + 0.01);  // 0.9025 + 0.01 = 0.9125
 }
 
+TEST_F(PersonParasiteTest, RelativeInfectivityWithCdfTable) {
+  // With a tolerance the tabulated CDF is used instead of Random
+  EpidemiologicalParameters epi_params = mock_config_->get_epidemiological_parameters();
+  EpidemiologicalParameters::RelativeInfectivity rel_inf = epi_params.get_relative_infectivity();
+  const double tolerance = 1.0e-9;
+  rel_inf.set_cdf_table_tolerance(tolerance);
+  epi_params.set_relative_infectivity(rel_inf);
+  mock_config_->set_epidemiological_parameters(epi_params);
+
+  EXPECT_CALL(*mock_random_, cdf_standard_normal_distribution(::testing::_)).Times(0);
+
+  for (const double log10_density : {-3.0, -0.5, 0.0, 0.7, 2.0}) {
+    const double p = gsl_cdf_ugaussian_P((log10_density * 3.91) + 0.00031);
+    const double expected = std::min((p * p) + 0.01, 1.0);
+    // p^2 + 0.01 at most doubles the CDF error
+    EXPECT_NEAR(Person::relative_infectivity(log10_density), expected, 2 * tolerance)
+        << "log10 density " << log10_density;
+  }
+}
+
 TEST_F(PersonParasiteTest, RelativeInfectivityMinimumValue) {
   // Test that minimum infectivity is 0.01 when CDF returns 0
   EXPECT_CALL(*mock_random_, cdf_standard_normal_distribution(::testing::_))
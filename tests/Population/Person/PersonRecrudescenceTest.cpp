@@ -47,9 +47,6 @@ protected:
         // First create genotype with proper constructor
         std::string test_sequence = "||||YF1||TTHFIMG,x||||||FNCMYRIPRPCRA|1"; // Test sequence
         genotype_ = std::make_unique<Genotype>(test_sequence);
-
-        // Create parasite population with just the genotype
-        clinical_parasite_ = std::make_unique<ClonalParasitePopulation>(genotype_.get());
     }
 
     void TearDown() override {
@@ -59,7 +56,7 @@ protected:
         // Clear our own resources
         person_.reset();
         genotype_.reset();
-        clinical_parasite_.reset();
+        clinical_parasite_ = nullptr;
         
         test_fixtures::cleanup_test_files();
     }
@@ -115,6 +112,11 @@ protected:
     person_->set_latest_update_time(0);
     person_->generate_prob_present_at_mda_by_age();
 
+    // Create parasite population with just the genotype, in the blood so that the events can
+    // find it by its handle
+    clinical_parasite_ = person_->get_all_clonal_parasite_populations()->add(
+        ClonalParasitePopulation(genotype_.get()));
+
     // Handle drugs in blood
     if (hasDrugs) {
         // Create a therapy
@@ -123,7 +125,7 @@ protected:
         // Create and schedule a receive therapy event
         auto event = std::make_unique<ReceiveTherapyEvent>(person_.get());
         event->set_received_therapy(therapy.get());
-        event->set_clinical_caused_parasite(clinical_parasite_.get());
+        event->set_clinical_caused_parasite(clinical_parasite_);
         event->set_time(Model::get_scheduler()->current_time()); // Execute immediately
         event->set_is_part_of_mac_therapy(false);
         person_->schedule_basic_event(std::move(event));
@@ -134,7 +136,7 @@ protected:
 
     std::unique_ptr<Person> person_;
     std::unique_ptr<Genotype> genotype_;
-    std::unique_ptr<ClonalParasitePopulation> clinical_parasite_;
+    ClonalParasitePopulation* clinical_parasite_{nullptr};
 };
 
 // Test recrudescence with symptomatic outcome for a young child
@@ -158,7 +160,7 @@ TEST_F(PersonRecrudescenceTest, SymptomaticRecrudescenceYoungChild) {
     person_->update_events(Model::get_scheduler()->current_time());
     
     // Execute determine_symptomatic_recrudescence
-    person_->determine_symptomatic_recrudescence(clinical_parasite_.get());
+    person_->determine_symptomatic_recrudescence(clinical_parasite_);
     
     // Verify the recurrence status (could be WITH_SYMPTOM or WITHOUT_SYMPTOM depending on random values)
     if (person_->get_recurrence_status() == Person::RecurrenceStatus::WITH_SYMPTOM) {
@@ -170,7 +172,7 @@ TEST_F(PersonRecrudescenceTest, SymptomaticRecrudescenceYoungChild) {
         for (const auto& [time, event] : person_->get_events()) {
             auto* progress_event = dynamic_cast<ProgressToClinicalEvent*>(event.get());
             if (progress_event != nullptr && 
-                progress_event->clinical_caused_parasite() == clinical_parasite_.get()) {
+                progress_event->clinical_caused_parasite() == clinical_parasite_) {
                 found_recurrence_event = true;
                 
                 // Verify the event is scheduled for a reasonable time (7-54 days in the future)
@@ -205,7 +207,7 @@ TEST_F(PersonRecrudescenceTest, RecrudescenceWithDrugs) {
         clinical_parasite_->set_last_update_log10_parasite_density(3.0); // 1000 parasites/uL
         
         // Execute
-        person_->determine_symptomatic_recrudescence(clinical_parasite_.get());
+        person_->determine_symptomatic_recrudescence(clinical_parasite_);
         
         // Count outcomes
         if (person_->get_recurrence_status() == Person::RecurrenceStatus::WITH_SYMPTOM) {
@@ -264,7 +266,7 @@ TEST_F(PersonRecrudescenceTest, AsymptomaticDensityAdjustment) {
         const double original_density = clinical_parasite_->last_update_log10_parasite_density();
         
         // Execute
-        person_->determine_symptomatic_recrudescence(clinical_parasite_.get());
+        person_->determine_symptomatic_recrudescence(clinical_parasite_);
         
         // Track outcomes
         if (person_->get_recurrence_status() == Person::RecurrenceStatus::WITHOUT_SYMPTOM) {
@@ -334,7 +336,7 @@ TEST_F(PersonRecrudescenceTest, TreatmentFailureHandling) {
     
     // Add a treatment failure event with the correct constructor
     auto tf_event = std::make_unique<TestTreatmentFailureEvent>(person_.get());
-    tf_event->set_clinical_caused_parasite(clinical_parasite_.get());
+    tf_event->set_clinical_caused_parasite(clinical_parasite_);
     tf_event->set_therapy_id(test_therapy_id);
     tf_event->set_time(Model::get_scheduler()->current_time());
     
@@ -348,7 +350,7 @@ TEST_F(PersonRecrudescenceTest, TreatmentFailureHandling) {
     person_->schedule_basic_event(std::move(tf_event));
     
     // Execute determine_symptomatic_recrudescence
-    person_->determine_symptomatic_recrudescence(clinical_parasite_.get());
+    person_->determine_symptomatic_recrudescence(clinical_parasite_);
     
     // Now check the outcomes based on the recurrence status that was determined
     if (person_->get_recurrence_status() == Person::RecurrenceStatus::WITH_SYMPTOM) {
@@ -370,7 +372,7 @@ TEST_F(PersonRecrudescenceTest, TreatmentFailureHandling) {
         for (const auto& [time, event] : person_->get_events()) {
             auto* progress_event = dynamic_cast<ProgressToClinicalEvent*>(event.get());
             if (progress_event != nullptr && 
-                progress_event->clinical_caused_parasite() == clinical_parasite_.get()) {
+                progress_event->clinical_caused_parasite() == clinical_parasite_) {
                 found_recurrence_event = true;
                 break;
             }
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/Index/PersonStore.h"
+#include "fixtures/TestFileGenerators.h"
+
+class PersonStoreTest : public ::testing::Test {
+protected:
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+
+  static std::unique_ptr<Person> make_person(int location, int moving_level, double biting_rate) {
+    auto person = std::make_unique<Person>();
+    person->set_location(location);
+    person->set_age_class(0);
+    person->set_moving_level(moving_level);
+    person->set_current_relative_biting_rate(biting_rate);
+    return person;
+  }
+};
+
+TEST_F(PersonStoreTest, AddAndRemoveKeepSlotsDense) {
+  PersonStore store(2);
+  auto first = make_person(0, 1, 0.5);
+  auto second = make_person(0, 2, 1.5);
+  auto third = make_person(1, 0, 2.0);
+  store.add(first.get());
+  store.add(second.get());
+  store.add(third.get());
+  EXPECT_EQ(store.size(), 3);
+  EXPECT_EQ(store.columns_at(0).size(), 2);
+
+  store.remove(first.get());
+  const auto &columns = store.columns_at(0);
+  ASSERT_EQ(columns.size(), 1);
+  EXPECT_EQ(columns.persons[0], second.get());
+  EXPECT_EQ(second->PersonStoreHandler::get_index(), 0);
+  EXPECT_EQ(columns.moving_levels[0], 2);
+  EXPECT_DOUBLE_EQ(columns.relative_biting_rates[0], 1.5);
+}
+
+TEST_F(PersonStoreTest, NotifyChangeUpdatesColumns) {
+  PersonStore store(2);
+  auto person = make_person(0, 1, 0.5);
+  auto other = make_person(0, 0, 1.0);
+  store.add(person.get());
+  store.add(other.get());
+
+  const Person::HostStates clinical = Person::CLINICAL;
+  store.notify_change(person.get(), Person::HOST_STATE, nullptr, &clinical);
+  const double density = 3.5;
+  store.notify_change(person.get(), Person::INFECTIOUS_DENSITY, nullptr, &density);
+  const double biting_rate = 0.75;
+  store.notify_change(person.get(), Person::RELATIVE_BITING_RATE, nullptr, &biting_rate);
+  const auto &at_0 = store.columns_at(0);
+  EXPECT_EQ(at_0.host_states[0], Person::CLINICAL);
+  EXPECT_DOUBLE_EQ(at_0.log10_infectious_densities[0], 3.5);
+  EXPECT_DOUBLE_EQ(at_0.relative_biting_rates[0], 0.75);
+
+  // moving re-reads the person, as Person does the store is notified before the field changes
+  person->set_current_relative_biting_rate(biting_rate);
+  const int from = 0;
+  const int to = 1;
+  store.notify_change(person.get(), Person::LOCATION, &from, &to);
+  person->set_location(to);
+  ASSERT_EQ(store.columns_at(0).size(), 1);
+  EXPECT_EQ(store.columns_at(0).persons[0], other.get());
+  ASSERT_EQ(store.columns_at(1).size(), 1);
+  EXPECT_EQ(store.columns_at(1).persons[0], person.get());
+  EXPECT_DOUBLE_EQ(store.columns_at(1).relative_biting_rates[0], 0.75);
+}
+
+class PersonStoreForceOfInfectionTest : public PersonStoreTest,
+                                        public ::testing::WithParamInterface<bool> {};
+
+TEST_P(PersonStoreForceOfInfectionTest, MatchesPersonIndexSweep) {
+  const bool incremental = GetParam();
+  test_fixtures::setup_test_environment("test_input.yml", [incremental](YAML::Node &cfg) {
+    cfg["model_settings"]["initial_seed_number"] = 42;
+    cfg["model_settings"]["incremental_force_of_infection"] = incremental;
+  });
+  utils::Cli::get_instance().set_input_path("test_input.yml");
+  ASSERT_TRUE(Model::get_instance()->initialize());
+
+  auto* population = Model::get_population();
+  EXPECT_EQ(population->is_incremental_force_of_infection(), incremental);
+  for (int day = 1; day <= 5; day++) {
+    Model::get_scheduler()->set_current_time(day);
+    population->update_all_individuals();
+    population->perform_death_event();
+    population->perform_birth_event();
+  }
+  population->update_current_foi();
+
+  auto* pi = population->get_person_index<PersonIndexByLocationStateAgeClass>();
+  const auto &moving_level_values =
+      Model::get_config()->get_movement_settings().get_v_moving_level_value();
+  for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+    std::vector<Person*> expected_persons;
+    double expected_foi = 0.0;
+    double expected_biting = 0.0;
+    double expected_moving = 0.0;
+    for (int hs = 0; hs < Person::DEAD; hs++) {
+      for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+        for (auto* person : pi->vPerson()[loc][hs][ac]) {
+          expected_persons.push_back(person);
+          const auto density =
+              person->get_all_clonal_parasite_populations()->log10_total_infectious_density();
+          if (density != ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) {
+            expected_foi +=
+                person->get_current_relative_biting_rate() * Person::relative_infectivity(density);
+          }
+          expected_biting += person->get_current_relative_biting_rate();
+          expected_moving += moving_level_values[person->get_moving_level()];
+        }
+      }
+    }
+
+    EXPECT_EQ(population->number_of_alive_persons(loc), expected_persons.size());
+    if (!incremental) {
+      auto alive_persons = population->all_alive_persons_by_location()[loc];
+      std::ranges::sort(alive_persons);
+      std::ranges::sort(expected_persons);
+      EXPECT_EQ(alive_persons, expected_persons);
+    }
+    EXPECT_NEAR(population->current_force_of_infection_by_location()[loc], expected_foi,
+                1e-9 * std::max(1.0, expected_foi));
+    EXPECT_NEAR(population->sum_relative_biting_by_location()[loc], expected_biting,
+                1e-9 * std::max(1.0, expected_biting));
+    EXPECT_NEAR(population->sum_relative_moving_by_location()[loc], expected_moving,
+                1e-9 * std::max(1.0, expected_moving));
+
+    const auto sampled = population->sample_alive_persons(
+        Model::get_random(), PersonStore::RELATIVE_BITING, loc, 20, false);
+    EXPECT_EQ(sampled.size(), 20);
+    for (auto* person : sampled) {
+      ASSERT_NE(person, nullptr);
+      EXPECT_EQ(person->get_location(), loc);
+      EXPECT_NE(person->get_host_state(), Person::DEAD);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(FullAndIncremental, PersonStoreForceOfInfectionTest,
+                         ::testing::Values(false, true));
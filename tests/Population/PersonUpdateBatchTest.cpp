@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/ImmuneSystem/ImmuneSystem.h"
+#include "Population/Person/Person.h"
+#include "Population/PersonUpdateBatch.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "fixtures/TestFileGenerators.h"
+
+class PersonUpdateBatchTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    test_fixtures::setup_test_environment("test_input.yml", [](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+
+    // infect some persons with clones of every update function and mix the immune trends
+    for (const auto &person : Model::get_population()->all_persons()->v_person()) {
+      persons_.push_back(person.get());
+    }
+    auto* genotype = Model::get_genotype_db()->at(0);
+    for (std::size_t i = 0; i < persons_.size(); i++) {
+      auto* person = persons_[i];
+      person->get_immune_system()->set_increase(i % 2 == 0);
+      if (i % 3 != 0) { continue; }
+      person->add_new_parasite_to_blood(genotype)->set_update_function(
+          Model::immunity_clearance_update_function());
+      person->add_new_parasite_to_blood(genotype)->set_update_function(
+          Model::having_drug_update_function());
+      person->add_new_parasite_to_blood(genotype)->set_update_function(
+          Model::progress_to_clinical_update_function());
+    }
+    Model::get_scheduler()->set_current_time(DAY);
+  }
+
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+
+  static constexpr int DAY = 3;
+  std::vector<Person*> persons_;
+};
+
+TEST_F(PersonUpdateBatchTest, EvaluatedValuesMatchTheRegularUpdate) {
+  PersonUpdateBatch batch;
+  batch.begin(DAY, Model::get_config()->hot_parameters());
+  for (auto* person : persons_) { batch.add(person); }
+  batch.evaluate();
+
+  ASSERT_EQ(batch.size(), persons_.size());
+  ASSERT_GT(batch.number_of_parasites(), 0);
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    ASSERT_TRUE(batch.is_batched(i));
+    EXPECT_EQ(batch.immune_value(i), batch.person(i)->get_immune_system()->get_current_value());
+  }
+  for (std::size_t i = 0; i < batch.number_of_parasites(); i++) {
+    EXPECT_EQ(batch.parasite_density(i), batch.parasite(i)->get_current_parasite_density(DAY));
+  }
+}
+
+TEST_F(PersonUpdateBatchTest, ApplyFinishesTheDailyUpdate) {
+  std::vector<double> expected_immune_values;
+  for (auto* person : persons_) {
+    expected_immune_values.push_back(person->get_immune_system()->get_current_value());
+  }
+
+  PersonUpdateBatch batch;
+  batch.begin(DAY, Model::get_config()->hot_parameters());
+  for (auto* person : persons_) { batch.add(person); }
+  batch.evaluate();
+  batch.apply();
+  EXPECT_EQ(batch.size(), 0);
+
+  for (std::size_t i = 0; i < persons_.size(); i++) {
+    EXPECT_EQ(persons_[i]->get_latest_update_time(), DAY);
+    EXPECT_EQ(persons_[i]->get_immune_system()->get_latest_immune_value(),
+              expected_immune_values[i]);
+  }
+
+  // persons already updated today are left out
+  batch.begin(DAY, Model::get_config()->hot_parameters());
+  for (auto* person : persons_) { batch.add(person); }
+  EXPECT_EQ(batch.size(), 0);
+}
@@ -40,10 +40,10 @@ protected:
     std::unique_ptr<Person> person_;
 };
 
-// This test mimics the logic of Population::generate_individual to ensure
+// This test mimics the logic of Population::create_individual to ensure
 // a Person is properly initialized according to the simulation framework
 TEST_F(PersonGenerateIndividualTest, InitializePersonLikePopulationGenerateIndividual) {
-    // 1. Initialize the person as in Population::generate_individual
+    // 1. Initialize the person as in Population::create_individual
     person_->initialize();
     
     // 2. Set location and residence location
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Population/ImmuneSystem/ImmuneSystem.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "fixtures/TestFileGenerators.h"
+
+class PopulationParallelUpdateTest : public ::testing::Test {
+protected:
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+
+  static void initialize_model(int number_of_threads) {
+    test_fixtures::setup_test_environment("test_input.yml", [number_of_threads](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+      cfg["model_settings"]["number_of_threads"] = number_of_threads;
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  // Update all individuals for a few days and return a per-person snapshot of their state
+  static std::vector<double> run_and_snapshot(int number_of_threads, int days) {
+    initialize_model(number_of_threads);
+    // the populated cells of the grid fixture are separate locations, split over the threads
+    EXPECT_GT(Model::get_config()->number_of_locations(), 1);
+    for (int day = 1; day <= days; day++) {
+      Model::get_scheduler()->set_current_time(day);
+      Model::get_population()->update_all_individuals();
+    }
+
+    std::vector<double> snapshot;
+    auto* pi = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+    for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+      for (int hs = 0; hs < Person::DEAD; hs++) {
+        for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+          for (auto* person : pi->vPerson()[loc][hs][ac]) {
+            snapshot.push_back(hs);
+            snapshot.push_back(person->get_immune_system()->get_latest_immune_value());
+            snapshot.push_back(
+                person->get_all_clonal_parasite_populations()->log10_total_infectious_density());
+          }
+        }
+      }
+    }
+    Model::get_instance()->release();
+    return snapshot;
+  }
+};
+
+TEST_F(PopulationParallelUpdateTest, OutcomeDoesNotDependOnNumberOfThreads) {
+  const auto serial = run_and_snapshot(1, 10);
+  const auto two_threads = run_and_snapshot(2, 10);
+  const auto four_threads = run_and_snapshot(4, 10);
+
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(serial, two_threads);
+  EXPECT_EQ(serial, four_threads);
+}
+
+TEST_F(PopulationParallelUpdateTest, InitialPopulationDoesNotDependOnNumberOfThreads) {
+  // age, birthday, moving level, biting rate and immune value of every individual, in person
+  // index order
+  auto initial_population = [](int number_of_threads) {
+    initialize_model(number_of_threads);
+    std::vector<double> snapshot;
+    for (const auto &person : Model::get_population()->all_persons()->v_person()) {
+      snapshot.push_back(person->get_location());
+      snapshot.push_back(person->get_age());
+      snapshot.push_back(person->get_birthday());
+      snapshot.push_back(person->get_moving_level());
+      snapshot.push_back(person->get_innate_relative_biting_rate());
+      snapshot.push_back(person->get_immune_system()->get_latest_immune_value());
+    }
+    auto popsize_by_location = Model::get_population()->get_popsize_by_location();
+    Model::get_instance()->release();
+    return std::make_pair(snapshot, popsize_by_location);
+  };
+
+  const auto [serial, serial_popsize] = initial_population(1);
+  const auto [two_threads, two_threads_popsize] = initial_population(2);
+  const auto [three_threads, three_threads_popsize] = initial_population(3);
+
+  ASSERT_FALSE(serial.empty());
+  EXPECT_EQ(serial, two_threads);
+  EXPECT_EQ(serial, three_threads);
+  EXPECT_EQ(serial_popsize, two_threads_popsize);
+  EXPECT_EQ(serial_popsize, three_threads_popsize);
+}
+
+TEST_F(PopulationParallelUpdateTest, DeferredGenotypesGetIdsInSequenceOrder) {
+  initialize_model(2);
+  auto* db = Model::get_genotype_db();
+  const auto number_of_genotypes = db->size();
+
+  const std::string first = "||||NY1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
+  const std::string second = "||||YY1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
+
+  db->begin_deferred_registration();
+  // request the genotypes in reverse order, ids must follow aa_sequence order anyway
+  auto* second_genotype = db->get_genotype(second);
+  auto* first_genotype = db->get_genotype(first);
+  EXPECT_EQ(db->get_genotype(second), second_genotype);
+  EXPECT_EQ(second_genotype->genotype_id(), -1);
+  EXPECT_EQ(db->size(), number_of_genotypes);
+
+  db->commit_pending_genotypes();
+  EXPECT_FALSE(db->is_deferring_registration());
+  EXPECT_EQ(first_genotype->genotype_id(), static_cast<int>(number_of_genotypes));
+  EXPECT_EQ(second_genotype->genotype_id(), static_cast<int>(number_of_genotypes) + 1);
+  EXPECT_EQ(db->get_genotype(first), first_genotype);
+  EXPECT_EQ(db->at(first_genotype->genotype_id()), first_genotype);
+}
@@ -1,8 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
-#include <set>
 
 #include "Parasites/Genotype.h"
 #include "Population/ClonalParasitePopulation.h"
@@ -24,7 +24,6 @@ protected:
     person = std::make_unique<MockPerson>();
     populations = std::make_unique<SingleHostClonalParasitePopulations>(person.get());
     genotype = std::make_unique<Genotype>("abcdef");
-    destroyed_parasites_.clear();
   }
 
   void TearDown() override {
@@ -36,36 +35,23 @@ protected:
   std::unique_ptr<MockPerson> person;
   std::unique_ptr<SingleHostClonalParasitePopulations> populations;
   std::unique_ptr<Genotype> genotype;
-  static std::set<int> destroyed_parasites_;
 
-  // Helper class to track parasite destruction
-  class TrackedParasite : public ClonalParasitePopulation {
-  public:
-    TrackedParasite(int tracking_id) : tracking_id_(tracking_id) {}
-
-    ~TrackedParasite() override { destroyed_parasites_.insert(tracking_id_); }
-
-    int tracking_id() const { return tracking_id_; }
-
-  private:
-    int tracking_id_;
-  };
-
-  // Helper method to create a trackable parasite
-  std::unique_ptr<TrackedParasite> create_tracked_parasite(int tracking_id) {
-    auto parasite = std::make_unique<TrackedParasite>(tracking_id);
-    // Set any necessary default values
-    parasite->set_last_update_log10_parasite_density(2.0);  // Above cured threshold
+  // Clones are stored by value, they are told apart by their first date in blood
+  ClonalParasitePopulation create_tracked_parasite(int tracking_id) {
+    ClonalParasitePopulation parasite(genotype.get());
+    parasite.set_first_date_in_blood(tracking_id);
+    parasite.set_last_update_log10_parasite_density(2.0);  // Above cured threshold
     return parasite;
   }
 
-  static bool is_destroyed(int tracking_id) {
-    return destroyed_parasites_.find(tracking_id) != destroyed_parasites_.end();
+  static bool contains_tracked(const SingleHostClonalParasitePopulations &parasites,
+                               int tracking_id) {
+    return std::ranges::any_of(parasites, [tracking_id](const auto &parasite) {
+      return parasite.first_date_in_blood() == tracking_id;
+    });
   }
 };
 
-std::set<int> SingleHostClonalParasitePopulationsTest::destroyed_parasites_;
-
 TEST_F(SingleHostClonalParasitePopulationsTest, Initialization) {
   EXPECT_EQ(populations->size(), 0);
   EXPECT_TRUE(populations->empty());
@@ -75,37 +61,31 @@ TEST_F(SingleHostClonalParasitePopulationsTest, Initialization) {
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, AddAndRemoveParasite) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
   // Add parasite
-  populations->add(std::move(parasite));
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
 
   EXPECT_EQ(populations->size(), 1);
   EXPECT_FALSE(populations->empty());
   EXPECT_EQ(populations->at(0), parasite_ptr);
-  EXPECT_EQ(parasite_ptr->get_index(), 0);
+  EXPECT_EQ(parasite_ptr->genotype(), genotype.get());
+  EXPECT_EQ(parasite_ptr->parasite_population(), populations.get());
+  EXPECT_NE(parasite_ptr->handle(), ClonalParasitePopulation::NO_HANDLE);
 
   // Remove parasite
-  populations->remove(parasite_ptr->get_index());
+  populations->remove(0);
   EXPECT_EQ(populations->size(), 0);
   EXPECT_TRUE(populations->empty());
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, RemoveByIndex) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2_ptr = parasite2.get();
-
-  // Add two parasites
-  populations->add(std::move(parasite1));
-  populations->add(std::move(parasite2));
+  populations->add(create_tracked_parasite(1));
+  populations->add(create_tracked_parasite(2));
   EXPECT_EQ(populations->size(), 2);
 
-  // Remove first parasite
+  // Remove first parasite, the last one takes its place
   populations->remove(0);
   EXPECT_EQ(populations->size(), 1);
-  EXPECT_EQ(populations->at(0), parasite2_ptr);
-  EXPECT_EQ(parasite2_ptr->get_index(), 0);
+  EXPECT_EQ(populations->at(0)->first_date_in_blood(), 2);
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, RemoveByIndexEdgeCases) {
@@ -116,36 +96,51 @@ TEST_F(SingleHostClonalParasitePopulationsTest, RemoveByIndexEdgeCases) {
   EXPECT_THROW(populations->remove(-1), std::out_of_range);
 
   // Test removing with index beyond size
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  populations->add(std::move(parasite));
+  populations->add(ClonalParasitePopulation(genotype.get()));
   EXPECT_THROW(populations->remove(1), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(populations->at(1)), std::out_of_range);
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, ContainParasite) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
-  auto other_parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto other_parasite_ptr = other_parasite.get();
-
-  populations->add(std::move(parasite));
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
+  ClonalParasitePopulation other_parasite(genotype.get());
 
   EXPECT_TRUE(populations->contain(parasite_ptr));
-  EXPECT_FALSE(populations->contain(other_parasite_ptr));
+  EXPECT_FALSE(populations->contain(&other_parasite));
   EXPECT_FALSE(populations->contain(nullptr));
 }
 
+TEST_F(SingleHostClonalParasitePopulationsTest, FindByHandle) {
+  const auto handle1 = populations->add(create_tracked_parasite(1))->handle();
+  const auto handle2 = populations->add(create_tracked_parasite(2))->handle();
+  const auto handle3 = populations->add(create_tracked_parasite(3))->handle();
+  EXPECT_NE(handle1, handle2);
+  EXPECT_NE(handle2, handle3);
+
+  // the last parasite moves into the slot of the removed one, its handle still finds it
+  populations->remove(0);
+  EXPECT_EQ(populations->find(handle1), nullptr);
+  ASSERT_NE(populations->find(handle3), nullptr);
+  EXPECT_EQ(populations->find(handle3), populations->at(0));
+  EXPECT_EQ(populations->find(handle3)->first_date_in_blood(), 3);
+  EXPECT_EQ(populations->find(handle2)->first_date_in_blood(), 2);
+  EXPECT_EQ(populations->find(ClonalParasitePopulation::NO_HANDLE), nullptr);
+
+  // handles are not reused, a new parasite is not mistaken for the removed one
+  const auto handle4 = populations->add(create_tracked_parasite(4))->handle();
+  EXPECT_NE(handle4, handle1);
+  EXPECT_EQ(populations->find(handle1), nullptr);
+}
+
 TEST_F(SingleHostClonalParasitePopulationsTest, ClearCuredParasites) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite1_ptr = parasite1.get();
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2_ptr = parasite2.get();
-  auto parasite3 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite3_ptr = parasite3.get();
+  auto parasite1 = create_tracked_parasite(1);
+  auto parasite2 = create_tracked_parasite(2);
+  auto parasite3 = create_tracked_parasite(3);
 
   // Set up parasites with different densities
-  parasite1->set_last_update_log10_parasite_density(5.0);
-  parasite2->set_last_update_log10_parasite_density(-1111.0);  // Cured level
-  parasite3->set_last_update_log10_parasite_density(3.0);
+  parasite1.set_last_update_log10_parasite_density(5.0);
+  parasite2.set_last_update_log10_parasite_density(-1111.0);  // Cured level
+  parasite3.set_last_update_log10_parasite_density(3.0);
 
   populations->add(std::move(parasite1));
   populations->add(std::move(parasite2));
@@ -154,8 +149,8 @@ TEST_F(SingleHostClonalParasitePopulationsTest, ClearCuredParasites) {
   populations->clear_cured_parasites(-1111.0);
 
   EXPECT_EQ(populations->size(), 2);
-  EXPECT_EQ(populations->at(0), parasite1_ptr);
-  EXPECT_EQ(populations->at(1), parasite3_ptr);
+  EXPECT_EQ(populations->at(0)->first_date_in_blood(), 1);
+  EXPECT_EQ(populations->at(1)->first_date_in_blood(), 3);
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, ClearCuredParasitesEdgeCases) {
@@ -164,11 +159,11 @@ TEST_F(SingleHostClonalParasitePopulationsTest, ClearCuredParasitesEdgeCases) {
   EXPECT_EQ(populations->size(), 0);
 
   // Test with all cured parasites
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
+  ClonalParasitePopulation parasite1(genotype.get());
+  ClonalParasitePopulation parasite2(genotype.get());
 
-  parasite1->set_last_update_log10_parasite_density(-1111.0);
-  parasite2->set_last_update_log10_parasite_density(-1111.0);
+  parasite1.set_last_update_log10_parasite_density(-1111.0);
+  parasite2.set_last_update_log10_parasite_density(-1111.0);
 
   populations->add(std::move(parasite1));
   populations->add(std::move(parasite2));
@@ -178,12 +173,10 @@ TEST_F(SingleHostClonalParasitePopulationsTest, ClearCuredParasitesEdgeCases) {
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, HasDetectableParasite) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
 
   // Test with undetectable parasite
   parasite_ptr->set_last_update_log10_parasite_density(-1111.0);
-  populations->add(std::move(parasite));
   EXPECT_FALSE(populations->has_detectable_parasite(1.0));
 
   // Test with detectable parasite
@@ -196,11 +189,9 @@ TEST_F(SingleHostClonalParasitePopulationsTest, HasDetectableParasite) {
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, IsGametocytaemic) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
   // Test with no gametocytes
   parasite_ptr->set_gametocyte_level(0.0);
-  populations->add(std::move(parasite));
   EXPECT_FALSE(populations->is_gametocytaemic());
 
   // Test with gametocytes
@@ -213,11 +204,9 @@ TEST_F(SingleHostClonalParasitePopulationsTest, IsGametocytaemic) {
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, UpdateByDrugs) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
   auto drugs_in_blood = std::make_unique<DrugsInBlood>();
 
-  populations->add(std::move(parasite));
   parasite_ptr->set_last_update_log10_parasite_density(5.0);
   // Test update with no drugs
   populations->update_by_drugs(drugs_in_blood.get());
@@ -232,18 +221,14 @@ TEST_F(SingleHostClonalParasitePopulationsTest, UpdateByDrugsEdgeCases) {
   std::cout << "Test with empty population" << std::endl;
 
   // Test with null drugs_in_blood
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite_ptr = parasite.get();
-  populations->add(std::move(parasite));
+  auto* parasite_ptr = populations->add(ClonalParasitePopulation(genotype.get()));
   parasite_ptr->set_last_update_log10_parasite_density(5.0);
 
   EXPECT_THROW(populations->update_by_drugs(nullptr), std::invalid_argument);
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, Clear) {
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-
-  populations->add(std::move(parasite));
+  populations->add(ClonalParasitePopulation(genotype.get()));
   EXPECT_EQ(populations->size(), 1);
 
   populations->clear();
@@ -266,26 +251,21 @@ TEST_F(SingleHostClonalParasitePopulationsTest, LatestUpdateTime) {
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, IteratorAccess) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite1_ptr = parasite1.get();
-  auto parasite2_ptr = parasite2.get();
-
-  populations->add(std::move(parasite1));
-  populations->add(std::move(parasite2));
+  auto* parasite1_ptr = populations->add(create_tracked_parasite(1));
+  auto* parasite2_ptr = populations->add(create_tracked_parasite(2));
 
   // Test iterator access
   auto it = populations->begin();
-  EXPECT_EQ((*it).get(), parasite1_ptr);
+  EXPECT_EQ(&*it, parasite1_ptr);
   ++it;
-  EXPECT_EQ((*it).get(), parasite2_ptr);
+  EXPECT_EQ(&*it, parasite2_ptr);
 
   // Test const iterator access
   const auto* const_populations = populations.get();
   auto const_it = const_populations->begin();
-  EXPECT_EQ((*const_it).get(), parasite1_ptr);
+  EXPECT_EQ(const_it->first_date_in_blood(), 1);
   ++const_it;
-  EXPECT_EQ((*const_it).get(), parasite2_ptr);
+  EXPECT_EQ(const_it->first_date_in_blood(), 2);
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, IteratorEdgeCases) {
@@ -293,24 +273,23 @@ TEST_F(SingleHostClonalParasitePopulationsTest, IteratorEdgeCases) {
   EXPECT_EQ(populations->begin(), populations->end());
 
   // Test iterator increment beyond end
-  auto parasite = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  populations->add(std::move(parasite));
+  populations->add(ClonalParasitePopulation(genotype.get()));
   auto it = populations->begin();
   ++it;
   EXPECT_EQ(it, populations->end());
 }
 
 TEST_F(SingleHostClonalParasitePopulationsTest, MultipleParasitesWithDifferentDensities) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite3 = std::make_unique<ClonalParasitePopulation>(genotype.get());
+  ClonalParasitePopulation parasite1(genotype.get());
+  ClonalParasitePopulation parasite2(genotype.get());
+  ClonalParasitePopulation parasite3(genotype.get());
 
-  parasite1->set_last_update_log10_parasite_density(5.0);
-  parasite1->set_gametocyte_level(1.0);
-  parasite2->set_last_update_log10_parasite_density(3.0);
-  parasite2->set_gametocyte_level(1.0);
-  parasite3->set_last_update_log10_parasite_density(4.0);
-  parasite3->set_gametocyte_level(1.0);
+  parasite1.set_last_update_log10_parasite_density(5.0);
+  parasite1.set_gametocyte_level(1.0);
+  parasite2.set_last_update_log10_parasite_density(3.0);
+  parasite2.set_gametocyte_level(1.0);
+  parasite3.set_last_update_log10_parasite_density(4.0);
+  parasite3.set_gametocyte_level(1.0);
 
   populations->add(std::move(parasite1));
   populations->add(std::move(parasite2));
@@ -321,184 +300,60 @@ TEST_F(SingleHostClonalParasitePopulationsTest, MultipleParasitesWithDifferentDe
   EXPECT_GT(populations->log10_total_infectious_density(), 5.0);
 }
 
-TEST_F(SingleHostClonalParasitePopulationsTest, ParasiteIndexManagement) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite1_ptr = parasite1.get();
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2_ptr = parasite2.get();
-  auto parasite3 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite3_ptr = parasite3.get();
-
-  populations->add(std::move(parasite1));
-  populations->add(std::move(parasite2));
-  populations->add(std::move(parasite3));
+TEST_F(SingleHostClonalParasitePopulationsTest, ParasiteOrderAfterRemove) {
+  populations->add(create_tracked_parasite(1));
+  const auto handle2 = populations->add(create_tracked_parasite(2))->handle();
+  populations->add(create_tracked_parasite(3));
 
-  EXPECT_EQ(parasite1_ptr->get_index(), 0);
-  EXPECT_EQ(parasite2_ptr->get_index(), 1);
-  EXPECT_EQ(parasite3_ptr->get_index(), 2);
-
-  // Remove middle parasite and verify indices are updated
+  // Remove middle parasite, the last one takes its slot
   populations->remove(1);
-  EXPECT_EQ(parasite1_ptr->get_index(), 0);
-  EXPECT_EQ(parasite3_ptr->get_index(), 1);
-}
-
-TEST_F(SingleHostClonalParasitePopulationsTest, RemoveByParasitePtrIndex) {
-  auto parasite1 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite1_ptr = parasite1.get();
-  auto parasite2 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite2_ptr = parasite2.get();
-  auto parasite3 = std::make_unique<ClonalParasitePopulation>(genotype.get());
-  auto parasite3_ptr = parasite3.get();
-
-  populations->add(std::move(parasite1));
-  populations->add(std::move(parasite2));
-  populations->add(std::move(parasite3));
-
-  EXPECT_EQ(parasite1_ptr->get_index(), 0);
-  EXPECT_EQ(parasite2_ptr->get_index(), 1);
-  EXPECT_EQ(parasite3_ptr->get_index(), 2);
-
-  // Remove middle parasite and verify indices are updated
-  populations->remove(parasite2_ptr->get_index());
-  EXPECT_EQ(parasite1_ptr->get_index(), 0);
-  EXPECT_EQ(parasite3_ptr->get_index(), 1);
   EXPECT_EQ(populations->size(), 2);
+  EXPECT_EQ(populations->at(0)->first_date_in_blood(), 1);
+  EXPECT_EQ(populations->at(1)->first_date_in_blood(), 3);
 
   // Check if parasite2 is no longer in the population
-  EXPECT_FALSE(populations->contain(parasite2_ptr));
-
-  // No need to delete parasite2 as unique_ptr will handle it
-  // will get segfault if delete parasite2 even though the pointer is still point to the object
-  // delete parasite2;
+  EXPECT_FALSE(contains_tracked(*populations, 2));
+  EXPECT_EQ(populations->find(handle2), nullptr);
 }
 
-TEST_F(SingleHostClonalParasitePopulationsTest, MemoryManagementAdd) {
-  const int tracking_id = 100;
-  {
-    auto parasite = create_tracked_parasite(tracking_id);
-    populations->add(std::move(parasite));
-    EXPECT_FALSE(is_destroyed(tracking_id));
+TEST_F(SingleHostClonalParasitePopulationsTest, StaysInlineForFewClones) {
+  for (std::size_t i = 0; i < SingleHostClonalParasitePopulations::INLINE_CAPACITY; i++) {
+    populations->add(create_tracked_parasite(static_cast<int>(i)));
   }
-  // Parasite should still exist in populations
-  EXPECT_FALSE(is_destroyed(tracking_id));
-  EXPECT_EQ(populations->size(), 1);
-
-  // Clear should destroy the parasite
-  populations->clear();
-  EXPECT_TRUE(is_destroyed(tracking_id));
-  EXPECT_EQ(populations->size(), 0);
-}
-
-TEST_F(SingleHostClonalParasitePopulationsTest, MemoryManagementRemove) {
-  const int tracking_id1 = 101;
-  const int tracking_id2 = 102;
-
-  auto parasite1 = create_tracked_parasite(tracking_id1);
-  auto parasite2 = create_tracked_parasite(tracking_id2);
-
-  populations->add(std::move(parasite1));
-  populations->add(std::move(parasite2));
-  EXPECT_EQ(populations->size(), 2);
-
-  // Remove first parasite
-  populations->remove(0);
-  EXPECT_TRUE(is_destroyed(tracking_id1));
-  EXPECT_FALSE(is_destroyed(tracking_id2));
-  EXPECT_EQ(populations->size(), 1);
-}
-
-TEST_F(SingleHostClonalParasitePopulationsTest, MemoryManagementDestructor) {
-  const int tracking_id1 = 103;
-  const int tracking_id2 = 104;
-
-  {
-    auto local_populations = std::make_unique<SingleHostClonalParasitePopulations>(person.get());
-    auto parasite1 = create_tracked_parasite(tracking_id1);
-    auto parasite2 = create_tracked_parasite(tracking_id2);
-    local_populations->add(std::move(parasite1));
-    local_populations->add(std::move(parasite2));
-
-    EXPECT_FALSE(is_destroyed(tracking_id1));
-    EXPECT_FALSE(is_destroyed(tracking_id2));
-
-    local_populations.reset();
-    // Both parasites should be destroyed when populations is destroyed
-    EXPECT_TRUE(is_destroyed(tracking_id1));
-    EXPECT_TRUE(is_destroyed(tracking_id2));
+  auto* first = populations->at(0);
+  EXPECT_TRUE(populations->contain(first));
+
+  // growing past the inline capacity moves the clones, handles still find them
+  const auto handle = first->handle();
+  populations->add(create_tracked_parasite(100));
+  EXPECT_EQ(populations->size(), SingleHostClonalParasitePopulations::INLINE_CAPACITY + 1);
+  EXPECT_EQ(populations->find(handle), populations->at(0));
+  EXPECT_EQ(populations->find(handle)->first_date_in_blood(), 0);
+  for (auto &parasite : *populations) {
+    EXPECT_EQ(parasite.parasite_population(), populations.get());
   }
 }
 
-TEST_F(SingleHostClonalParasitePopulationsTest, MemoryManagementClearCuredParasites) {
-  const int staying_id = 105;
-  const int cleared_id = 106;
-
-  auto staying_parasite = create_tracked_parasite(staying_id);
-  auto staying_parasite_ptr = staying_parasite.get();
-  auto cleared_parasite = create_tracked_parasite(cleared_id);
-  auto cleared_parasite_ptr = cleared_parasite.get();
-
-  staying_parasite_ptr->set_last_update_log10_parasite_density(2.0);   // Above threshold
-  cleared_parasite_ptr->set_last_update_log10_parasite_density(-4.0);  // Below threshold
-
-  populations->add(std::move(staying_parasite));
-  populations->add(std::move(cleared_parasite));
-
-  populations->clear_cured_parasites(-2.0);  // Set threshold between the two parasites
-
-  // Cleared parasite should be destroyed, staying parasite should remain
-  EXPECT_FALSE(is_destroyed(staying_id));
-  EXPECT_TRUE(is_destroyed(cleared_id));
-  EXPECT_EQ(populations->size(), 1);
-}
-
-TEST_F(SingleHostClonalParasitePopulationsTest, MemoryManagementVectorReallocation) {
-  std::vector<int> tracking_ids;
+TEST_F(SingleHostClonalParasitePopulationsTest, ManyParasitesSwapRemove) {
   const int num_parasites = 10;
 
-  // Add enough parasites to force vector reallocation
-  for (int i = 0; i < num_parasites; i++) {
-    tracking_ids.push_back(i);
-    auto parasite = create_tracked_parasite(tracking_ids.back());
-    populations->add(std::move(parasite));
-    EXPECT_FALSE(is_destroyed(tracking_ids.back()));
-  }
-
+  for (int i = 0; i < num_parasites; i++) { populations->add(create_tracked_parasite(i)); }
   EXPECT_EQ(populations->size(), num_parasites);
 
   // When removing index 3 repeatedly:
-  // 1. parasite[3] is replaced by parasite[9], parasite[3] is destroyed
-  // 2. parasite[3] (which was parasite[9]) is replaced by parasite[8], parasite[9] is destroyed
-  // 3. parasite[3] (which was parasite[8]) is replaced by parasite[7], parasite[8] is destroyed
-  // 4. parasite[3] (which was parasite[7]) is replaced by parasite[6], parasite[7] is destroyed
-
-  std::vector<int> expected_destroyed_parasites{3, 9, 8, 7};
+  // 1. parasite[3] is replaced by parasite[9]
+  // 2. parasite[3] (which was parasite[9]) is replaced by parasite[8]
+  // 3. parasite[3] (which was parasite[8]) is replaced by parasite[7]
+  // 4. parasite[3] (which was parasite[7]) is replaced by parasite[6]
+  std::vector<int> expected_removed_parasites{3, 9, 8, 7};
   for (int i = 0; i < 4; i++) {
     populations->remove(3);
 
     EXPECT_EQ(populations->size(), num_parasites - i - 1);
-
-    // destroyed_parasites_ should contain 3, 9, 8, 7 iteratively
-    for (int j = 0; j < std::min(i, 4); j++) {
-      EXPECT_TRUE(is_destroyed(expected_destroyed_parasites[j]));
-    }
+    EXPECT_FALSE(contains_tracked(*populations, expected_removed_parasites[i]));
   }
 
-  EXPECT_EQ(populations->size(), num_parasites - 4);
-
-  // Final state verification:
-  // - First 3 parasites (0,1,2) should be alive
-  for (int i = 0; i < 3; i++) { EXPECT_FALSE(is_destroyed(i)); }
-
-  // parasites 3, 7,8,9 should be destroyed
-  EXPECT_TRUE(is_destroyed(3));
-  EXPECT_TRUE(is_destroyed(7));
-  EXPECT_TRUE(is_destroyed(8));
-  EXPECT_TRUE(is_destroyed(9));
-
-  // parasites 4,5,6 should be alive
-  EXPECT_FALSE(is_destroyed(4));
-  EXPECT_FALSE(is_destroyed(5));
-  EXPECT_FALSE(is_destroyed(6));
+  // parasites 0, 1, 2, 4, 5, 6 remain
+  for (const auto id : {0, 1, 2, 4, 5, 6}) { EXPECT_TRUE(contains_tracked(*populations, id)); }
+  EXPECT_EQ(populations->at(3)->first_date_in_blood(), 6);
 }
-
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "MDC/ModelDataCollector.h"
+#include "MDC/PopulationCensus.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Reporters/ColumnarReporter.h"
+#include "Reporters/Utility/ColumnarFile.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "fixtures/TestFileGenerators.h"
+
+TEST(ColumnarFileTest, RoundTripsEveryColumnType) {
+  const std::string path = "columnar_file_test.mcol";
+  {
+    ColumnarFileWriter writer(path);
+
+    ColumnChunk chunk;
+    chunk.table = "genome";
+    chunk.level = "district";
+    chunk.days_elapsed = 31;
+    chunk.model_time = 1000;
+    auto &units = chunk.add_integer_column("unit_id", ColumnChunk::Encoding::DICTIONARY);
+    units.integers = {7, 3, 7, 7, -1, 3};
+    chunk.add_integer_column("occurrences").integers = {1, 2, 3, 4, 5, 6};
+    chunk.add_real_column("weighted_occurrences").reals = {0.5, 1.0, 1.5, 2.0, 2.5, 3.0};
+    chunk.add_string_column("name").strings = {"a", "", "ccc", "d", "e", "f"};
+    writer.write(chunk);
+
+    // a chunk without rows
+    ColumnChunk empty;
+    empty.table = "site";
+    empty.add_integer_column("unit_id", ColumnChunk::Encoding::DICTIONARY);
+    writer.write(empty);
+  }
+
+  const auto chunks = ColumnarFileReader::read_all(path);
+  std::remove(path.c_str());
+
+  ASSERT_EQ(chunks.size(), 2U);
+  const auto &chunk = chunks[0];
+  EXPECT_EQ(chunk.table, "genome");
+  EXPECT_EQ(chunk.level, "district");
+  EXPECT_EQ(chunk.days_elapsed, 31);
+  EXPECT_EQ(chunk.model_time, 1000);
+  ASSERT_EQ(chunk.number_of_rows(), 6U);
+  ASSERT_NE(chunk.find("unit_id"), nullptr);
+  EXPECT_EQ(chunk.find("unit_id")->encoding, ColumnChunk::Encoding::DICTIONARY);
+  EXPECT_EQ(chunk.find("unit_id")->integers, (std::vector<int64_t>{7, 3, 7, 7, -1, 3}));
+  EXPECT_EQ(chunk.find("occurrences")->integers, (std::vector<int64_t>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(chunk.find("weighted_occurrences")->reals,
+            (std::vector<double>{0.5, 1.0, 1.5, 2.0, 2.5, 3.0}));
+  EXPECT_EQ(chunk.find("name")->strings,
+            (std::vector<std::string>{"a", "", "ccc", "d", "e", "f"}));
+  EXPECT_EQ(chunks[1].table, "site");
+  EXPECT_EQ(chunks[1].number_of_rows(), 0U);
+}
+
+TEST(ColumnarFileTest, RejectsColumnsOfDifferentLengths) {
+  const std::string path = "columnar_file_test.mcol";
+  ColumnarFileWriter writer(path);
+  ColumnChunk chunk;
+  chunk.add_integer_column("a").integers = {1, 2};
+  chunk.add_real_column("b").reals = {1.0};
+  EXPECT_THROW(writer.write(chunk), std::invalid_argument);
+  std::remove(path.c_str());
+}
+
+TEST(ColumnarFileTest, RejectsOtherFiles) {
+  const std::string path = "columnar_file_test.txt";
+  {
+    std::ofstream out(path);
+    out << "not a columnar file";
+  }
+  EXPECT_THROW(ColumnarFileReader::read_all(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+class ColumnarReporterTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    test_fixtures::setup_test_environment("test_input.yml", [](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override {
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+  }
+};
+
+TEST_F(ColumnarReporterTest, SiteChunksMatchTheCensus) {
+  ColumnarReporter reporter(true);
+  reporter.initialize(0, "./");
+  Model::get_mdc()->perform_population_statistic();
+  reporter.monthly_report();
+  reporter.after_run();
+
+  const auto chunks = ColumnarFileReader::read_all(reporter.file_path());
+  std::remove(reporter.file_path().c_str());
+
+  const auto &census = Model::get_mdc()->census();
+  auto total_population = 0;
+  for (auto location = 0; location < census.number_of_locations(); location++) {
+    total_population += census.population(location);
+  }
+
+  auto cell_chunks = 0;
+  auto genotype_chunks = 0;
+  for (const auto &chunk : chunks) {
+    if (chunk.table == "genotype") {
+      genotype_chunks++;
+      EXPECT_EQ(chunk.number_of_rows(), Model::get_genotype_db()->size());
+      continue;
+    }
+    if (chunk.table != "site") { continue; }
+
+    // every level accounts for the whole population
+    auto level_population = 0;
+    for (const auto population : chunk.find("population")->integers) {
+      level_population += static_cast<int>(population);
+    }
+    EXPECT_EQ(level_population, total_population) << chunk.level;
+
+    if (chunk.level != "cell") { continue; }
+    cell_chunks++;
+    const auto &locations = chunk.find("location_id")->integers;
+    const auto &population = chunk.find("population")->integers;
+    const auto &infected = chunk.find("infected_individuals")->integers;
+    for (std::size_t row = 0; row < chunk.number_of_rows(); row++) {
+      const auto location = static_cast<int>(locations[row]);
+      EXPECT_EQ(population[row], census.population(location));
+      EXPECT_EQ(infected[row], census.infected(location));
+    }
+  }
+  EXPECT_EQ(cell_chunks, 1);
+  EXPECT_EQ(genotype_chunks, 1);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "MDC/ModelDataCollector.h"
+#include "Population/ImmuneSystem/ImmuneSystem.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "fixtures/TestFileGenerators.h"
+
+class CheckpointRestoreTest : public ::testing::Test {
+protected:
+  static constexpr const char* CHECKPOINT_FILE = "checkpoint_restore_test.chk";
+  static constexpr const char* CHECKPOINT_DATE = "2000/2/1";
+
+  void TearDown() override {
+    set_checkpoint_options("", "", "");
+    Model::get_instance()->release();
+    test_fixtures::cleanup_test_files();
+    std::filesystem::remove(CHECKPOINT_FILE);
+  }
+
+  static void set_checkpoint_options(const std::string &checkpoint_path,
+                                     const std::string &checkpoint_date,
+                                     const std::string &restore_path) {
+    auto &cli = utils::Cli::get_instance();
+    cli.set_checkpoint_path(checkpoint_path);
+    cli.set_checkpoint_date(checkpoint_date);
+    cli.set_restore_path(restore_path);
+  }
+
+  // Events before the checkpoint date change the configuration or reschedule themselves
+  static void write_input() {
+    test_fixtures::setup_test_environment("test_input.yml", [](YAML::Node &cfg) {
+      cfg["model_settings"]["initial_seed_number"] = 42;
+      cfg["simulation_timeframe"]["ending_date"] = "2000/3/15";
+      cfg["spatial_settings"]["location_based"]["population_size_by_location"] =
+          std::vector<int>{5000};
+
+      YAML::Node importation;
+      importation["name"] = "introduce_parasites_periodically";
+      YAML::Node parasite_info;
+      parasite_info["genotype_aa_sequence"] = "||||NY1||TTHFIMG,x||||||FNCMYRIPRPCRA|1";
+      parasite_info["start_date"] = "2000/1/10";
+      parasite_info["duration"] = 30;
+      parasite_info["number_of_cases"] = 10;
+      YAML::Node importation_info;
+      importation_info["location"] = 0;
+      importation_info["parasite_info"].push_back(parasite_info);
+      importation["info"].push_back(importation_info);
+      cfg["population_events"].push_back(importation);
+
+      YAML::Node circulation;
+      circulation["name"] = "change_circulation_percent_event";
+      YAML::Node circulation_info;
+      circulation_info["date"] = "2000/1/20";
+      circulation_info["circulation_percent"] = 0.01;
+      circulation["info"].push_back(circulation_info);
+      cfg["population_events"].push_back(circulation);
+
+      YAML::Node feeding_rate;
+      feeding_rate["name"] = "change_interrupted_feeding_rate";
+      YAML::Node feeding_rate_info;
+      feeding_rate_info["location"] = 0;
+      feeding_rate_info["date"] = "2000/1/20";
+      feeding_rate_info["interrupted_feeding_rate"] = 0.3;
+      feeding_rate["info"].push_back(feeding_rate_info);
+      cfg["population_events"].push_back(feeding_rate);
+    });
+    utils::Cli::get_instance().set_input_path("test_input.yml");
+  }
+
+  // Run to the ending date and return the state of every individual, in person index order, the
+  // data collector and the changed configuration
+  static std::vector<double> run_and_snapshot() {
+    auto* model = Model::get_instance();
+    if (!model->initialize()) { return {}; }
+    model->run();
+
+    std::vector<double> snapshot;
+    auto* pi = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+    for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+      for (int hs = 0; hs < Person::DEAD; hs++) {
+        for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+          for (auto* person : pi->vPerson()[loc][hs][ac]) {
+            snapshot.push_back(hs);
+            snapshot.push_back(person->get_age());
+            snapshot.push_back(person->get_immune_system()->get_latest_immune_value());
+            snapshot.push_back(
+                person->get_all_clonal_parasite_populations()->log10_total_infectious_density());
+          }
+        }
+      }
+    }
+
+    auto* mdc = Model::get_mdc();
+    for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+      snapshot.push_back(mdc->cumulative_clinical_episodes_by_location()[loc]);
+      snapshot.push_back(mdc->cumulative_number_treatments_by_location()[loc]);
+      snapshot.push_back(mdc->cumulative_ntf_by_location()[loc]);
+      snapshot.push_back(mdc->total_number_of_bites_by_location()[loc]);
+      snapshot.push_back(Model::get_config()->location_db()[loc].mosquito_ifr);
+    }
+    snapshot.push_back(Model::get_config()
+                           ->get_movement_settings()
+                           .get_circulation_info()
+                           .get_circulation_percent());
+    for (const auto &[time, event] : Model::get_scheduler()->get_world_events().get_events()) {
+      snapshot.push_back(time);
+    }
+    model->release();
+    return snapshot;
+  }
+};
+
+TEST_F(CheckpointRestoreTest, RestoredRunMatchesUninterruptedRun) {
+  write_input();
+  set_checkpoint_options(CHECKPOINT_FILE, CHECKPOINT_DATE, "");
+  const auto uninterrupted = run_and_snapshot();
+  ASSERT_FALSE(uninterrupted.empty());
+  ASSERT_TRUE(std::filesystem::exists(CHECKPOINT_FILE));
+
+  write_input();
+  set_checkpoint_options("", "", CHECKPOINT_FILE);
+  const auto restored = run_and_snapshot();
+
+  EXPECT_EQ(uninterrupted, restored);
+}
+
+TEST_F(CheckpointRestoreTest, RestoreReplacesEventsAndChangedConfiguration) {
+  write_input();
+  set_checkpoint_options(CHECKPOINT_FILE, CHECKPOINT_DATE, "");
+  ASSERT_FALSE(run_and_snapshot().empty());
+
+  write_input();
+  set_checkpoint_options("", "", CHECKPOINT_FILE);
+  ASSERT_TRUE(Model::get_instance()->initialize());
+
+  // changed on 2000/1/20, before the checkpoint
+  EXPECT_DOUBLE_EQ(Model::get_config()->location_db()[0].mosquito_ifr, 0.3);
+  EXPECT_NEAR(Model::get_config()
+                  ->get_movement_settings()
+                  .get_circulation_info()
+                  .get_circulation_percent(),
+              0.01, 1e-7);
+
+  // only the pending events of the checkpoint remain: the importation rescheduled for the
+  // checkpoint day
+  const auto &events = Model::get_scheduler()->get_world_events().get_events();
+  ASSERT_EQ(events.size(), 1U);
+  EXPECT_EQ(events.front().second->name(), "ImportationPeriodicallyEvent");
+  EXPECT_EQ(events.front().first, Model::get_scheduler()->current_time());
+  EXPECT_TRUE(events.front().second->is_executable());
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Spatial/GIS/AscFile.h"
+
+class AscFileTest : public ::testing::Test {
+protected:
+  void SetUp() override { AscFileManager::set_binary_cache_enabled(true); }
+
+  void TearDown() override {
+    AscFileManager::set_binary_cache_enabled(true);
+    for (const auto* file : {"test_raster.asc", "test_raster.asc.bin", "test_raster.bin",
+                             "test_roundtrip.asc"}) {
+      std::filesystem::remove(file);
+    }
+  }
+
+  static void write_raster(const std::string &filename, const std::string &rows) {
+    std::ofstream file(filename);
+    file << "ncols 3\nnrows 2\nxllcorner 1.5\nyllcorner 2.5\ncellsize 5.0\nNODATA_value -9999\n";
+    file << rows;
+  }
+
+  static void expect_raster(const AscFile &raster, const std::vector<float> &values) {
+    EXPECT_EQ(raster.nrows, 2);
+    EXPECT_EQ(raster.ncols, 3);
+    EXPECT_DOUBLE_EQ(raster.xllcorner, 1.5);
+    EXPECT_DOUBLE_EQ(raster.yllcorner, 2.5);
+    EXPECT_DOUBLE_EQ(raster.cellsize, 5.0);
+    EXPECT_DOUBLE_EQ(raster.nodata_value, -9999);
+    for (auto row = 0; row < raster.nrows; row++) {
+      for (auto col = 0; col < raster.ncols; col++) {
+        EXPECT_FLOAT_EQ(raster.data[row][col], values[(row * raster.ncols) + col]);
+      }
+    }
+  }
+};
+
+TEST_F(AscFileTest, CacheIsWrittenThenMapped) {
+  write_raster("test_raster.asc", "1 2 3\n4 -9999 6.5\n");
+
+  const auto parsed = AscFileManager::read("test_raster.asc");
+  EXPECT_FALSE(parsed->data.is_mapped());
+  expect_raster(*parsed, {1, 2, 3, 4, -9999, 6.5});
+  ASSERT_TRUE(std::filesystem::exists("test_raster.asc.bin"));
+
+  const auto cached = AscFileManager::read("test_raster.asc");
+  EXPECT_TRUE(cached->data.is_mapped());
+  expect_raster(*cached, {1, 2, 3, 4, -9999, 6.5});
+}
+
+TEST_F(AscFileTest, ChangedSourceIsParsedAgain) {
+  write_raster("test_raster.asc", "1 2 3\n4 5 6\n");
+  AscFileManager::read("test_raster.asc");
+
+  // same size, so only the hash of the contents tells the versions apart
+  write_raster("test_raster.asc", "7 8 9\n1 2 3\n");
+  const auto raster = AscFileManager::read("test_raster.asc");
+  EXPECT_FALSE(raster->data.is_mapped());
+  expect_raster(*raster, {7, 8, 9, 1, 2, 3});
+}
+
+TEST_F(AscFileTest, DisabledCacheWritesNothing) {
+  AscFileManager::set_binary_cache_enabled(false);
+  write_raster("test_raster.asc", "1 2 3\n4 5 6\n");
+  AscFileManager::read("test_raster.asc");
+  EXPECT_FALSE(std::filesystem::exists("test_raster.asc.bin"));
+}
+
+TEST_F(AscFileTest, StandaloneBinaryRoundTrip) {
+  write_raster("test_raster.asc", "1 2 3\n4 5 6\n");
+  AscFileManager::set_binary_cache_enabled(false);
+  const auto parsed = AscFileManager::read("test_raster.asc");
+  AscFileManager::write_binary(parsed.get(), "test_raster.bin");
+  EXPECT_TRUE(AscFileManager::is_binary("test_raster.bin"));
+  EXPECT_FALSE(AscFileManager::is_binary("test_raster.asc"));
+
+  auto binary = AscFileManager::read("test_raster.bin");
+  EXPECT_TRUE(binary->data.is_mapped());
+  expect_raster(*binary, {1, 2, 3, 4, 5, 6});
+
+  AscFileManager::write(binary.get(), "test_roundtrip.asc");
+  expect_raster(*AscFileManager::read("test_roundtrip.asc"), {1, 2, 3, 4, 5, 6});
+}
+
+TEST_F(AscFileTest, CopyOfMappedRasterOwnsItsValues) {
+  write_raster("test_raster.asc", "1 2 3\n4 5 6\n");
+  AscFileManager::read("test_raster.asc");
+  const auto mapped = AscFileManager::read("test_raster.asc");
+  ASSERT_TRUE(mapped->data.is_mapped());
+
+  AscFile copy(*mapped);
+  EXPECT_FALSE(copy.data.is_mapped());
+  copy.data[0][0] = 42;
+  EXPECT_FLOAT_EQ(mapped->data[0][0], 1);
+  EXPECT_FLOAT_EQ(copy.data[0][0], 42);
+}
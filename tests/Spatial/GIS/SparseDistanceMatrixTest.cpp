@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "Spatial/GIS/SparseDistanceMatrix.h"
+
+namespace {
+// 4 x 5 grid with a no-data cell at (1, 2), ids in row-major order like SpatialData
+std::vector<Spatial::Location> make_grid() {
+  std::vector<Spatial::Location> locations;
+  for (int row = 0; row < 4; row++) {
+    for (int col = 0; col < 5; col++) {
+      if (row == 1 && col == 2) { continue; }
+      locations.push_back(Spatial::Location{
+          .id = static_cast<int>(locations.size()),
+          .coordinate = {.latitude = static_cast<float>(row), .longitude = static_cast<float>(col)}});
+    }
+  }
+  return locations;
+}
+
+double dense_distance(const Spatial::Location &from, const Spatial::Location &to, double cell_size) {
+  return std::sqrt(std::pow(cell_size * (from.coordinate.latitude - to.coordinate.latitude), 2)
+                   + std::pow(cell_size * (from.coordinate.longitude - to.coordinate.longitude), 2));
+}
+}  // namespace
+
+TEST(SparseDistanceMatrixTest, KeepsExactlyThePairsWithinCutoff) {
+  const auto locations = make_grid();
+  const double cell_size = 5.0;
+  const double cutoff = 11.0;
+  const auto matrix = Spatial::SparseDistanceMatrix::from_grid(locations, cell_size, cutoff);
+
+  ASSERT_EQ(matrix.number_of_locations(), locations.size());
+  std::size_t expected_entries = 0;
+  for (std::size_t from = 0; from < locations.size(); from++) {
+    std::vector<int> expected_neighbors;
+    for (std::size_t to = 0; to < locations.size(); to++) {
+      if (to != from && dense_distance(locations[from], locations[to], cell_size) <= cutoff) {
+        expected_neighbors.push_back(static_cast<int>(to));
+      }
+    }
+    expected_entries += expected_neighbors.size();
+
+    const auto neighbors = matrix.neighbors(static_cast<int>(from));
+    const auto distances = matrix.distances(static_cast<int>(from));
+    ASSERT_EQ(neighbors.size(), expected_neighbors.size()) << "from " << from;
+    for (std::size_t entry = 0; entry < neighbors.size(); entry++) {
+      EXPECT_EQ(neighbors[entry], expected_neighbors[entry]);
+      EXPECT_NEAR(distances[entry],
+                  dense_distance(locations[from], locations[neighbors[entry]], cell_size), 1e-9);
+    }
+  }
+  EXPECT_EQ(matrix.number_of_entries(), expected_entries);
+}
+
+TEST(SparseDistanceMatrixTest, FillRowMatchesDenseRowWithinCutoff) {
+  const auto locations = make_grid();
+  const auto matrix = Spatial::SparseDistanceMatrix::from_grid(locations, 5.0, 7.5);
+
+  DoubleVector row;
+  matrix.fill_row(0, row);
+  ASSERT_EQ(row.size(), locations.size());
+  for (std::size_t to = 0; to < locations.size(); to++) {
+    const auto distance = dense_distance(locations[0], locations[to], 5.0);
+    EXPECT_NEAR(row[to], distance <= 7.5 ? distance : 0.0, 1e-9);
+  }
+
+  // a second row overwrites the first one completely
+  matrix.fill_row(static_cast<int>(locations.size()) - 1, row);
+  EXPECT_DOUBLE_EQ(row[0], 0.0);
+}
+
+TEST(SparseDistanceMatrixTest, InvalidCutoffThrows) {
+  const auto locations = make_grid();
+  EXPECT_THROW(Spatial::SparseDistanceMatrix::from_grid(locations, 5.0, 0.0),
+               std::invalid_argument);
+  EXPECT_THROW(Spatial::SparseDistanceMatrix::from_grid(locations, 0.0, 10.0),
+               std::invalid_argument);
+  EXPECT_TRUE(Spatial::SparseDistanceMatrix().empty());
+}
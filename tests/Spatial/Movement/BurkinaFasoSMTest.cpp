@@ -97,6 +97,26 @@ TEST_F(BurkinaFasoSMTest, CalculateMovementPattern) {
   for (const auto &value : movement) { EXPECT_GE(value, 0.0); }
 }
 
+TEST_F(BurkinaFasoSMTest, SparseDistancesComputeKernelOnDemand) {
+  // without a dense matrix the kernel comes from the distance row passed in
+  Spatial::BurkinaFasoSM sparse_model(tau, alpha, rho, capital, penalty, number_of_locations, {});
+  EXPECT_NO_THROW(sparse_model.prepare());
+
+  const std::vector<int> residents_by_location = {1000, 2000, 3000};
+  for (int from_location = 0; from_location < number_of_locations; from_location++) {
+    auto dense = model->get_v_relative_out_movement_to_destination(
+        from_location, number_of_locations, spatial_distance_matrix[from_location],
+        residents_by_location);
+    auto sparse = sparse_model.get_v_relative_out_movement_to_destination(
+        from_location, number_of_locations, spatial_distance_matrix[from_location],
+        residents_by_location);
+    ASSERT_EQ(dense.size(), sparse.size());
+    for (int destination = 0; destination < number_of_locations; destination++) {
+      EXPECT_DOUBLE_EQ(dense[destination], sparse[destination]);
+    }
+  }
+}
+
 TEST_F(BurkinaFasoSMTest, UpdateParameters) {
   // Test parameter update methods
   const double new_tau = 1.5;
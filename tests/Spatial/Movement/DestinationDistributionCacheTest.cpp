@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "Spatial/Movement/DestinationDistributionCache.h"
+#include "Spatial/SpatialModel.hxx"
+#include "Utils/Random.h"
+#include "Utils/TypeDef.h"
+
+namespace {
+// Gravity-like model: destinations weighted by population, unreachable when the distance is 0
+class PopulationWeightedSM : public Spatial::SpatialModel {
+public:
+  [[nodiscard]] DoubleVector get_v_relative_out_movement_to_destination(
+      const int &from_location, const int &number_of_locations,
+      const DoubleVector &relative_distance_vector,
+      const IntVector &v_number_of_residents_by_location) const override {
+    DoubleVector results(number_of_locations, 0.0);
+    for (auto destination = 0; destination < number_of_locations; destination++) {
+      if (destination == from_location || relative_distance_vector[destination] == 0) { continue; }
+      results[destination] = v_number_of_residents_by_location[destination];
+    }
+    return results;
+  }
+};
+}  // namespace
+
+class DestinationDistributionCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    // location 2 is out of reach of location 0
+    distances = {{0.0, 1.0, 0.0, 2.0}, {1.0, 0.0, 1.0, 1.0}, {0.0, 1.0, 0.0, 1.0},
+                 {2.0, 1.0, 1.0, 0.0}};
+    distance_row = [this](int from_location) -> const DoubleVector & {
+      return distances[from_location];
+    };
+  }
+
+  PopulationWeightedSM model;
+  DoubleVector2 distances;
+  Spatial::DestinationDistributionCache::DistanceRow distance_row;
+};
+
+TEST_F(DestinationDistributionCacheTest, RequiresPositiveTolerance) {
+  EXPECT_THROW(Spatial::DestinationDistributionCache(0.0), std::invalid_argument);
+  EXPECT_THROW(Spatial::DestinationDistributionCache(-0.1), std::invalid_argument);
+}
+
+TEST_F(DestinationDistributionCacheTest, RebuildsOnlyWhenPopulationDrifts) {
+  Spatial::DestinationDistributionCache cache(0.1);
+  IntVector residents{1000, 1000, 1000, 1000};
+  EXPECT_TRUE(cache.refresh(model, residents, distance_row));
+
+  // 5% drift stays within the tolerance
+  residents[1] = 1050;
+  EXPECT_FALSE(cache.is_stale(residents));
+  EXPECT_FALSE(cache.refresh(model, residents, distance_row));
+
+  residents[1] = 1200;
+  EXPECT_TRUE(cache.refresh(model, residents, distance_row));
+  EXPECT_EQ(cache.get_number_of_rebuilds(), 2);
+
+  cache.invalidate();
+  EXPECT_TRUE(cache.refresh(model, residents, distance_row));
+  EXPECT_EQ(cache.get_number_of_rebuilds(), 3);
+}
+
+TEST_F(DestinationDistributionCacheTest, DrawsFollowDestinationWeights) {
+  utils::Random random(nullptr, 42);
+  Spatial::DestinationDistributionCache cache(0.1);
+  const IntVector residents{500, 1000, 2000, 3000};
+  cache.refresh(model, residents, distance_row);
+
+  IntVector destinations;
+  cache.sample(&random, 0, 100000, destinations);
+  ASSERT_EQ(destinations.size(), 100000);
+  IntVector counts(residents.size(), 0);
+  for (const auto destination : destinations) { counts[destination]++; }
+
+  EXPECT_EQ(counts[0], 0);
+  EXPECT_EQ(counts[2], 0);
+  EXPECT_NEAR(counts[1] / 100000.0, 0.25, 0.01);
+  EXPECT_NEAR(counts[3] / 100000.0, 0.75, 0.01);
+}
+
+TEST_F(DestinationDistributionCacheTest, UnreachableSourceDrawsNothing) {
+  utils::Random random(nullptr, 1);
+  Spatial::DestinationDistributionCache cache(0.1);
+  distances[2] = {0.0, 0.0, 0.0, 0.0};
+  cache.refresh(model, IntVector{100, 100, 100, 100}, distance_row);
+
+  IntVector destinations;
+  cache.sample(&random, 2, 10, destinations);
+  EXPECT_TRUE(destinations.empty());
+}
@@ -3,6 +3,8 @@
 
 #include "Treatment/Therapies/Drug.h"
 #include "Treatment/Therapies/DrugType.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
 #include "Population/DrugsInBlood.h"
 #include "Population/Person/Person.h"
 #include "Core/Scheduler/Scheduler.h"
@@ -186,3 +188,16 @@ TEST_F(DrugTest, GetParasiteKillingRate) {
   // This relies on the existence of proper genotype in the DB - if this fails, might need to set up mock
   EXPECT_NO_THROW(drug->get_parasite_killing_rate(genotype_id));
 }
+
+TEST_F(DrugTest, GetParasiteKillingRateFollowsConcentration) {
+  auto* genotype = Model::get_genotype_db()->at(0);
+  const auto EC50_power_n = genotype->get_EC50_power_n(drug_type.get());
+
+  // the cached power of the concentration is refreshed on every change
+  for (const double concentration : {0.8, 0.8, 0.3, 0.0, 1.5}) {
+    drug->set_last_update_value(concentration);
+    EXPECT_DOUBLE_EQ(drug->get_parasite_killing_rate(genotype),
+                     drug_type->get_parasite_killing_rate_by_concentration(concentration,
+                                                                           EC50_power_n));
+  }
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Utils/AliasTable.h"
+#include "Utils/Random.h"
+
+namespace {
+// Draw counts of each index over a large batch
+std::vector<int> histogram(const utils::AliasTable &table, std::size_t number_of_weights,
+                           utils::Random* random) {
+  std::vector<std::size_t> indices(200000);
+  table.sample(random, indices);
+  std::vector<int> counts(number_of_weights, 0);
+  for (const auto index : indices) { counts[index]++; }
+  return counts;
+}
+}  // namespace
+
+TEST(AliasTableTest, DrawsFollowWeights) {
+  utils::Random random(nullptr, 42);
+  const std::vector<double> weights{1.0, 0.0, 3.0, 6.0};
+  const utils::AliasTable table(weights);
+  EXPECT_EQ(table.size(), 4);
+  EXPECT_DOUBLE_EQ(table.total(), 10.0);
+
+  const auto counts = histogram(table, weights.size(), &random);
+  EXPECT_EQ(counts[1], 0);
+  EXPECT_NEAR(counts[0] / 200000.0, 0.1, 0.005);
+  EXPECT_NEAR(counts[2] / 200000.0, 0.3, 0.005);
+  EXPECT_NEAR(counts[3] / 200000.0, 0.6, 0.005);
+}
+
+TEST(AliasTableTest, AllZeroWeightsGiveEmptyTable) {
+  utils::AliasTable table({0.0, 0.0});
+  EXPECT_TRUE(table.empty());
+
+  table.assign({2.0});
+  utils::Random random(nullptr, 1);
+  EXPECT_EQ(table.sample(&random), 0);
+}
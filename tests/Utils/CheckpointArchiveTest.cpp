@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "Utils/CheckpointArchive.h"
+#include "Utils/FenwickTree.h"
+#include "Utils/Random.h"
+
+class CheckpointArchiveTest : public ::testing::Test {
+protected:
+  void TearDown() override { std::filesystem::remove("test_checkpoint.chk"); }
+};
+
+TEST_F(CheckpointArchiveTest, ValuesRoundTrip) {
+  int number = 42;
+  double rate = 0.125;
+  std::string name = "DHA-PPQ";
+  std::vector<int> ids{3, 1, 4};
+  std::vector<std::vector<double>> nested{{1.5}, {}, {2.5, 3.5}};
+  std::vector<bool> flags{true, false, true};
+  std::map<int, double> concentrations{{0, 0.5}, {2, 1.0}};
+  std::vector<std::tuple<int, int>> pairs{{1, 2}, {3, 4}};
+  {
+    utils::CheckpointWriter writer("test_checkpoint.chk");
+    writer & number & rate & name & ids & nested & flags & concentrations & pairs;
+    writer.close();
+  }
+
+  int restored_number = 0;
+  double restored_rate = 0;
+  std::string restored_name = "unchanged";
+  std::vector<int> restored_ids{9};
+  std::vector<std::vector<double>> restored_nested;
+  std::vector<bool> restored_flags;
+  std::map<int, double> restored_concentrations{{7, 7.0}};
+  std::vector<std::tuple<int, int>> restored_pairs;
+  utils::CheckpointReader reader("test_checkpoint.chk");
+  reader & restored_number & restored_rate & restored_name & restored_ids & restored_nested
+      & restored_flags & restored_concentrations & restored_pairs;
+  EXPECT_TRUE(reader.is_at_end());
+
+  EXPECT_EQ(restored_number, number);
+  EXPECT_DOUBLE_EQ(restored_rate, rate);
+  EXPECT_EQ(restored_name, name);
+  EXPECT_EQ(restored_ids, ids);
+  EXPECT_EQ(restored_nested, nested);
+  EXPECT_EQ(restored_flags, flags);
+  EXPECT_EQ(restored_concentrations, concentrations);
+  EXPECT_EQ(restored_pairs, pairs);
+}
+
+TEST_F(CheckpointArchiveTest, TruncatedFileThrows) {
+  {
+    utils::CheckpointWriter writer("test_checkpoint.chk");
+    std::vector<int> ids{1, 2, 3};
+    writer & ids;
+    writer.close();
+  }
+  std::filesystem::resize_file("test_checkpoint.chk", 12);
+
+  utils::CheckpointReader reader("test_checkpoint.chk");
+  std::vector<int> ids;
+  EXPECT_THROW(reader & ids, std::runtime_error);
+}
+
+TEST_F(CheckpointArchiveTest, MissingFileThrows) {
+  EXPECT_THROW(utils::CheckpointReader("missing_checkpoint.chk"), std::runtime_error);
+}
+
+TEST_F(CheckpointArchiveTest, RandomContinuesTheSameSequence) {
+  utils::Random random;
+  random.set_seed(2024);
+  for (auto i = 0; i < 10; i++) { random.random_flat(0.0, 1.0); }
+  {
+    utils::CheckpointWriter writer("test_checkpoint.chk");
+    random.checkpoint(writer);
+    writer.close();
+  }
+  std::vector<double> expected;
+  for (auto i = 0; i < 5; i++) { expected.push_back(random.random_flat(0.0, 1.0)); }
+
+  utils::Random restored;
+  restored.set_seed(1);
+  utils::CheckpointReader reader("test_checkpoint.chk");
+  restored.checkpoint(reader);
+  EXPECT_EQ(restored.get_seed(), 2024);
+  for (auto i = 0; i < 5; i++) { EXPECT_DOUBLE_EQ(restored.random_flat(0.0, 1.0), expected[i]); }
+}
+
+TEST_F(CheckpointArchiveTest, FenwickTreeKeepsItsSums) {
+  utils::FenwickTree tree({0.1, 0.2, 0.3});
+  tree.set(1, 0.7);
+  {
+    utils::CheckpointWriter writer("test_checkpoint.chk");
+    tree.checkpoint(writer);
+    writer.close();
+  }
+
+  utils::FenwickTree restored;
+  utils::CheckpointReader reader("test_checkpoint.chk");
+  restored.checkpoint(reader);
+  EXPECT_EQ(restored.size(), tree.size());
+  // bitwise identical, rounding errors included
+  EXPECT_EQ(restored.total(), tree.total());
+  EXPECT_EQ(restored.prefix_sum(2), tree.prefix_sum(2));
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Utils/FenwickTree.h"
+#include "Utils/Random.h"
+
+TEST(FenwickTreeTest, PrefixSumsMatchWeights) {
+  utils::FenwickTree tree({1.0, 2.0, 0.0, 4.0, 0.5});
+  EXPECT_DOUBLE_EQ(tree.prefix_sum(0), 0.0);
+  EXPECT_DOUBLE_EQ(tree.prefix_sum(2), 3.0);
+  EXPECT_DOUBLE_EQ(tree.prefix_sum(4), 7.0);
+  EXPECT_DOUBLE_EQ(tree.total(), 7.5);
+
+  tree.set(1, 0.5);
+  EXPECT_DOUBLE_EQ(tree.weight(1), 0.5);
+  EXPECT_DOUBLE_EQ(tree.total(), 6.0);
+}
+
+TEST(FenwickTreeTest, FindSkipsZeroWeights) {
+  utils::FenwickTree tree({1.0, 0.0, 2.0, 0.0});
+  EXPECT_EQ(tree.find(0.0), 0);
+  EXPECT_EQ(tree.find(0.999), 0);
+  EXPECT_EQ(tree.find(1.0), 2);
+  EXPECT_EQ(tree.find(2.5), 2);
+  // rounding at the upper end falls back to the last positive weight
+  EXPECT_EQ(tree.find(3.0), 2);
+
+  utils::FenwickTree zeros({0.0, 0.0});
+  EXPECT_EQ(zeros.find(0.0), zeros.size());
+}
+
+TEST(FenwickTreeTest, PushAndPopMatchRebuild) {
+  std::vector<double> weights;
+  utils::FenwickTree tree;
+  for (int i = 1; i <= 37; i++) {
+    weights.push_back(i % 5);
+    tree.push_back(i % 5);
+  }
+  tree.pop_back();
+  tree.pop_back();
+  weights.resize(weights.size() - 2);
+
+  const utils::FenwickTree rebuilt(weights);
+  ASSERT_EQ(tree.size(), rebuilt.size());
+  for (std::size_t count = 0; count <= weights.size(); count++) {
+    EXPECT_DOUBLE_EQ(tree.prefix_sum(count), rebuilt.prefix_sum(count));
+  }
+
+  tree.clear();
+  EXPECT_TRUE(tree.empty());
+  EXPECT_DOUBLE_EQ(tree.total(), 0.0);
+}
+
+TEST(FenwickTreeTest, DrawsFollowChangedWeights) {
+  utils::Random random(nullptr, 7);
+  utils::FenwickTree tree({5.0, 5.0, 0.0});
+  tree.set(0, 0.0);
+  tree.set(2, 15.0);
+
+  std::vector<std::size_t> indices(200000);
+  tree.sample(&random, indices);
+  std::vector<int> counts(3, 0);
+  for (const auto index : indices) { counts[index]++; }
+  EXPECT_EQ(counts[0], 0);
+  EXPECT_NEAR(counts[1] / 200000.0, 0.25, 0.005);
+  EXPECT_NEAR(counts[2] / 200000.0, 0.75, 0.005);
+}
+
+TEST(FenwickTreeTest, ZeroedWeightsLeaveNoRoundingBehind) {
+  utils::Random random(nullptr, 11);
+  utils::FenwickTree tree;
+  for (int i = 0; i < 1000; i++) { tree.push_back(random.random_flat(0.0, 1.0)); }
+  for (int i = 0; i < 20000; i++) {
+    const auto index = random.random_uniform(static_cast<unsigned long>(tree.size()));
+    tree.set(index, random.random_flat(0.0, 1.0) * 1e-3);
+  }
+  for (std::size_t i = 0; i < tree.size(); i++) { tree.set(i, 0.0); }
+
+  EXPECT_EQ(tree.number_of_positive_weights(), 0U);
+  EXPECT_EQ(tree.total(), 0.0);
+  EXPECT_EQ(tree.find(0.0), tree.size());
+  EXPECT_EQ(tree.find(1e-14), tree.size());
+
+  // a single positive weight left among residue is the only possible draw
+  tree.set(517, 1e-6);
+  EXPECT_EQ(tree.number_of_positive_weights(), 1U);
+  std::vector<std::size_t> indices(1000);
+  tree.sample(&random, indices);
+  for (const auto index : indices) { EXPECT_EQ(index, 517U); }
+  EXPECT_EQ(tree.find(tree.total() * 2), 517U);
+  EXPECT_EQ(tree.find(0.0), 517U);
+}
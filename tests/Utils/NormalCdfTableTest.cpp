@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <gsl/gsl_cdf.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "Utils/NormalCdfTable.h"
+
+namespace {
+// Largest difference to the GSL CDF on a grid much finer than the table
+double max_error_against_gsl(const utils::NormalCdfTable &table) {
+  double max_error = 0.0;
+  for (double x = -40.0; x <= 40.0; x += 1.0e-3) {
+    max_error = std::max(max_error, std::abs(table(x) - gsl_cdf_ugaussian_P(x)));
+  }
+  return max_error;
+}
+}  // namespace
+
+TEST(NormalCdfTableTest, ErrorStaysWithinTolerance) {
+  for (const auto tolerance : {1.0e-3, 1.0e-6, 1.0e-9, 1.0e-12}) {
+    const utils::NormalCdfTable table(tolerance);
+    EXPECT_LE(table.max_error(), tolerance);
+    EXPECT_LE(max_error_against_gsl(table), tolerance) << "tolerance " << tolerance;
+  }
+}
+
+TEST(NormalCdfTableTest, TighterToleranceNeedsMoreKnots) {
+  const utils::NormalCdfTable coarse(1.0e-4);
+  const utils::NormalCdfTable fine(1.0e-10);
+  EXPECT_LT(coarse.size(), fine.size());
+  // cubic interpolation keeps even the fine table small
+  EXPECT_LT(fine.size(), 2000U);
+}
+
+TEST(NormalCdfTableTest, TailsAndSymmetry) {
+  const utils::NormalCdfTable table(1.0e-9);
+  EXPECT_DOUBLE_EQ(table(-100.0), 0.0);
+  EXPECT_DOUBLE_EQ(table(100.0), 1.0);
+  EXPECT_NEAR(table(0.0), 0.5, 1.0e-15);
+  EXPECT_NEAR(table(1.3) + table(-1.3), 1.0, 2.0e-9);
+}
+
+TEST(NormalCdfTableTest, InvalidToleranceThrows) {
+  EXPECT_THROW(utils::NormalCdfTable(0.0), std::invalid_argument);
+  EXPECT_THROW(utils::NormalCdfTable(-1.0e-6), std::invalid_argument);
+  EXPECT_THROW(utils::NormalCdfTable(1.0), std::invalid_argument);
+}
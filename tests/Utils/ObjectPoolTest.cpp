@@ -5,6 +5,7 @@
 #include <memory> // For std::make_unique
 #include <stdexcept> // For std::runtime_error
 #include <atomic> // For concurrency test flag
+#include <cstdint>
 
 #include "Utils/ObjectPool.h"  // Assuming Utils is in include path or relative path works
 #include "gtest/gtest.h"
@@ -352,6 +353,78 @@ TEST(ObjectPoolEdgeCaseTest, ConcurrentAccessUnsafe) {
     SUCCEED(); // Test 'succeeds' by not crashing deterministically, highlights unsafety.
 }
 
+// Class routed through utils::SlabAllocator by the OBJECTPOOL macros
+struct PooledData {
+  PooledData(int i = 0) : id(i) {}
+  virtual ~PooledData() = default;
+  OBJECTPOOL(PooledData)
+
+  int id;
+  double payload[5]{};
+};
+OBJECTPOOL_IMPL(PooledData)
+
+struct LargerPooledData : PooledData {
+  double extra[3]{};
+};
+
+TEST(SlabAllocatorTest, ReusesFreedSlots) {
+  auto first = std::make_unique<PooledData>(1);
+  auto* address = first.get();
+  first.reset();
+
+  auto second = std::make_unique<PooledData>(2);
+  EXPECT_EQ(second.get(), address);
+  EXPECT_EQ(second->id, 2);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second.get()) % alignof(PooledData), 0);
+}
+
+TEST(SlabAllocatorTest, DerivedClassOfAnotherSizeUsesTheGlobalHeap) {
+  auto &allocator = utils::SlabAllocator<sizeof(PooledData), alignof(PooledData)>::instance();
+  auto pooled = std::make_unique<PooledData>();
+  const auto capacity = allocator.capacity();
+
+  std::vector<std::unique_ptr<PooledData>> objects;
+  for (auto i = 0; i < 100000; i++) { objects.push_back(std::make_unique<LargerPooledData>()); }
+  EXPECT_EQ(allocator.capacity(), capacity);
+  objects.clear();
+}
+
+TEST(SlabAllocatorTest, ObjectsCanBeFreedOnAnotherThread) {
+  const int num_threads = 4;
+  const int num_objects_per_thread = 20000;
+  std::vector<std::vector<std::unique_ptr<PooledData>>> objects(num_threads);
+
+  std::vector<std::thread> threads;
+  for (auto t = 0; t < num_threads; t++) {
+    threads.emplace_back([&objects, t]() {
+      for (auto i = 0; i < num_objects_per_thread; i++) {
+        objects[t].push_back(std::make_unique<PooledData>(i));
+      }
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+  threads.clear();
+
+  // every thread frees the objects created by its neighbour
+  for (auto t = 0; t < num_threads; t++) {
+    threads.emplace_back([&objects, t]() {
+      auto &owned = objects[(t + 1) % num_threads];
+      for (auto i = 0; i < num_objects_per_thread; i++) { EXPECT_EQ(owned[i]->id, i); }
+      owned.clear();
+    });
+  }
+  for (auto &thread : threads) { thread.join(); }
+
+  auto &allocator = utils::SlabAllocator<sizeof(PooledData), alignof(PooledData)>::instance();
+  const auto capacity = allocator.capacity();
+  std::vector<std::unique_ptr<PooledData>> reused;
+  for (auto i = 0; i < num_threads * num_objects_per_thread / 2; i++) {
+    reused.push_back(std::make_unique<PooledData>(i));
+  }
+  EXPECT_EQ(allocator.capacity(), capacity);
+}
+
 // Basic main function for running tests
 // int main(int argc, char **argv) {
 //   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "Utils/Helpers/SQLiteBulkWriter.h"
+
+class SQLiteBulkWriterTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_EQ(sqlite3_open(":memory:", &db_), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db_,
+                           "CREATE TABLE data (id INTEGER PRIMARY KEY, count INTEGER, value REAL, "
+                           "extra INTEGER);",
+                           nullptr, nullptr, nullptr),
+              SQLITE_OK);
+  }
+
+  void TearDown() override { sqlite3_close(db_); }
+
+  long long query(const std::string &sql) const {
+    sqlite3_stmt* stmt = nullptr;
+    EXPECT_EQ(sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK);
+    EXPECT_EQ(sqlite3_step(stmt), SQLITE_ROW);
+    const auto result = sqlite3_column_int64(stmt, 0);
+    sqlite3_finalize(stmt);
+    return result;
+  }
+
+  sqlite3* db_{nullptr};
+};
+
+TEST_F(SQLiteBulkWriterTest, RejectsZeroCapacity) {
+  EXPECT_THROW(SQLiteBulkWriter writer(db_, 0), std::invalid_argument);
+}
+
+TEST_F(SQLiteBulkWriterTest, WritesTypedRowsOfEveryBuffer) {
+  SQLiteBulkWriter writer(db_, 2);
+  const auto full = writer.register_statement("INSERT INTO data (id, count, value, extra) VALUES");
+  const auto short_row = writer.register_statement("INSERT INTO data (id, count) VALUES");
+
+  for (auto month = 0; month < 10; month++) {
+    auto buffer = writer.acquire_buffer();
+    EXPECT_TRUE(buffer.empty());
+    for (auto i = 0; i < 100; i++) {
+      const auto id = (month * 100) + i;
+      if (i % 2 == 0) {
+        buffer.begin_row(full);
+        buffer.add(id);
+        buffer.add(2UL);
+        buffer.add(0.5);
+        buffer.add(1);
+      } else {
+        buffer.begin_row(short_row);
+        buffer.add(id);
+        buffer.add(2);
+      }
+    }
+    writer.submit(std::move(buffer));
+  }
+  writer.flush();
+
+  EXPECT_EQ(query("SELECT COUNT(*) FROM data;"), 1000);
+  EXPECT_EQ(query("SELECT SUM(count) FROM data;"), 2000);
+  EXPECT_EQ(query("SELECT SUM(extra) FROM data;"), 500);
+  EXPECT_EQ(query("SELECT CAST(SUM(value) AS INTEGER) FROM data;"), 250);
+  EXPECT_EQ(query("SELECT COUNT(*) FROM data WHERE typeof(value) = 'real';"), 500);
+}
+
+TEST_F(SQLiteBulkWriterTest, FailedBufferIsRolledBack) {
+  SQLiteBulkWriter writer(db_);
+  const auto statement = writer.register_statement("INSERT INTO data (id, count) VALUES");
+
+  auto buffer = writer.acquire_buffer();
+  buffer.begin_row(statement);
+  buffer.add(1);
+  buffer.add(1);
+  writer.submit(std::move(buffer));
+
+  // the second row of this buffer violates the primary key of the first one
+  buffer = writer.acquire_buffer();
+  buffer.begin_row(statement);
+  buffer.add(2);
+  buffer.add(1);
+  buffer.begin_row(statement);
+  buffer.add(1);
+  buffer.add(1);
+  writer.submit(std::move(buffer));
+  writer.flush();
+
+  EXPECT_EQ(query("SELECT COUNT(*) FROM data;"), 1);
+}
+
+TEST_F(SQLiteBulkWriterTest, DestructorWritesPendingBuffers) {
+  {
+    SQLiteBulkWriter writer(db_, 1);
+    const auto statement = writer.register_statement("INSERT INTO data (id) VALUES");
+    for (auto id = 0; id < 20; id++) {
+      auto buffer = writer.acquire_buffer();
+      buffer.begin_row(statement);
+      buffer.add(id);
+      writer.submit(std::move(buffer));
+    }
+  }
+  EXPECT_EQ(query("SELECT COUNT(*) FROM data;"), 20);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include "Utils/SmallVector.h"
+
+namespace {
+// Counts the live instances to check that every element is destroyed exactly once
+struct Counted {
+  static inline int live = 0;
+
+  explicit Counted(std::string value) : value(std::move(value)) { live++; }
+  Counted(Counted &&other) noexcept : value(std::move(other.value)) { live++; }
+  Counted &operator=(Counted &&other) noexcept = default;
+  Counted(const Counted &) = delete;
+  Counted &operator=(const Counted &) = delete;
+  ~Counted() { live--; }
+
+  std::string value;
+};
+
+template <std::size_t N>
+std::string joined(const utils::SmallVector<Counted, N> &values) {
+  std::string result;
+  for (const auto &element : values) { result += element.value; }
+  return result;
+}
+}  // namespace
+
+TEST(SmallVectorTest, StaysInlineUpToItsCapacity) {
+  utils::SmallVector<int, 3> values;
+  for (auto i = 0; i < 3; i++) { values.emplace_back(i); }
+  EXPECT_TRUE(values.is_inline());
+  EXPECT_EQ(values.capacity(), 3);
+
+  values.push_back(3);
+  EXPECT_FALSE(values.is_inline());
+  EXPECT_EQ(values.size(), 4);
+  for (auto i = 0; i < 4; i++) { EXPECT_EQ(values[i], i); }
+}
+
+TEST(SmallVectorTest, InsertAndEraseKeepTheOrder) {
+  {
+    utils::SmallVector<Counted, 2> values;
+    values.emplace_back("b");
+    values.emplace_back("d");
+    values.insert(values.begin(), Counted("a"));
+    values.insert(values.begin() + 2, Counted("c"));
+    values.insert(values.end(), Counted("e"));
+    EXPECT_EQ(joined(values), "abcde");
+    EXPECT_EQ(Counted::live, 5);
+
+    auto* next = values.erase(values.begin() + 1, values.begin() + 3);
+    EXPECT_EQ(next->value, "d");
+    EXPECT_EQ(joined(values), "ade");
+    EXPECT_EQ(Counted::live, 3);
+
+    values.erase(values.begin());
+    values.pop_back();
+    EXPECT_EQ(joined(values), "d");
+    EXPECT_EQ(Counted::live, 1);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(SmallVectorTest, ClearKeepsTheCapacity) {
+  utils::SmallVector<Counted, 1> values;
+  values.emplace_back("a");
+  values.emplace_back("b");
+  const auto capacity = values.capacity();
+
+  values.clear();
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.capacity(), capacity);
+  EXPECT_EQ(Counted::live, 0);
+}
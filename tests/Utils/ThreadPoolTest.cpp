@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Utils/Random.h"
+#include "Utils/ThreadPool.h"
+
+TEST(ThreadPoolTest, RejectsZeroThreads) {
+  EXPECT_THROW(utils::ThreadPool pool(0), std::invalid_argument);
+}
+
+TEST(ThreadPoolTest, VisitsEveryIndexExactlyOnce) {
+  utils::ThreadPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+
+  std::vector<std::atomic<int>> visits(1000);
+  pool.parallel_for(0, static_cast<int>(visits.size()), [&](int i) { visits[i]++; });
+
+  for (const auto &count : visits) { EXPECT_EQ(count.load(), 1); }
+}
+
+TEST(ThreadPoolTest, IsReusableAcrossJobs) {
+  utils::ThreadPool pool(3);
+  std::atomic<long> sum{0};
+  for (int job = 0; job < 50; ++job) {
+    pool.parallel_for(0, 100, [&](int i) { sum += i; });
+  }
+  EXPECT_EQ(sum.load(), 50L * 4950L);
+}
+
+TEST(ThreadPoolTest, EmptyRangeDoesNothing) {
+  utils::ThreadPool pool(2);
+  std::atomic<int> calls{0};
+  pool.parallel_for(5, 5, [&](int) { calls++; });
+  EXPECT_EQ(calls.load(), 0);
+}
+
+TEST(ThreadPoolTest, RethrowsTaskException) {
+  utils::ThreadPool pool(4);
+  EXPECT_THROW(pool.parallel_for(0, 100,
+                                 [](int i) {
+                                   if (i == 42) { throw std::runtime_error("task failed"); }
+                                 }),
+               std::runtime_error);
+
+  // the pool is still usable after a failed job
+  std::atomic<int> calls{0};
+  pool.parallel_for(0, 10, [&](int) { calls++; });
+  EXPECT_EQ(calls.load(), 10);
+}
+
+TEST(ThreadPoolTest, DerivedStreamsAreReproducibleAndDistinct) {
+  EXPECT_EQ(utils::Random::derive_seed(123, 0), utils::Random::derive_seed(123, 0));
+  EXPECT_NE(utils::Random::derive_seed(123, 0), utils::Random::derive_seed(123, 1));
+  EXPECT_NE(utils::Random::derive_seed(123, 0), utils::Random::derive_seed(124, 0));
+
+  // each stream draws the same numbers whichever thread runs it
+  constexpr int number_of_streams = 8;
+  std::vector<double> serial(number_of_streams);
+  std::vector<double> parallel(number_of_streams);
+  for (int s = 0; s < number_of_streams; ++s) {
+    utils::Random random(nullptr, utils::Random::derive_seed(7, s));
+    serial[s] = random.random_flat(0.0, 1.0);
+  }
+  utils::ThreadPool pool(4);
+  pool.parallel_for(0, number_of_streams, [&](int s) {
+    utils::Random random(nullptr, utils::Random::derive_seed(7, s));
+    parallel[s] = random.random_flat(0.0, 1.0);
+  });
+  EXPECT_EQ(serial, parallel);
+}
@@ -244,12 +244,12 @@ inline void cleanup_test_files() {
     std::filesystem::remove(file);
   }
   
-  // Also remove any .db files
+  // Also remove any .db files and raster caches
   std::error_code ec;
   for (const auto& entry : std::filesystem::directory_iterator(".", ec)) {
     if (entry.is_regular_file()) {
       std::string filename = entry.path().filename().string();
-      if (filename.ends_with(".db")) {
+      if (filename.ends_with(".db") || filename.ends_with(".asc.bin")) {
         std::filesystem::remove(entry.path(), ec);
       }
     }